@@ -38,6 +38,7 @@
 #include "mutableiterator.h"
 #include "thresholder.h"
 #include "tesseractclass.h"
+#include "pagearena.h"
 #include "pageres.h"
 #include "paragraphs.h"
 #include "tessvars.h"
@@ -109,6 +110,8 @@ TessBaseAPI::TessBaseAPI()
     paragraph_models_(NULL),
     block_list_(NULL),
     page_res_(NULL),
+    page_arena_(NULL),
+    param_overlay_(NULL),
     input_file_(NULL),
     output_file_(NULL),
     language_(NULL),
@@ -180,6 +183,20 @@ bool TessBaseAPI::SetVariable(const char* name, const char* value) {
                               tesseract_->params());
 }
 
+bool TessBaseAPI::SetTemporaryVariable(const char* name, const char* value) {
+  if (tesseract_ == NULL) tesseract_ = new Tesseract;
+  if (param_overlay_ == NULL)
+    param_overlay_ = new ParamsOverlay(tesseract_->params());
+  return param_overlay_->SetParam(name, value,
+                                  SET_PARAM_CONSTRAINT_NON_INIT_ONLY);
+}
+
+/** Puts back the values replaced by SetTemporaryVariable. */
+void TessBaseAPI::RevertTemporaryVariables() {
+  if (param_overlay_ != NULL)
+    param_overlay_->Revert();
+}
+
 bool TessBaseAPI::SetDebugVariable(const char* name, const char* value) {
   if (tesseract_ == NULL) tesseract_ = new Tesseract;
   return ParamUtils::SetParam(name, value, SET_PARAM_CONSTRAINT_DEBUG_ONLY,
@@ -241,6 +258,9 @@ int TessBaseAPI::Init(const char* datapath, const char* language,
                       bool set_only_non_debug_params) {
   // Default language is "eng".
   if (language == NULL) language = "eng";
+  // Configs and vars are applied to the variables as they were before any
+  // temporary changes, and they must not be undone by a later revert.
+  RevertTemporaryVariables();
   // If the datapath, OcrEngineMode or the language have changed - start again.
   // Note that the language_ field stores the last requested language that was
   // initialized successfully, while tesseract_->lang stores the language
@@ -250,6 +270,8 @@ int TessBaseAPI::Init(const char* datapath, const char* language,
       (datapath_ == NULL || language_ == NULL ||
        *datapath_ != datapath || last_oem_requested_ != oem ||
        (*language_ != language && tesseract_->lang != language))) {
+    delete param_overlay_;
+    param_overlay_ = NULL;
     delete tesseract_;
     tesseract_ = NULL;
   }
@@ -724,6 +746,12 @@ int TessBaseAPI::Recognize(ETEXT_DESC* monitor) {
     return -1;
   if (page_res_ != NULL)
     delete page_res_;
+  // The results are allocated from the arena until the end of recognition,
+  // and the arena is released by ClearResults.
+  if (tesseract_->tessedit_page_arena && page_arena_ == NULL)
+    page_arena_ = new PageArena;
+  PageArenaScope arena_scope(tesseract_->tessedit_page_arena ? page_arena_
+                                                             : NULL);
   if (block_list_->empty()) {
     page_res_ = new PAGE_RES(block_list_, &tesseract_->prev_word_best_choice_);
     return 0; // Empty page.
@@ -1526,6 +1554,10 @@ void TessBaseAPI::End() {
     delete paragraph_models_;
     paragraph_models_ = NULL;
   }
+  if (param_overlay_ != NULL) {
+    delete param_overlay_;
+    param_overlay_ = NULL;
+  }
   if (tesseract_ != NULL) {
     delete tesseract_;
     if (osd_tesseract_ == tesseract_)
@@ -1536,6 +1568,10 @@ void TessBaseAPI::End() {
     delete osd_tesseract_;
     osd_tesseract_ = NULL;
   }
+  if (page_arena_ != NULL) {
+    page_arena_->Destroy();
+    page_arena_ = NULL;
+  }
   if (equ_detect_ != NULL) {
     delete equ_detect_;
     equ_detect_ = NULL;
@@ -1726,6 +1762,11 @@ int TessBaseAPI::FindLines() {
     }
   }
 
+  if (osd_tess != NULL && osd_tess != tesseract_) {
+    // The OSD engine is made above without the user's configs and variables,
+    // so it takes the choice of fast OSD from the main engine.
+    osd_tess->tessedit_osd_fast.set_value(tesseract_->tessedit_osd_fast);
+  }
   if (tesseract_->SegmentPage(input_file_, block_list_, osd_tess, &osr) < 0)
     return -1;
   // If Devanagari is being recognized, we use different images for page seg
@@ -1743,6 +1784,8 @@ void TessBaseAPI::ClearResults() {
     delete page_res_;
     page_res_ = NULL;
   }
+  if (page_arena_ != NULL)
+    page_arena_->Release();
   recognition_done_ = false;
   if (block_list_ == NULL)
     block_list_ = new BLOCK_LIST;
@@ -1807,6 +1850,22 @@ void TessBaseAPI::set_min_orientation_margin(double margin) {
   tesseract_->min_orientation_margin.set_value(margin);
 }
 
+/**
+ * Return the number and total size in bytes of the result objects allocated
+ * for the current page, and the memory reserved for them, when
+ * tessedit_page_arena is set.
+ */
+bool TessBaseAPI::GetPageArenaStats(int* allocations, int* bytes,
+                                    int* reserved_bytes) const {
+  if (page_arena_ == NULL)
+    return false;
+  PageArenaStats stats = page_arena_->stats();
+  *allocations = static_cast<int>(stats.allocations);
+  *bytes = static_cast<int>(stats.bytes);
+  *reserved_bytes = static_cast<int>(stats.reserved_bytes);
+  return true;
+}
+
 /**
  * Return text orientation of each block as determined in an earlier page layout
  * analysis operation. Orientation is returned as the number of ccw 90-degree
@@ -1908,8 +1967,11 @@ TBLOB *TessBaseAPI::MakeTBLOB(Pix *pix) {
   int height = pixGetHeight(pix);
   BLOCK block("a character", TRUE, 0, 0, 0, 0, width, height);
 
-  // Create C_BLOBs from the page
-  extract_edges(pix, &block);
+  // Create C_BLOBs from the page. There is no engine here to take the
+  // edges_* params from, so use a Textord holding their default values.
+  CCStruct ccstruct;
+  Textord textord(&ccstruct);
+  extract_edges(&textord, pix, &block);
 
   // Merge all C_BLOBs
   C_BLOB_LIST *list = block.blob_list();
@@ -1924,8 +1986,9 @@ TBLOB *TessBaseAPI::MakeTBLOB(Pix *pix) {
       C_BLOB *c_blob = c_blob_it.data();
       ol_it.add_list_after(c_blob->out_list());
   }
-  // Convert the first blob to the output TBLOB.
-  return TBLOB::PolygonalCopy(c_blob_it.data());
+  // Convert the first blob to the output TBLOB. There is no engine here to
+  // take the poly_* params from, so use their default values.
+  return TBLOB::PolygonalCopy(c_blob_it.data(), true, false);
 }
 
 /**
@@ -2237,6 +2300,31 @@ int TessBaseAPI::NumDawgs() const {
   return tesseract_ == NULL ? 0 : tesseract_->getDict().NumDawgs();
 }
 
+/** Build a user dictionary overlay from a word list. */
+Dawg *TessBaseAPI::BuildUserDawg(const char *filename) const {
+  if (tesseract_ == NULL) return NULL;
+  return Dict::BuildUserDawg(filename, tesseract_->unicharset,
+                             tesseract_->lang,
+                             tesseract_->getDict().dawg_debug_level);
+}
+
+/** Attach a user dictionary overlay to the dictionary of tesseract_. */
+bool TessBaseAPI::AttachUserDawg(Dawg *dawg) {
+  if (tesseract_ == NULL || tesseract_->getDict().NumDawgs() == 0)
+    return false;
+  return tesseract_->getDict().AttachUserDawg(dawg);
+}
+
+/** Detach a user dictionary overlay from the dictionary of tesseract_. */
+bool TessBaseAPI::DetachUserDawg(Dawg *dawg) {
+  return tesseract_ != NULL && tesseract_->getDict().DetachUserDawg(dawg);
+}
+
+/** Detach all the user dictionary overlays. */
+void TessBaseAPI::DetachAllUserDawgs() {
+  if (tesseract_ != NULL) tesseract_->getDict().DetachAllUserDawgs();
+}
+
 /** Return a pointer to underlying CubeRecoContext object if present. */
 CubeRecoContext *TessBaseAPI::GetCubeRecoContext() const {
   return (tesseract_ == NULL) ? NULL : tesseract_->GetCubeRecoContext();
@@ -74,6 +74,8 @@ class Dict;
 class EquationDetect;
 class LTRResultIterator;
 class MutableIterator;
+class PageArena;
+class ParamsOverlay;
 class Tesseract;
 class Trie;
 class Wordrec;
@@ -141,6 +143,23 @@ class TESS_API TessBaseAPI {
   bool SetVariable(const char* name, const char* value);
   bool SetDebugVariable(const char* name, const char* value);
 
+  /**
+   * As SetVariable, but the variable keeps its previous value, to be put
+   * back by RevertTemporaryVariables. Use it for settings that differ from
+   * one page or request to the next, eg:
+   *   api.SetTemporaryVariable("tessedit_char_whitelist", "0123456789");
+   *   api.SetImage(pix);
+   *   char* text = api.GetUTF8Text();
+   *   api.RevertTemporaryVariables();
+   * The changes last, whatever is called in between, until the revert, the
+   * next Init or End. Putting them back costs only as much as the number of
+   * variables set, and no configs are read again. Global variables changed
+   * this way are seen by other threads until they are put back.
+   */
+  bool SetTemporaryVariable(const char* name, const char* value);
+  /** Puts back the values replaced by SetTemporaryVariable. */
+  void RevertTemporaryVariables();
+
   /**
    * Returns true if the parameter was found among Tesseract parameters.
    * Fills in value with the value of the parameter.
@@ -640,6 +659,29 @@ class TESS_API TessBaseAPI {
   /** Return the number of dawgs loaded into tesseract_ object. */
   int NumDawgs() const;
 
+  /**
+   * Builds a user dictionary overlay from the given word list (one UTF-8
+   * word per line) for the language loaded by Init. The returned dawg is
+   * owned by the caller and may be cached and attached to any number of
+   * TessBaseAPI instances initialized with the same language.
+   * @return NULL on failure.
+   */
+  Dawg *BuildUserDawg(const char *filename) const;
+
+  /**
+   * Attaches a user dictionary overlay, which is then consulted together
+   * with the built-in dawgs until detached. The dawg is not copied and
+   * must outlive the attachment.
+   * @return false if there is no dictionary or the dawg is already attached.
+   */
+  bool AttachUserDawg(Dawg *dawg);
+
+  /** Detaches a user dictionary overlay attached with AttachUserDawg. */
+  bool DetachUserDawg(Dawg *dawg);
+
+  /** Detaches all the user dictionary overlays. */
+  void DetachAllUserDawgs();
+
   /** Returns a ROW object created from the input row specification. */
   static ROW *MakeTessOCRRow(float baseline, float xheight,
                              float descender, float ascender);
@@ -670,6 +712,15 @@ class TESS_API TessBaseAPI {
 
   void set_min_orientation_margin(double margin);
 
+  /**
+   * Return the number and total size in bytes of the result objects
+   * allocated for the current page, and the memory reserved for them, when
+   * tessedit_page_arena is set. Returns false if no page has been
+   * recognized with tessedit_page_arena set.
+   */
+  bool GetPageArenaStats(int* allocations, int* bytes,
+                         int* reserved_bytes) const;
+
   /**
    * Return text orientation of each block as determined by an earlier run
    * of layout analysis.
@@ -770,6 +821,8 @@ class TESS_API TessBaseAPI {
   GenericVector<ParagraphModel *>* paragraph_models_;
   BLOCK_LIST*       block_list_;      ///< The page layout.
   PAGE_RES*         page_res_;        ///< The page-level data.
+  PageArena*        page_arena_;      ///< Pool for page_res_ if enabled.
+  ParamsOverlay*    param_overlay_;   ///< SetTemporaryVariable changes.
   STRING*           input_file_;      ///< Name used by training code.
   STRING*           output_file_;     ///< Name used by debug code.
   STRING*           datapath_;        ///< Current location of tessdata.
@@ -0,0 +1,170 @@
+///////////////////////////////////////////////////////////////////////
+// File:        layouttemplate_test.cpp
+// Description: Checks the matching, storage and reuse of layout templates.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+///////////////////////////////////////////////////////////////////////
+
+// Include automatically generated configuration file if running autoconf
+#ifdef HAVE_CONFIG_H
+#include "config_auto.h"
+#endif
+
+#include <stdio.h>
+#include "layouttemplate.h"
+#include "ocrblock.h"
+#include "publictypes.h"
+#include "tprintf.h"
+
+// Usage:
+//   layouttemplate_test
+//
+// Builds the fingerprints of a made up form directly from its lines, and
+// checks that they match only when they should: with the scanning shift as
+// the offset, not in another page segmentation mode, and not when two lines
+// of one page could only pair with the same line of the other. Then saves a
+// template to a file, loads it back and checks that it still finds the page
+// and makes its blocks in the right place. Returns 0 if all the checks pass.
+
+using tesseract::LayoutFingerprint;
+using tesseract::LayoutTemplate;
+using tesseract::LayoutTemplateCache;
+using tesseract::TabVector_LIST;
+
+const int kWidth = 2000;
+const int kHeight = 3000;
+const int kResolution = 300;
+const char kTemplateFile[] = "layouttemplate_test.ltm";
+
+static int num_failures = 0;
+
+// Reports a failed check.
+static void Check(bool condition, const char* description) {
+  if (!condition) {
+    tprintf("FAILED: %s\n", description);
+    ++num_failures;
+  }
+}
+
+// Sets fingerprint to the page of a simple form: two columns divided by
+// vertical rules, and a horizontal rule across the middle, all shifted by
+// (dx, dy). If doubled, a second rule 10 pixels to the right of the left
+// rule replaces the horizontal rule.
+static void MakeForm(int dx, int dy, int pageseg_mode, bool doubled,
+                     LayoutFingerprint* fingerprint) {
+  TabVector_LIST v_lines;
+  TabVector_LIST h_lines;
+  fingerprint->Set(kWidth, kHeight, kResolution, pageseg_mode,
+                   &v_lines, &h_lines);
+  fingerprint->AddLine(ICOORD(100 + dx, 100 + dy),
+                       ICOORD(100 + dx, 2900 + dy));
+  fingerprint->AddLine(ICOORD(1000 + dx, 100 + dy),
+                       ICOORD(1000 + dx, 2900 + dy));
+  fingerprint->AddLine(ICOORD(1900 + dx, 100 + dy),
+                       ICOORD(1900 + dx, 2900 + dy));
+  if (doubled) {
+    fingerprint->AddLine(ICOORD(110 + dx, 100 + dy),
+                         ICOORD(110 + dx, 2900 + dy));
+  } else {
+    fingerprint->AddLine(ICOORD(100 + dx, 1500 + dy),
+                         ICOORD(1900 + dx, 1500 + dy));
+  }
+}
+
+int main(int argc, char **argv) {
+  LayoutFingerprint form;
+  MakeForm(0, 0, tesseract::PSM_AUTO, false, &form);
+  Check(form.IsDistinctive(), "a form with 4 lines is distinctive");
+
+  LayoutFingerprint shifted;
+  MakeForm(5, -4, tesseract::PSM_AUTO, false, &shifted);
+  ICOORD offset;
+  Check(form.Matches(shifted, &offset), "a shifted page matches");
+  Check(offset.x() == 5 && offset.y() == -4,
+        "the offset is the shift of the page");
+  Check(form.Matches(form, &offset) && offset.x() == 0 && offset.y() == 0,
+        "a page matches itself with no offset");
+
+  LayoutFingerprint far_shifted;
+  MakeForm(50, 0, tesseract::PSM_AUTO, false, &far_shifted);
+  Check(!form.Matches(far_shifted, &offset),
+        "a page shifted by more than the tolerance doesn't match");
+
+  LayoutFingerprint other_mode;
+  MakeForm(5, -4, tesseract::PSM_SINGLE_BLOCK, false, &other_mode);
+  Check(!form.Matches(other_mode, &offset),
+        "a page in another page segmentation mode doesn't match");
+
+  // Each line of doubled is near a line of one_sided and vice versa, but
+  // the two rules on the left of doubled can only pair with the one rule on
+  // the left of one_sided, so they must not match.
+  LayoutFingerprint doubled;
+  MakeForm(0, 0, tesseract::PSM_AUTO, true, &doubled);
+  Check(doubled.Matches(doubled, &offset), "a doubled form matches itself");
+  LayoutFingerprint one_sided;
+  TabVector_LIST v_lines;
+  TabVector_LIST h_lines;
+  one_sided.Set(kWidth, kHeight, kResolution, tesseract::PSM_AUTO,
+                &v_lines, &h_lines);
+  one_sided.AddLine(ICOORD(100, 100), ICOORD(100, 2900));
+  one_sided.AddLine(ICOORD(1000, 100), ICOORD(1000, 2900));
+  one_sided.AddLine(ICOORD(1005, 100), ICOORD(1005, 2900));
+  one_sided.AddLine(ICOORD(1900, 100), ICOORD(1900, 2900));
+  Check(!doubled.Matches(one_sided, &offset) &&
+        !one_sided.Matches(doubled, &offset),
+        "lines that can only pair with the same line don't match");
+
+  LayoutFingerprint sparse;
+  sparse.Set(kWidth, kHeight, kResolution, tesseract::PSM_AUTO,
+             &v_lines, &h_lines);
+  sparse.AddLine(ICOORD(100, 100), ICOORD(100, 2900));
+  sparse.AddLine(ICOORD(1000, 100), ICOORD(1000, 2900));
+  Check(!sparse.IsDistinctive() && !sparse.Matches(sparse, &offset),
+        "a page with 2 lines never matches");
+
+  // Store the layout of form, with a single block, and read it back.
+  BLOCK_LIST blocks;
+  BLOCK_IT b_it(&blocks);
+  b_it.add_after_then_move(new BLOCK("", true, 0, 0, 150, 200, 950, 1400));
+  LayoutTemplate* layout = new LayoutTemplate;
+  Check(layout->Set(form, &blocks, FCOORD(1.0f, 0.0f), FCOORD(1.0f, 0.0f)),
+        "the layout of an unrotated block can be stored");
+  LayoutTemplateCache cache;
+  cache.Add(layout);
+  Check(cache.Save(kTemplateFile), "the templates can be saved");
+  LayoutTemplateCache loaded;
+  Check(loaded.Load(kTemplateFile) && loaded.size() == 1,
+        "the saved templates load again");
+  remove(kTemplateFile);
+
+  const LayoutTemplate* found = loaded.FindMatch(shifted, &offset);
+  Check(found != NULL, "the loaded template finds the shifted page");
+  if (found != NULL) {
+    BLOCK_LIST new_blocks;
+    found->MakeBlocks(offset, &new_blocks);
+    BLOCK_IT new_it(&new_blocks);
+    Check(new_blocks.length() == 1 &&
+          new_it.data()->bounding_box() == TBOX(155, 196, 955, 1396),
+          "the template's block is moved by the offset");
+  }
+  Check(loaded.FindMatch(other_mode, &offset) == NULL,
+        "the loaded template doesn't find a page in another mode");
+  Check(loaded.FindMatch(doubled, &offset) == NULL,
+        "the loaded template doesn't find another form");
+
+  if (num_failures > 0) {
+    tprintf("%d checks failed\n", num_failures);
+    return 1;
+  }
+  tprintf("All layout template checks passed\n");
+  return 0;
+}
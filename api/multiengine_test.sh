@@ -0,0 +1,52 @@
+#!/bin/sh
+# File:        multiengine_test.sh
+# Description: Runs multiengine_tester on phototest.tif with two engines
+#              configured differently in layout analysis and
+#              classification.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+# http://www.apache.org/licenses/LICENSE-2.0
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# The test is skipped (exit 77) if there is no eng.traineddata under
+# $TESSDATA_PREFIX/tessdata, which defaults to the source tree.
+srcdir=${srcdir:-.}
+top_srcdir=$srcdir/..
+if [ -z "$TESSDATA_PREFIX" ]
+then
+  TESSDATA_PREFIX=$top_srcdir/
+fi
+if [ ! -r "$TESSDATA_PREFIX/tessdata/eng.traineddata" ]
+then
+  echo "No eng.traineddata in $TESSDATA_PREFIX/tessdata, skipping"
+  exit 77
+fi
+export TESSDATA_PREFIX
+
+configdir=multiengine_test.configs
+rm -rf $configdir
+mkdir $configdir
+cat > $configdir/engine_a <<EOF
+tessedit_pageseg_mode 6
+textord_min_linesize 2.0
+textord_tabfind_find_tables 0
+classify_min_slope 0.3
+EOF
+cat > $configdir/engine_b <<EOF
+classify_bln_numeric_mode 1
+classify_norm_adj_midpoint 24.0
+speckle_large_max_size 0.2
+textord_tabfind_aligned_gap_fraction 0.5
+EOF
+
+./multiengine_tester $top_srcdir/phototest.tif -runs 4 \
+  $configdir/engine_a $configdir/engine_b
+status=$?
+rm -rf $configdir
+exit $status
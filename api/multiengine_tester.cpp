@@ -0,0 +1,147 @@
+///////////////////////////////////////////////////////////////////////
+// File:        multiengine_tester.cpp
+// Description: Checks that differently configured engines can run
+//              concurrently without affecting each other's results.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+///////////////////////////////////////////////////////////////////////
+
+// Include automatically generated configuration file if running autoconf
+#ifdef HAVE_CONFIG_H
+#include "config_auto.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include "allheaders.h"
+#include "baseapi.h"
+#include "basedir.h"
+#include "genericvector.h"
+#include "strngs.h"
+#include "tprintf.h"
+
+// Usage:
+//   multiengine_tester imagename [-l lang] [-runs n] configfile...
+//
+// Each configfile sets up one engine, so give at least two that change
+// params of different stages, eg one with tessedit_pageseg_mode 6 and
+// textord_min_linesize 2.0, and one with classify_bln_numeric_mode 1.
+// Every engine first recognizes the image on its own to get its expected
+// text. Then all the engines are initialized and run at the same time, one
+// per thread, -runs times over. Any difference from the expected text means
+// that one engine's settings or state leaked into another, so the program
+// returns 1. It returns 0 if all the texts match, and 77 (skipped) if it was
+// built without OpenMP, as then there are no threads to test.
+
+// Initializes a new engine with the given config file, recognizes pix with
+// it and puts the text in *text. Returns false if the engine failed to
+// initialize or recognize.
+static bool RecognizeWithConfig(const char* datapath, const char* lang,
+                                const char* configfile, const Pix* pix,
+                                STRING* text) {
+  tesseract::TessBaseAPI api;
+  char* configs[] = { const_cast<char*>(configfile) };
+  if (api.Init(datapath, lang, tesseract::OEM_DEFAULT, configs, 1,
+               NULL, NULL, false)) {
+    tprintf("Could not initialize tesseract with %s\n", configfile);
+    return false;
+  }
+  api.SetImage(pix);
+  char* utf8 = api.GetUTF8Text();
+  if (utf8 == NULL) {
+    tprintf("Recognition failed with %s\n", configfile);
+    return false;
+  }
+  *text = utf8;
+  delete [] utf8;
+  api.End();
+  return true;
+}
+
+int main(int argc, char **argv) {
+  const char* lang = "eng";
+  const char* image = NULL;
+  int num_runs = 4;
+  int arg = 1;
+  while (arg < argc && (image == NULL || argv[arg][0] == '-')) {
+    if (strcmp(argv[arg], "-l") == 0 && arg + 1 < argc) {
+      lang = argv[arg + 1];
+      ++arg;
+    } else if (strcmp(argv[arg], "-runs") == 0 && arg + 1 < argc) {
+      num_runs = atoi(argv[arg + 1]);
+      ++arg;
+    } else if (image == NULL) {
+      image = argv[arg];
+    }
+    ++arg;
+  }
+  int num_engines = argc - arg;
+  if (image == NULL || num_engines < 2) {
+    fprintf(stderr, "Usage:%s imagename [-l lang] [-runs n] "
+            "configfile configfile [configfile...]\n", argv[0]);
+    return 1;
+  }
+#ifndef _OPENMP
+  tprintf("Built without OpenMP: engines can't be run concurrently.\n");
+  return 77;
+#endif
+  STRING tessdata_dir;
+  truncate_path(argv[0], &tessdata_dir);
+  Pix* pix = pixRead(image);
+  if (pix == NULL) {
+    tprintf("Could not read image %s\n", image);
+    return 1;
+  }
+  // Each engine gets its own copy of the image, as the engines clone it and
+  // leptonica reference counts are not thread-safe.
+  GenericVector<Pix*> pixes;
+  for (int e = 0; e < num_engines; ++e)
+    pixes.push_back(pixCopy(NULL, pix));
+  pixDestroy(&pix);
+
+  GenericVector<STRING> expected;
+  expected.init_to_size(num_engines, STRING());
+  bool ok = true;
+  for (int e = 0; e < num_engines && ok; ++e) {
+    ok = RecognizeWithConfig(tessdata_dir.string(), lang, argv[arg + e],
+                             pixes[e], &expected[e]);
+  }
+  int num_mismatches = 0;
+  for (int run = 0; run < num_runs && ok; ++run) {
+    GenericVector<STRING> texts;
+    texts.init_to_size(num_engines, STRING());
+    GenericVector<bool> results;
+    results.init_to_size(num_engines, false);
+#pragma omp parallel for num_threads(num_engines)
+    for (int e = 0; e < num_engines; ++e) {
+      results[e] = RecognizeWithConfig(tessdata_dir.string(), lang,
+                                       argv[arg + e], pixes[e], &texts[e]);
+    }
+    for (int e = 0; e < num_engines; ++e) {
+      if (!results[e]) {
+        ok = false;
+      } else if (texts[e] != expected[e]) {
+        tprintf("Run %d: engine with %s differs from its serial run:\n"
+                "%s\n----- expected -----\n%s\n", run, argv[arg + e],
+                texts[e].string(), expected[e].string());
+        ++num_mismatches;
+      }
+    }
+  }
+  for (int e = 0; e < num_engines; ++e)
+    pixDestroy(&pixes[e]);
+  if (!ok)
+    return 1;
+  tprintf("%d engines, %d concurrent runs: %d mismatches\n",
+          num_engines, num_runs, num_mismatches);
+  return num_mismatches == 0 ? 0 : 1;
+}
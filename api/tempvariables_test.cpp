@@ -0,0 +1,140 @@
+///////////////////////////////////////////////////////////////////////
+// File:        tempvariables_test.cpp
+// Description: Checks that temporary variable changes are put back.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+///////////////////////////////////////////////////////////////////////
+
+// Include automatically generated configuration file if running autoconf
+#ifdef HAVE_CONFIG_H
+#include "config_auto.h"
+#endif
+
+#include <string.h>
+#include "baseapi.h"
+#include "params.h"
+#include "tprintf.h"
+
+// Usage:
+//   tempvariables_test
+//
+// Sets params of every type, member and global, through a ParamsOverlay,
+// checks that they changed, reverts and checks that they have their old
+// values again, even for a param that was set twice. Then does the same
+// through TessBaseAPI::SetTemporaryVariable, RevertTemporaryVariables and
+// End. No traineddata is needed. Returns 0 if all the checks pass.
+
+using tesseract::ParamsOverlay;
+using tesseract::ParamsVectors;
+using tesseract::SET_PARAM_CONSTRAINT_NON_INIT_ONLY;
+
+INT_VAR(tempvariables_test_global, 3, "Global param for the overlay test");
+
+static int num_failures = 0;
+
+// Reports a failed check.
+static void Check(bool condition, const char* description) {
+  if (!condition) {
+    tprintf("FAILED: %s\n", description);
+    ++num_failures;
+  }
+}
+
+// Checks the overlay on its own, with params of each type.
+static void TestOverlay() {
+  ParamsVectors members;
+  tesseract::IntParam int_param(7, "test_int", "", false, &members);
+  tesseract::BoolParam bool_param(false, "test_bool", "", false, &members);
+  tesseract::StringParam string_param("abc", "test_string", "", false,
+                                      &members);
+  tesseract::DoubleParam double_param(0.5, "test_double", "", false,
+                                      &members);
+  {
+    ParamsOverlay overlay(&members);
+    Check(overlay.SetParam("test_int", "8",
+                           SET_PARAM_CONSTRAINT_NON_INIT_ONLY) &&
+          overlay.SetParam("test_int", "9",
+                           SET_PARAM_CONSTRAINT_NON_INIT_ONLY) &&
+          overlay.SetParam("test_bool", "1",
+                           SET_PARAM_CONSTRAINT_NON_INIT_ONLY) &&
+          overlay.SetParam("test_string", "xyz",
+                           SET_PARAM_CONSTRAINT_NON_INIT_ONLY) &&
+          overlay.SetParam("test_double", "0.25",
+                           SET_PARAM_CONSTRAINT_NON_INIT_ONLY) &&
+          overlay.SetParam("tempvariables_test_global", "4",
+                           SET_PARAM_CONSTRAINT_NON_INIT_ONLY),
+          "the overlay sets existing params");
+    Check(!overlay.SetParam("test_no_such_param", "1",
+                            SET_PARAM_CONSTRAINT_NON_INIT_ONLY),
+          "the overlay fails on a missing param");
+    Check(int_param == 9 && bool_param && double_param == 0.25 &&
+          strcmp(string_param.string(), "xyz") == 0 &&
+          tempvariables_test_global == 4,
+          "the overlay changes the params");
+    overlay.Revert();
+    Check(int_param == 7 && !bool_param && double_param == 0.5 &&
+          strcmp(string_param.string(), "abc") == 0 &&
+          tempvariables_test_global == 3,
+          "Revert puts back the first values");
+    Check(overlay.empty(), "Revert empties the overlay");
+
+    // A param changed outside the overlay keeps that value after a revert.
+    int_param.set_value(10);
+    overlay.SetParam("test_bool", "1", SET_PARAM_CONSTRAINT_NON_INIT_ONLY);
+    overlay.Revert();
+    Check(int_param == 10 && !bool_param,
+          "Revert leaves params not set through the overlay");
+    overlay.SetParam("test_int", "11", SET_PARAM_CONSTRAINT_NON_INIT_ONLY);
+  }
+  Check(int_param == 10, "deleting the overlay puts the params back");
+}
+
+// Checks the TessBaseAPI calls that use an overlay.
+static void TestBaseAPI() {
+  tesseract::TessBaseAPI api;
+  int psm = -1;
+  Check(api.SetVariable("tessedit_pageseg_mode", "3") &&
+        api.GetIntVariable("tessedit_pageseg_mode", &psm) && psm == 3,
+        "SetVariable sets a variable");
+  Check(api.SetTemporaryVariable("tessedit_pageseg_mode", "6") &&
+        api.SetTemporaryVariable("tessedit_char_whitelist", "0123456789") &&
+        api.SetTemporaryVariable("tempvariables_test_global", "5"),
+        "SetTemporaryVariable sets existing variables");
+  Check(!api.SetTemporaryVariable("test_no_such_param", "1"),
+        "SetTemporaryVariable fails on a missing variable");
+  Check(api.GetIntVariable("tessedit_pageseg_mode", &psm) && psm == 6 &&
+        strcmp(api.GetStringVariable("tessedit_char_whitelist"),
+               "0123456789") == 0 && tempvariables_test_global == 5,
+        "the temporary values are in effect");
+  api.RevertTemporaryVariables();
+  Check(api.GetIntVariable("tessedit_pageseg_mode", &psm) && psm == 3 &&
+        strcmp(api.GetStringVariable("tessedit_char_whitelist"), "") == 0 &&
+        tempvariables_test_global == 3,
+        "RevertTemporaryVariables puts back the previous values");
+
+  // End deletes the engine, so only the global shows what End did.
+  api.SetTemporaryVariable("tempvariables_test_global", "6");
+  api.End();
+  Check(tempvariables_test_global == 3,
+        "End puts back temporary global variables");
+}
+
+int main(int argc, char **argv) {
+  TestOverlay();
+  TestBaseAPI();
+  if (num_failures > 0) {
+    tprintf("%d checks failed\n", num_failures);
+    return 1;
+  }
+  tprintf("All temporary variable checks passed\n");
+  return 0;
+}
@@ -259,6 +259,7 @@ void Tesseract::MaximallyChopWord(const GenericVector<TBOX>& boxes,
                                   WERD_RES* word_res) {
   if (!word_res->SetupForTessRecognition(unicharset, this, BestPix(), false,
                                          this->textord_use_cjk_fp_model,
+                                         poly_wide_objects_better, poly_debug,
                                          row, block)) {
     word_res->CloneChoppedToRebuild();
     return;
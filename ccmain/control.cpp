@@ -880,6 +880,7 @@ void Tesseract::classify_word_pass1(BLOCK* block, ROW *row, WERD_RES *word) {
   if (word->SetupForTessRecognition(unicharset, this, BestPix(),
                                     classify_bln_numeric_mode,
                                     this->textord_use_cjk_fp_model,
+                                    poly_wide_objects_better, poly_debug,
                                     row, block))
     tess_segment_pass1(word, blob_choices);
   if (!word->tess_failed) {
@@ -1126,6 +1127,7 @@ void Tesseract::match_word_pass2(WERD_RES *word,  //word to do
   if (word->SetupForTessRecognition(unicharset, this, BestPix(),
                                     classify_bln_numeric_mode,
                                     this->textord_use_cjk_fp_model,
+                                    poly_wide_objects_better, poly_debug,
                                     row, block))
     tess_segment_pass2(word, blob_choices);
 
@@ -1294,6 +1296,7 @@ void Tesseract::ExplodeRepeatedWord(BLOB_CHOICE* best_choice,
     if (rep_word->SetupForTessRecognition(*word_res->uch_set, this, BestPix(),
                                           false,
                                           this->textord_use_cjk_fp_model,
+                                          poly_wide_objects_better, poly_debug,
                                           page_res_it->row()->row,
                                           page_res_it->block()->block)) {
       rep_word->CloneChoppedToRebuild();
@@ -44,12 +44,6 @@
 #include "ratngs.h"
 #include "tesseractclass.h"
 
-// Config variables.
-BOOL_VAR(equationdetect_save_bi_image, false, "Save input bi image");
-BOOL_VAR(equationdetect_save_spt_image, false, "Save special character image");
-BOOL_VAR(equationdetect_save_seed_image, false, "Save the seed image");
-BOOL_VAR(equationdetect_save_merged_image, false, "Save the merged image");
-
 namespace tesseract {
 
 ///////////////////////////////////////////////////////////////////////////
@@ -86,6 +80,15 @@ const float kMathItalicDensityTh = 0.5;
 const float kUnclearDensityTh = 0.25;
 const int kSeedBlobsCountTh = 10;
 const int kLeftIndentAlignmentCountTh = 1;
+// Min height of a blob, as a multiple of the line size, to be a large math
+// operator or fence.
+const double kMathTallBlobRatio = 2.2;
+// Min width to height ratio of a flat bar blob.
+const int kMathBarAspectRatio = 3;
+// Min width of a flat bar, as a multiple of the line size.
+const double kMathMinBarWidth = 0.3;
+// Min width of a fraction bar, as a multiple of the line size.
+const double kMathMinFractionBarWidth = 1.5;
 
 // Returns true if PolyBlockType is of text type or equation type.
 inline bool IsTextOrEquationType(PolyBlockType type) {
@@ -111,6 +114,8 @@ EquationDetect::EquationDetect(const char* equ_datapath,
   equ_tesseract_ = lang_tesseract_ = NULL;
   resolution_ = 0;
   page_count_ = 0;
+  skipped_page_count_ = 0;
+  math_shaped_blob_count_ = -1;
 
   // Construct equ_tesseract_.
   equ_tesseract_ = new Tesseract();
@@ -158,10 +163,68 @@ int EquationDetect::LabelSpecialText(TO_BLOCK* to_block) {
       bbox_it.data()->set_special_text_type(BSTT_NONE);
     }
   }
+  math_shaped_blob_count_ = CountMathShapedBlobs(
+      blob_lists, static_cast<int>(to_block->line_size));
 
   return 0;
 }
 
+int EquationDetect::CountMathShapedBlobs(
+    const GenericVector<BLOBNBOX_LIST*>& blob_lists, int line_size) const {
+  if (line_size <= 0)
+    return 0;
+  // Collect the flat bars, and count the tall blobs directly.
+  GenericVector<BLOBNBOX*> bars;
+  int count = 0;
+  for (int i = 0; i < blob_lists.size(); ++i) {
+    BLOBNBOX_IT bbox_it(blob_lists[i]);
+    for (bbox_it.mark_cycle_pt(); !bbox_it.cycled_list(); bbox_it.forward()) {
+      const TBOX& box = bbox_it.data()->bounding_box();
+      if (box.height() >= kMathTallBlobRatio * line_size &&
+          box.width() <= box.height()) {
+        ++count;
+      } else if (box.width() >= kMathBarAspectRatio * box.height() &&
+                 box.width() >= kMathMinBarWidth * line_size) {
+        bars.push_back(bbox_it.data());
+      }
+    }
+  }
+  // Look for stacked bars and for fraction bars. There are few enough bars
+  // on a page to compare with each other, and few enough of them are wide
+  // enough to be a fraction bar to compare with all the blobs.
+  for (int b = 0; b < bars.size(); ++b) {
+    const TBOX& bar_box = bars[b]->bounding_box();
+    bool stacked = false;
+    for (int other = 0; other < bars.size() && !stacked; ++other) {
+      const TBOX& other_box = bars[other]->bounding_box();
+      stacked = other != b && bar_box.major_x_overlap(other_box) &&
+          !bar_box.y_overlap(other_box) &&
+          bar_box.y_gap(other_box) < line_size;
+    }
+    if (!stacked && bar_box.width() >= kMathMinFractionBarWidth * line_size) {
+      bool above = false, below = false;
+      for (int i = 0; i < blob_lists.size() && !(above && below); ++i) {
+        BLOBNBOX_IT bbox_it(blob_lists[i]);
+        for (bbox_it.mark_cycle_pt(); !bbox_it.cycled_list();
+             bbox_it.forward()) {
+          const TBOX& box = bbox_it.data()->bounding_box();
+          if (box.left() < bar_box.left() || box.right() > bar_box.right() ||
+              bar_box.y_gap(box) >= line_size)
+            continue;
+          if (box.bottom() > bar_box.top())
+            above = true;
+          else if (box.top() < bar_box.bottom())
+            below = true;
+        }
+      }
+      stacked = above && below;
+    }
+    if (stacked)
+      ++count;
+  }
+  return count;
+}
+
 void EquationDetect::IdentifySpecialText(
     BLOBNBOX *blobnbox, const int height_th) {
   ASSERT_HOST(blobnbox != NULL);
@@ -173,7 +236,9 @@ void EquationDetect::IdentifySpecialText(
 
   BLOB_CHOICE_LIST ratings_equ, ratings_lang;
   C_BLOB* blob = blobnbox->cblob();
-  TBLOB* tblob = TBLOB::PolygonalCopy(blob);
+  TBLOB* tblob = TBLOB::PolygonalCopy(
+      blob, lang_tesseract_->poly_wide_objects_better,
+      lang_tesseract_->poly_debug);
   const TBOX& box = tblob->bounding_box();
 
   // Normalize the blob. Set the origin to the place we want to be the
@@ -245,18 +310,14 @@ BlobSpecialTextType EquationDetect::EstimateTypeForUnichar(
 
   if (unicharset.get_ispunctuation(id)) {
     // Exclude some special texts that are likely to be confused as math symbol.
-    static GenericVector<UNICHAR_ID> ids_to_exclude;
-    if (ids_to_exclude.empty()) {
-      static const STRING kCharsToEx[] = {"'", "`", "\"", "\\", ",", ".",
-          "〈", "〉", "《", "》", "」", "「", ""};
-      int i = 0;
-      while (kCharsToEx[i] != "") {
-        ids_to_exclude.push_back(
-            unicharset.unichar_to_id(kCharsToEx[i++].string()));
-      }
-      ids_to_exclude.sort();
+    // Compared by string, as the ids differ between unicharsets.
+    static const char* const kCharsToEx[] = {"'", "`", "\"", "\\", ",", ".",
+        "〈", "〉", "《", "》", "」", "「", NULL};
+    for (int i = 0; kCharsToEx[i] != NULL; ++i) {
+      if (s == kCharsToEx[i])
+        return BSTT_NONE;
     }
-    return ids_to_exclude.bool_binary_search(id) ? BSTT_NONE : BSTT_MATH;
+    return BSTT_MATH;
   }
 
   // Check if it is digit. In addition to the isdigit attribute, we also check
@@ -315,7 +376,7 @@ void EquationDetect::IdentifySpecialText() {
   lang_tesseract_->classify_integer_matcher_multiplier.set_value(
       classify_integer_matcher);
 
-  if (equationdetect_save_spt_image) {  // For debug.
+  if (lang_tesseract_->equationdetect_save_spt_image) {  // For debug.
     STRING outfile;
     GetOutputTiffName("_spt", &outfile);
     PaintSpecialTexts(outfile);
@@ -387,7 +448,17 @@ int EquationDetect::FindEquationParts(
   STRING outfile;
   page_count_++;
 
-  if (equationdetect_save_bi_image) {
+  // Classifying every blob with both engines is expensive, so skip pages on
+  // which LabelSpecialText found nothing with the shape of math.
+  int math_shaped_blob_count = math_shaped_blob_count_;
+  math_shaped_blob_count_ = -1;
+  if (lang_tesseract_->equationdetect_prefilter &&
+      math_shaped_blob_count == 0) {
+    ++skipped_page_count_;
+    return 0;
+  }
+
+  if (lang_tesseract_->equationdetect_save_bi_image) {
     GetOutputTiffName("_bi", &outfile);
     pixWrite(outfile.string(), lang_tesseract_->pix_binary(), IFF_TIFF_G4);
   }
@@ -403,7 +474,7 @@ int EquationDetect::FindEquationParts(
   // We still need separate seed into block seed and inline seed partition.
   IdentifyInlineParts();
 
-  if (equationdetect_save_seed_image) {
+  if (lang_tesseract_->equationdetect_save_seed_image) {
     GetOutputTiffName("_seed", &outfile);
     PaintColParts(outfile);
   }
@@ -428,7 +499,7 @@ int EquationDetect::FindEquationParts(
   // Pass 4: find math block satellite text partitions and merge them.
   ProcessMathBlockSatelliteParts();
 
-  if (equationdetect_save_merged_image) {  // For debug.
+  if (lang_tesseract_->equationdetect_save_merged_image) {  // For debug.
     GetOutputTiffName("_merged", &outfile);
     PaintColParts(outfile);
   }
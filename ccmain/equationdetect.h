@@ -71,6 +71,15 @@ class EquationDetect : public EquationDetectBase {
   // Reset the resolution of the processing image. TEST only function.
   void SetResolution(const int resolution);
 
+  // The number of pages given to FindEquationParts, and the number of them
+  // on which the search was skipped by the prefilter.
+  int page_count() const {
+    return page_count_;
+  }
+  int skipped_page_count() const {
+    return skipped_page_count_;
+  }
+
  protected:
   // Identify the special text type for one blob, and update its field. When
   // height_th is set (> 0), we will label the blob as BSTT_NONE if its height
@@ -84,6 +93,14 @@ class EquationDetect : public EquationDetectBase {
   // Compute special text type for each blobs in part_grid_.
   void IdentifySpecialText();
 
+  // Returns the number of blobs in blob_lists whose shape alone marks them
+  // as likely math: very tall blobs (integrals, large fences and operators),
+  // flat bars with another flat bar above or below (=, equivalence etc.),
+  // and wide flat bars with blobs both above and below (fraction bars).
+  // line_size is the typical character size on the page.
+  int CountMathShapedBlobs(const GenericVector<BLOBNBOX_LIST*>& blob_lists,
+                           int line_size) const;
+
   // Identify blobs that we want to skip during special blob type
   // classification.
   void IdentifyBlobsToSkip(ColPartition* part);
@@ -270,6 +287,13 @@ class EquationDetect : public EquationDetectBase {
 
   // The number of pages we have processed.
   int page_count_;
+
+  // The number of pages on which the prefilter skipped the search.
+  int skipped_page_count_;
+
+  // The number of math-shaped blobs found by LabelSpecialText on the current
+  // page, or -1 if LabelSpecialText has not been called for it.
+  int math_shaped_blob_count_;
 };
 
 }  // namespace tesseract
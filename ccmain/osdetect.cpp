@@ -24,17 +24,30 @@
 #include "colfind.h"
 #include "fontinfo.h"
 #include "imagefind.h"
+#include "intfx.h"
 #include "linefind.h"
+#include "mfoutline.h"
+#include "normfeat.h"
 #include "oldlist.h"
 #include "qrsequence.h"
 #include "ratngs.h"
+#include "shapeclassifier.h"
+#include "shapetable.h"
 #include "strngs.h"
 #include "tabvector.h"
 #include "tesseractclass.h"
 #include "textord.h"
+#include "trainingsample.h"
 
 const int kMinCharactersToTry = 50;
 const int kMaxCharactersToTry = 5 * kMinCharactersToTry;
+// The fast path stops on a statistical test rather than a blob count, so it
+// only needs enough blobs for the script detector to have seen something.
+const int kMinCharactersToTryFast = kMinCharactersToTry / 5;
+// Margin of the sequential orientation test used by the fast path. It is
+// twice the default min_orientation_margin, so that an early stop still
+// passes the margin test that AutoPageSeg applies to the result.
+const float kFastOrientationMargin = 14.0f;
 
 const float kSizeRatioToReject = 2.0;
 const int kMinAcceptableBlobHeight = 10;
@@ -157,6 +170,20 @@ void OSResults::accumulate(const OSResults& osr) {
   update_best_script(best_result.orientation_id);
 }
 
+// Returns true if the best orientation leads the runner-up by at least margin.
+bool OSResults::orientation_is_certain(float margin) const {
+  int best = 0;
+  for (int i = 1; i < 4; ++i) {
+    if (orientations[i] > orientations[best])
+      best = i;
+  }
+  for (int i = 0; i < 4; ++i) {
+    if (i != best && orientations[best] - orientations[i] < margin)
+      return false;
+  }
+  return true;
+}
+
 // Detect and erase horizontal/vertical lines and picture regions from the
 // image, so that non-text blobs are removed from consideration.
 void remove_nontext_regions(tesseract::Tesseract *tess, BLOCK_LIST *blocks,
@@ -171,7 +198,8 @@ void remove_nontext_regions(tesseract::Tesseract *tess, BLOCK_LIST *blocks,
   int resolution = (kMinCredibleResolution > pixGetXRes(pix)) ?
       kMinCredibleResolution : pixGetXRes(pix);
 
-  tesseract::LineFinder::FindAndRemoveLines(resolution, false, pix,
+  tesseract::LineFinder::FindAndRemoveLines(&tess->textord(), resolution,
+                                            false, pix,
                                             &vertical_x, &vertical_y,
                                             NULL, &v_lines, &h_lines);
   Pix* im_pix = tesseract::ImageFind::FindImages(pix);
@@ -266,14 +294,14 @@ int os_detect(TO_BLOCK_LIST* port_blocks, OSResults* osr,
       filtered_it.add_to_end(bbox);
     }
   }
-  return os_detect_blobs(&filtered_list, osr, tess);
+  return os_detect_blobs(&filtered_list, osr, tess, tess->tessedit_osd_fast);
 }
 
 // Detect orientation and script from a list of blobs.
 // Returns a non-zero number of blobs if the list was successfully processed, or
 // zero if the list had too few characters to be reliable
 int os_detect_blobs(BLOBNBOX_CLIST* blob_list, OSResults* osr,
-                    tesseract::Tesseract* tess) {
+                    tesseract::Tesseract* tess, bool fast) {
   OSResults osr_;
   if (osr == NULL)
     osr = &osr_;
@@ -303,8 +331,13 @@ int os_detect_blobs(BLOBNBOX_CLIST* blob_list, OSResults* osr,
   QRSequenceGenerator sequence(number_of_blobs);
   int num_blobs_evaluated = 0;
   for (int i = 0; i < real_max; ++i) {
-    if (os_detect_blob(blobs[sequence.GetVal()], &o, &s, osr, tess)
-        && i > kMinCharactersToTry) {
+    if (fast) {
+      if (os_detect_blob_fast(blobs[sequence.GetVal()], &o, &s, osr, tess)
+          && i > kMinCharactersToTryFast) {
+        break;
+      }
+    } else if (os_detect_blob(blobs[sequence.GetVal()], &o, &s, osr, tess)
+               && i > kMinCharactersToTry) {
       break;
     }
     ++num_blobs_evaluated;
@@ -326,7 +359,8 @@ bool os_detect_blob(BLOBNBOX* bbox, OrientationDetector* o,
   tess->tess_cn_matching.set_value(true); // turn it on
   tess->tess_bn_matching.set_value(false);
   C_BLOB* blob = bbox->cblob();
-  TBLOB* tblob = TBLOB::PolygonalCopy(blob);
+  TBLOB* tblob = TBLOB::PolygonalCopy(blob, tess->poly_wide_objects_better,
+                                      tess->poly_debug);
   TBOX box = tblob->bounding_box();
   FCOORD current_rotation(1.0f, 0.0f);
   FCOORD rotation90(0.0f, 1.0f);
@@ -366,6 +400,143 @@ bool os_detect_blob(BLOBNBOX* bbox, OrientationDetector* o,
   return stop;
 }
 
+// Rotates the char-normalized features by 90 degrees anti-clockwise about
+// the centre of the feature space, which is where ExtractIntFeat puts the
+// centroid of the blob.
+static void rotate_cn_features90(int num_features,
+                                 INT_FEATURE_STRUCT* features) {
+  for (int f = 0; f < num_features; ++f) {
+    INT_FEATURE_STRUCT* feature = features + f;
+    uinT8 x = feature->X;
+    feature->X = ClipToRange(256 - feature->Y, 0, MAX_UINT8);
+    feature->Y = x;
+    feature->Theta += INT_CHAR_NORM_RANGE / 4;
+  }
+}
+
+// Classifies the blob in each of the 4 orientations, as os_detect_blob does,
+// but the features are extracted once, in the upright orientation, and the
+// other 3 orientations are derived by rotating the features and adjusting
+// the char-norm parameters to the scaling that os_detect_blob would have used.
+// Only the class pruner is run, so the ratings are coarser than those of the
+// AdaptiveClassifier. Returns false if the blob has no usable features.
+static bool classify_blob_rotations(BLOBNBOX* bbox,
+                                    tesseract::Tesseract* tess,
+                                    BLOB_CHOICE_LIST* ratings) {
+  TBLOB* tblob = TBLOB::PolygonalCopy(bbox->cblob(),
+                                      tess->poly_wide_objects_better,
+                                      tess->poly_debug);
+  TBOX box = tblob->bounding_box();
+  if (box.width() == 0 || box.height() == 0) {
+    delete tblob;
+    return false;
+  }
+  float scaling = static_cast<float>(kBlnXHeight) / box.height();
+  float x_origin = (box.left() + box.right()) / 2.0f;
+  DENORM denorm;
+  denorm.SetupNormalization(NULL, NULL, NULL, NULL, NULL, 0,
+                            x_origin, box.bottom(), scaling, scaling,
+                            0.0f, static_cast<float>(kBlnBaselineOffset));
+  tblob->Normalize(denorm);
+  INT_FEATURE_ARRAY bl_features;
+  INT_FEATURE_ARRAY cn_features;
+  INT_FX_RESULT_STRUCT fx_info;
+  bool extracted = ExtractIntFeat(tblob, denorm, bl_features, cn_features,
+                                  &fx_info, tess->GetRadiusLimits(), NULL) &&
+                   fx_info.NumCN > 0;
+  delete tblob;
+  if (!extracted)
+    return false;
+
+  // Centroid of the blob in image coordinates.
+  float x_centroid = x_origin + fx_info.Xmean / scaling;
+  float y_centroid = box.bottom() +
+      (fx_info.Ymean - kBlnBaselineOffset) / scaling;
+  inT32 geo_features[GeoCount];
+  for (int g = 0; g < GeoCount; ++g)
+    geo_features[g] = 0;
+  const tesseract::ShapeTable* shape_table = tess->shape_table();
+  GenericVector<tesseract::ShapeRating> results;
+  for (int i = 0; i < 4; ++i) {
+    if (i > 0)
+      rotate_cn_features90(fx_info.NumCN, cn_features);
+    // Distance from the centroid to the edge of the box that is the bottom
+    // after rotation, and the scaling that makes the rotated height the
+    // x-height.
+    float centroid_height;
+    float rotated_scaling = scaling;
+    switch (i) {
+      case 0:
+        centroid_height = y_centroid - box.bottom();
+        break;
+      case 1:
+        centroid_height = x_centroid - box.left();
+        rotated_scaling = static_cast<float>(kBlnXHeight) / box.width();
+        break;
+      case 2:
+        centroid_height = box.top() - y_centroid;
+        break;
+      default:
+        centroid_height = box.right() - x_centroid;
+        rotated_scaling = static_cast<float>(kBlnXHeight) / box.width();
+        break;
+    }
+    float scale_ratio = rotated_scaling / scaling;
+    // The radii of gyration swap over in the odd orientations.
+    float rx = i % 2 == 0 ? fx_info.Rx : fx_info.Ry;
+    float ry = i % 2 == 0 ? fx_info.Ry : fx_info.Rx;
+    float cn_params[tesseract::kNumCNParams];
+    cn_params[CharNormY] = MF_SCALE_FACTOR *
+        (kBlnBaselineOffset + centroid_height * rotated_scaling -
+         BASELINE_OFFSET);
+    cn_params[CharNormLength] =
+        MF_SCALE_FACTOR * fx_info.Length * scale_ratio / LENGTH_COMPRESSION;
+    cn_params[CharNormRx] = MF_SCALE_FACTOR * rx * scale_ratio;
+    cn_params[CharNormRy] = MF_SCALE_FACTOR * ry * scale_ratio;
+    tesseract::TrainingSample sample;
+    sample.SetUnownedFeatures(fx_info.NumCN, cn_features, 0, NULL,
+                              cn_params, geo_features);
+    tess->CharNormTrainingSample(true, sample, &results);
+
+    BLOB_CHOICE_IT choice_it(ratings + i);
+    for (int r = 0; r < results.size(); ++r) {
+      int unichar_id = results[r].shape_id;
+      int fontinfo_id = -1;
+      if (shape_table != NULL) {
+        const tesseract::UnicharAndFonts& entry =
+            shape_table->GetShape(results[r].shape_id)[0];
+        unichar_id = entry.unichar_id;
+        if (!entry.font_ids.empty())
+          fontinfo_id = entry.font_ids[0];
+      }
+      // The pruner rating is in [0,1], with 1 best. Map it onto the
+      // [-20,0] certainty range of the AdaptiveClassifier.
+      float rating = results[r].rating;
+      choice_it.add_to_end(new BLOB_CHOICE(
+          unichar_id, 1.0f - rating, -20.0f * (1.0f - rating), fontinfo_id,
+          -1, tess->unicharset.get_script(unichar_id), 0, MAX_INT16, false));
+    }
+  }
+  return true;
+}
+
+// As os_detect_blob, but with classify_blob_rotations in place of the 4
+// normalizations and AdaptiveClassifier calls. Instead of the ratio test of
+// OrientationDetector::detect_blob, the stopping criterion is a sequential
+// test on the accumulated orientation scores, which lets clear pages stop
+// after a few blobs.
+bool os_detect_blob_fast(BLOBNBOX* bbox, OrientationDetector* o,
+                         ScriptDetector* s, OSResults* osr,
+                         tesseract::Tesseract* tess) {
+  BLOB_CHOICE_LIST ratings[4];
+  if (!classify_blob_rotations(bbox, tess, ratings))
+    return false;
+  o->detect_blob(ratings);
+  s->detect_blob(ratings);
+  int orientation = o->get_orientation();
+  return osr->orientation_is_certain(kFastOrientationMargin) &&
+      s->must_stop(orientation);
+}
 
 OrientationDetector::OrientationDetector(OSResults* osr) {
   osr_ = osr;
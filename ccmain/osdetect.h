@@ -62,6 +62,11 @@ struct OSResults {
   int get_best_script(int orientation_id) const;
   // Accumulate scores with given OSResults instance and update the best script.
   void accumulate(const OSResults& osr);
+  // Sequential test on the accumulated orientation scores: returns true if
+  // the best orientation leads the runner-up by at least the given margin.
+  // As the scores are sums of per-blob log probabilities, the margin is the
+  // log of the likelihood ratio between the two orientations.
+  bool orientation_is_certain(float margin) const;
 
   // Print statistics.
   void print_scores(void) const;
@@ -118,14 +123,23 @@ int os_detect(TO_BLOCK_LIST* port_blocks,
               OSResults* osr,
               tesseract::Tesseract* tess);
 
+// If fast is true, uses os_detect_blob_fast instead of os_detect_blob, and
+// stops as soon as the orientation is certain.
 int os_detect_blobs(BLOBNBOX_CLIST* blob_list,
                     OSResults* osr,
-                    tesseract::Tesseract* tess);
+                    tesseract::Tesseract* tess,
+                    bool fast = false);
 
 bool os_detect_blob(BLOBNBOX* bbox, OrientationDetector* o,
                     ScriptDetector* s, OSResults*,
                     tesseract::Tesseract* tess);
 
+// As os_detect_blob, but extracts the features only once and rotates them in
+// feature space, and classifies with the class pruner only.
+bool os_detect_blob_fast(BLOBNBOX* bbox, OrientationDetector* o,
+                         ScriptDetector* s, OSResults*,
+                         tesseract::Tesseract* tess);
+
 // Helper method to convert an orientation index to its value in degrees.
 // The value represents the amount of clockwise rotation in degrees that must be
 // applied for the text to be upright (readable).
@@ -58,6 +58,8 @@ const int kMinCredibleResolution = 70;
 const int kDefaultResolution = 300;
 // Max erosions to perform in removing an enclosing circle.
 const int kMaxCircleErosions = 8;
+// Min resolution of the reduced image used for line and image finding.
+const int kMinLayoutResolution = 150;
 
 // Helper to remove an enclosing circle from an image.
 // If there isn't one, then the image will most likely get badly mangled.
@@ -99,6 +101,80 @@ static Pix* RemoveEnclosingCircle(Pix* pixs) {
   return pixout;
 }
 
+// Returns the factor by which to reduce the image for line and image finding:
+// the largest of 1, 2 and 4 that does not exceed max_reduction and keeps the
+// reduced resolution at least kMinLayoutResolution.
+static int LayoutReduction(int max_reduction, int resolution) {
+  int reduction = 1;
+  while (reduction * 2 <= max_reduction && reduction < 4 &&
+         resolution / (reduction * 2) >= kMinLayoutResolution)
+    reduction *= 2;
+  return reduction;
+}
+
+// Expands a mask made on an image reduced by the given factor back up to the
+// size of full_pix. The result must be pixDestroyed after use.
+static Pix* ExpandReducedMask(Pix* mask, int reduction, Pix* full_pix) {
+  Pix* expanded = pixExpandReplicate(mask, reduction);
+  // The reduction rounds down, so the expansion may be a little smaller.
+  Pix* result = pixCreate(pixGetWidth(full_pix), pixGetHeight(full_pix), 1);
+  pixOr(result, result, expanded);
+  pixDestroy(&expanded);
+  return result;
+}
+
+// Equivalent of LineFinder::FindAndRemoveLines followed by
+// ImageFind::FindImages on pix, but with both run on a copy of pix reduced
+// by the given factor, which is much cheaper on high resolution images.
+// The reduction keeps any pixel that is on in its cell, so thin lines
+// survive it. The lines are then removed from pix by expanding the mask of
+// the pixels that line finding removed from the reduced image, and the
+// vectors, photo mask and music mask are scaled back up to full resolution.
+static void FindLinesAndImagesReduced(const Textord* textord,
+                                      int reduction, int resolution,
+                                      bool debug, Pix* pix,
+                                      int* vertical_x, int* vertical_y,
+                                      Pix** music_mask_pix,
+                                      Pix** photo_mask_pix,
+                                      TabVector_LIST* v_lines,
+                                      TabVector_LIST* h_lines) {
+  Pix* reduced = pixReduceRankBinaryCascade(pix, 1, reduction > 2 ? 1 : 0,
+                                            0, 0);
+  Pix* removed = pixCopy(NULL, reduced);
+  LineFinder::FindAndRemoveLines(textord, resolution / reduction, debug,
+                                 reduced, vertical_x, vertical_y,
+                                 music_mask_pix,
+                                 v_lines, h_lines);
+  // Line finding only ever clears pixels, so this leaves just the ones it
+  // removed.
+  pixXor(removed, removed, reduced);
+  Pix* full_removed = ExpandReducedMask(removed, reduction, pix);
+  pixDestroy(&removed);
+  pixSubtract(pix, pix, full_removed);
+  pixDestroy(&full_removed);
+  if (music_mask_pix != NULL && *music_mask_pix != NULL) {
+    Pix* full_music = ExpandReducedMask(*music_mask_pix, reduction, pix);
+    pixDestroy(music_mask_pix);
+    *music_mask_pix = full_music;
+  }
+  TabVector_IT v_it(v_lines);
+  for (v_it.mark_cycle_pt(); !v_it.cycled_list(); v_it.forward())
+    v_it.data()->ScaleUp(reduction);
+  TabVector_IT h_it(h_lines);
+  for (h_it.mark_cycle_pt(); !h_it.cycled_list(); h_it.forward())
+    h_it.data()->ScaleUp(reduction);
+
+  Pix* reduced_photo_mask = ImageFind::FindImages(reduced);
+  pixDestroy(&reduced);
+  *photo_mask_pix = ExpandReducedMask(reduced_photo_mask, reduction, pix);
+  pixDestroy(&reduced_photo_mask);
+  // As in FindImages, fill to capture pixels near the mask edges that the
+  // reduction missed.
+  Pix* filled = pixSeedfillBinary(NULL, *photo_mask_pix, pix, 8);
+  pixOr(*photo_mask_pix, *photo_mask_pix, filled);
+  pixDestroy(&filled);
+}
+
 /**
  * Segment the page according to the current value of tessedit_pageseg_mode.
  * pix_binary_ is used as the source image and should not be NULL.
@@ -226,10 +302,18 @@ int Tesseract::AutoPageSeg(bool single_column, bool osd, bool only_osd,
   // The blocks made by the ColumnFinder. Moved to blocks before return.
   BLOCK_LIST found_blocks;
   TO_BLOCK_LIST temp_blocks;
+  page_fingerprint_ = LayoutFingerprint();
+  page_layout_from_template_ = false;
 
   ColumnFinder* finder = SetupPageSegAndDetectOrientation(
       single_column, osd, only_osd, blocks, osd_tess, osr,
       &temp_blocks, &photomask_pix, &musicmask_pix);
+  if (page_layout_from_template_) {
+    // The blocks are already made, and Textord will find their blobs.
+    pixDestroy(&photomask_pix);
+    pixDestroy(&musicmask_pix);
+    return 0;
+  }
   if (finder != NULL) {
     TO_BLOCK_IT to_block_it(&temp_blocks);
     TO_BLOCK* to_block = to_block_it.data();
@@ -249,7 +333,13 @@ int Tesseract::AutoPageSeg(bool single_column, bool osd, bool only_osd,
       return -1;
     }
     finder->GetDeskewVectors(&deskew_, &reskew_);
+    if (textord_tabfind_find_tables) {
+      ++stats_.table_detect_pages;
+      if (finder->table_detection_skipped())
+        ++stats_.table_detect_skipped;
+    }
     delete finder;
+    LearnLayoutTemplate(&found_blocks);
   }
   pixDestroy(&photomask_pix);
   pixDestroy(&musicmask_pix);
@@ -292,17 +382,33 @@ ColumnFinder* Tesseract::SetupPageSegAndDetectOrientation(
   if (tessedit_dump_pageseg_images) {
     pixWrite("tessinput.png", pix_binary_, IFF_PNG);
   }
-  // Leptonica is used to find the rule/separator lines in the input.
-  LineFinder::FindAndRemoveLines(source_resolution_,
-                                 textord_tabfind_show_vlines, pix_binary_,
-                                 &vertical_x, &vertical_y, music_mask_pix,
-                                 &v_lines, &h_lines);
-  if (tessedit_dump_pageseg_images)
-    pixWrite("tessnolines.png", pix_binary_, IFF_PNG);
-  // Leptonica is used to find a mask of the photo regions in the input.
-  *photo_mask_pix = ImageFind::FindImages(pix_binary_);
-  if (tessedit_dump_pageseg_images)
-    pixWrite("tessnoimages.png", pix_binary_, IFF_PNG);
+  int reduction = LayoutReduction(textord_layout_reduction,
+                                  source_resolution_);
+  if (reduction > 1) {
+    // Find the lines and photo regions on a reduced image.
+    FindLinesAndImagesReduced(&textord_, reduction, source_resolution_,
+                              textord_tabfind_show_vlines, pix_binary_,
+                              &vertical_x, &vertical_y, music_mask_pix,
+                              photo_mask_pix, &v_lines, &h_lines);
+    if (tessedit_dump_pageseg_images) {
+      pixWrite("tessnolines.png", pix_binary_, IFF_PNG);
+      pixWrite("tessnoimages.png", pix_binary_, IFF_PNG);
+    }
+  } else {
+    // Leptonica is used to find the rule/separator lines in the input.
+    LineFinder::FindAndRemoveLines(&textord_, source_resolution_,
+                                   textord_tabfind_show_vlines, pix_binary_,
+                                   &vertical_x, &vertical_y, music_mask_pix,
+                                   &v_lines, &h_lines);
+    if (tessedit_dump_pageseg_images)
+      pixWrite("tessnolines.png", pix_binary_, IFF_PNG);
+    // Leptonica is used to find a mask of the photo regions in the input.
+    *photo_mask_pix = ImageFind::FindImages(pix_binary_);
+    if (tessedit_dump_pageseg_images)
+      pixWrite("tessnoimages.png", pix_binary_, IFF_PNG);
+  }
+  if (!osd && MatchLayoutTemplate(&v_lines, &h_lines, blocks))
+    return NULL;
   if (single_column)
     v_lines.clear();
 
@@ -321,7 +427,11 @@ ColumnFinder* Tesseract::SetupPageSegAndDetectOrientation(
     finder = new ColumnFinder(static_cast<int>(to_block->line_size),
                               blkbox.botleft(), blkbox.topright(),
                               source_resolution_,
+                              textord_tabfind_aligned_gap_fraction,
                               &v_lines, &h_lines, vertical_x, vertical_y);
+    finder->SetTableDetection(textord_tabfind_find_tables,
+                              textord_tablefind_recognize_tables);
+    finder->set_only_strokewidths(textord_tabfind_only_strokewidths);
 
     finder->SetupAndFilterNoise(*photo_mask_pix, to_block);
 
@@ -335,9 +445,14 @@ ColumnFinder* Tesseract::SetupPageSegAndDetectOrientation(
     // We want the text lines horizontal, (vertical text indicates vertical
     // textlines) which may conflict (eg vertically written CJK).
     int osd_orientation = 0;
-    bool vertical_text = finder->IsVerticallyAlignedText(to_block, &osd_blobs);
+    bool vertical_text = textord_tabfind_force_vertical_text;
+    if (!vertical_text && textord_tabfind_vertical_text) {
+      vertical_text = finder->IsVerticallyAlignedText(
+          textord_tabfind_vertical_text_ratio, to_block, &osd_blobs);
+    }
     if (osd && osd_tess != NULL && osr != NULL) {
-      os_detect_blobs(&osd_blobs, osr, osd_tess);
+      os_detect_blobs(&osd_blobs, osr, osd_tess,
+                      osd_tess->tessedit_osd_fast);
       if (only_osd) {
         delete finder;
         return NULL;
@@ -377,4 +492,63 @@ ColumnFinder* Tesseract::SetupPageSegAndDetectOrientation(
   return finder;
 }
 
+/**
+ * Fingerprints the page from the lines found on it, and if the fingerprint
+ * matches a page in tessedit_layout_templates, replaces blocks with the
+ * blocks of the stored layout, shifted to fit the page, and returns true.
+ * Textord then finds the blobs in each block, skipping column finding.
+ * Pages of the same form have the same ruled lines, so this is for
+ * batches of forms, where column finding would be repeated for nothing.
+ */
+bool Tesseract::MatchLayoutTemplate(TabVector_LIST* v_lines,
+                                    TabVector_LIST* h_lines,
+                                    BLOCK_LIST* blocks) {
+  const char* filename = tessedit_layout_templates.string();
+  if (filename[0] == '\0')
+    return false;
+  if (layout_templates_ == NULL || layout_templates_file_ != filename) {
+    delete layout_templates_;
+    layout_templates_ = new LayoutTemplateCache;
+    layout_templates_file_ = filename;
+    // A missing file is fine if we are going to learn it.
+    if (!layout_templates_->Load(filename) && !tessedit_layout_learn)
+      tprintf("Can't read layout templates from %s\n", filename);
+  }
+  page_fingerprint_.Set(pixGetWidth(pix_binary_), pixGetHeight(pix_binary_),
+                        source_resolution_,
+                        static_cast<int>(tessedit_pageseg_mode),
+                        v_lines, h_lines);
+  ICOORD offset;
+  const LayoutTemplate* layout =
+      layout_templates_->FindMatch(page_fingerprint_, &offset);
+  if (layout == NULL)
+    return false;
+  if (textord_debug_tabfind)
+    tprintf("Using layout template, offset (%d,%d)\n", offset.x(), offset.y());
+  blocks->clear();
+  layout->MakeBlocks(offset, blocks);
+  deskew_ = layout->deskew();
+  reskew_ = layout->reskew();
+  page_layout_from_template_ = true;
+  return true;
+}
+
+/**
+ * If tessedit_layout_learn is on, adds the given blocks made by layout
+ * analysis to the layout templates, with the fingerprint of the current
+ * page, and writes the templates back to tessedit_layout_templates.
+ */
+void Tesseract::LearnLayoutTemplate(BLOCK_LIST* blocks) {
+  if (!tessedit_layout_learn || layout_templates_ == NULL ||
+      !page_fingerprint_.IsDistinctive())
+    return;
+  LayoutTemplate* layout = new LayoutTemplate;
+  if (!layout->Set(page_fingerprint_, blocks, deskew_, reskew_)) {
+    delete layout;
+    return;
+  }
+  layout_templates_->Add(layout);
+  layout_templates_->Save(layout_templates_file_.string());
+}
+
 }  // namespace tesseract.
@@ -1259,7 +1259,7 @@ ParagraphModelSmearer::ParagraphModelSmearer(
     GenericVector<RowScratchRegisters> *rows,
     int row_start, int row_end, ParagraphTheory *theory)
         : theory_(theory), rows_(rows), row_start_(row_start),
-          row_end_(row_end) {
+          row_end_(row_end), open_models_complete_(false) {
   if (!AcceptableRowArgs(0, 0, __func__, rows, row_start, row_end)) {
     row_start_ = 0;
     row_end_ = 0;
@@ -1273,20 +1273,17 @@ ParagraphModelSmearer::ParagraphModelSmearer(
 
 // see paragraphs_internal.h
 void ParagraphModelSmearer::CalculateOpenModels(int row_start, int row_end) {
-  SetOfModels no_models;
   if (row_start < row_start_) row_start = row_start_;
   if (row_end > row_end_) row_end = row_end_;
 
   for (int row = (row_start > 0) ? row_start - 1 : row_start; row < row_end;
        row++) {
-    if ((*rows_)[row].ri_->num_words == 0) {
-      OpenModels(row + 1) = no_models;
-    } else {
+    SetOfModels still_open;
+    if ((*rows_)[row].ri_->num_words != 0) {
       SetOfModels &opened = OpenModels(row);
       (*rows_)[row].StartHypotheses(&opened);
 
       // Which models survive the transition from row to row + 1?
-      SetOfModels still_open;
       for (int m = 0; m < opened.size(); m++) {
         if (ValidFirstLine(rows_, row, opened[m]) ||
             ValidBodyLine(rows_, row, opened[m])) {
@@ -1296,9 +1293,24 @@ void ParagraphModelSmearer::CalculateOpenModels(int row_start, int row_end) {
           still_open.push_back_new(opened[m]);
         }
       }
-      OpenModels(row + 1) = still_open;
     }
+    if (open_models_complete_ && row + 1 < row_end) {
+      // OpenModels(row + 1) will have the start hypotheses of row + 1 added
+      // to it on the next iteration, so compare with that.
+      SetOfModels next_opened = still_open;
+      if ((*rows_)[row + 1].ri_->num_words != 0)
+        (*rows_)[row + 1].StartHypotheses(&next_opened);
+      const SetOfModels &stored = OpenModels(row + 1);
+      bool unchanged = next_opened.size() == stored.size();
+      for (int m = 0; unchanged && m < stored.size(); ++m)
+        unchanged = next_opened[m] == stored[m];
+      if (unchanged)
+        return;
+    }
+    OpenModels(row + 1) = still_open;
   }
+  if (row_start == row_start_ && row_end == row_end_)
+    open_models_complete_ = true;
 }
 
 // see paragraphs_internal.h
@@ -1631,45 +1643,76 @@ bool LikelyParagraphStart(const RowScratchRegisters &before,
        TextSupportsBreak(before, after));
 }
 
-// Examine rows[start, end) and try to determine what sort of ParagraphModel
-// would fit them as a single paragraph.
-// If we can't produce a unique model justification_ = JUSTIFICATION_UNKNOWN.
-// If the rows given could be a consistent start to a paragraph, set *consistent
-// true.
-ParagraphModel InternalParagraphModelByOutline(
-    const GenericVector<RowScratchRegisters> *rows,
-    int start, int end, int tolerance, bool *consistent) {
-  int ltr_line_count = 0;
-  for (int i = start; i < end; i++) {
-    ltr_line_count += static_cast<int>((*rows)[i].ri_->ltr);
+// The summary of the geometry of rows[start, end) that is needed to find the
+// ParagraphModel that fits them. It can be extended by a row at a time, so
+// that growing a run of rows costs a constant amount of work per row instead
+// of a pass over the whole run.
+class ParagraphOutline {
+ public:
+  ParagraphOutline(const GenericVector<RowScratchRegisters> *rows, int start)
+    : rows_(rows), start_(start), end_(start + 1),
+      ltr_line_count_(static_cast<int>((*rows)[start].ri_->ltr)),
+      margins_match_(true),
+      lmin_(0), lmax_(0), rmin_(0), rmax_(0), cmin_(0), cmax_(0) {
   }
-  bool ltr = (ltr_line_count >= (end - start) / 2);
+
+  int end() const { return end_; }
+
+  // Adds rows[end()] to the outline.
+  void Extend() {
+    const RowScratchRegisters &row = (*rows_)[end_];
+    ltr_line_count_ += static_cast<int>(row.ri_->ltr);
+    if (row.lmargin_ != (*rows_)[start_].lmargin_ ||
+        row.rmargin_ != (*rows_)[start_].rmargin_)
+      margins_match_ = false;
+    if (end_ == start_ + 1) {
+      lmin_ = lmax_ = row.lindent_;
+      rmin_ = rmax_ = row.rindent_;
+    }
+    UpdateRange(row.lindent_, &lmin_, &lmax_);
+    UpdateRange(row.rindent_, &rmin_, &rmax_);
+    UpdateRange(row.rindent_ - row.lindent_, &cmin_, &cmax_);
+    ++end_;
+  }
+
+  // Returns the model for rows[start, end()), as documented at
+  // InternalParagraphModelByOutline.
+  ParagraphModel Model(int tolerance, bool *consistent) const;
+
+ private:
+  const GenericVector<RowScratchRegisters> *rows_;
+  int start_;
+  int end_;
+  int ltr_line_count_;
+  // False if the margins of any body row differ from the first row.
+  bool margins_match_;
+  // Ranges of the body row indents, and of their difference.
+  int lmin_, lmax_, rmin_, rmax_, cmin_, cmax_;
+};
+
+ParagraphModel ParagraphOutline::Model(int tolerance, bool *consistent) const {
+  int start = start_;
+  int end = end_;
+  bool ltr = (ltr_line_count_ >= (end - start) / 2);
 
   *consistent = true;
-  if (!AcceptableRowArgs(0, 2, __func__, rows, start, end))
+  if (!AcceptableRowArgs(0, 2, "InternalParagraphModelByOutline", rows_,
+                         start, end))
     return ParagraphModel();
 
   // Ensure the caller only passed us a region with a common rmargin and
   // lmargin.
-  int lmargin = (*rows)[start].lmargin_;
-  int rmargin = (*rows)[start].rmargin_;
-  int lmin, lmax, rmin, rmax, cmin, cmax;
-  lmin = lmax = (*rows)[start + 1].lindent_;
-  rmin = rmax = (*rows)[start + 1].rindent_;
-  cmin = cmax = 0;
-  for (int i = start + 1; i < end; i++) {
-    if ((*rows)[i].lmargin_ != lmargin || (*rows)[i].rmargin_ != rmargin) {
-      tprintf("Margins don't match! Software error.\n");
-      *consistent = false;
-      return ParagraphModel();
-    }
-    UpdateRange((*rows)[i].lindent_, &lmin, &lmax);
-    UpdateRange((*rows)[i].rindent_, &rmin, &rmax);
-    UpdateRange((*rows)[i].rindent_ - (*rows)[i].lindent_, &cmin, &cmax);
+  if (!margins_match_) {
+    tprintf("Margins don't match! Software error.\n");
+    *consistent = false;
+    return ParagraphModel();
   }
+  int lmargin = (*rows_)[start].lmargin_;
+  int rmargin = (*rows_)[start].rmargin_;
+  int lmin = lmin_, lmax = lmax_, rmin = rmin_, rmax = rmax_;
   int ldiff = lmax - lmin;
   int rdiff = rmax - rmin;
-  int cdiff = cmax - cmin;
+  int cdiff = cmax_ - cmin_;
   if (rdiff > tolerance && ldiff > tolerance) {
     if (cdiff < tolerance * 2) {
       if (end - start < 3)
@@ -1688,10 +1731,10 @@ ParagraphModel InternalParagraphModelByOutline(
   bool body_admits_right_alignment = rdiff < tolerance;
 
   ParagraphModel left_model =
-      ParagraphModel(JUSTIFICATION_LEFT, lmargin, (*rows)[start].lindent_,
+      ParagraphModel(JUSTIFICATION_LEFT, lmargin, (*rows_)[start].lindent_,
                      (lmin + lmax) / 2, tolerance);
   ParagraphModel right_model =
-      ParagraphModel(JUSTIFICATION_RIGHT, rmargin, (*rows)[start].rindent_,
+      ParagraphModel(JUSTIFICATION_RIGHT, rmargin, (*rows_)[start].rindent_,
                      (rmin + rmax) / 2, tolerance);
 
   // These booleans keep us from having an indent on the "wrong side" for the
@@ -1719,8 +1762,8 @@ ParagraphModel InternalParagraphModelByOutline(
 
   // If the first line juts out oddly in one direction or the other,
   // that likely indicates the side aligned to.
-  int first_left = (*rows)[start].lindent_;
-  int first_right = (*rows)[start].rindent_;
+  int first_left = (*rows_)[start].lindent_;
+  int first_right = (*rows_)[start].rindent_;
 
   if (ltr && body_admits_left_alignment &&
       (first_left < lmin || first_left > lmax))
@@ -1733,6 +1776,24 @@ ParagraphModel InternalParagraphModelByOutline(
   return ParagraphModel();
 }
 
+// Examine rows[start, end) and try to determine what sort of ParagraphModel
+// would fit them as a single paragraph.
+// If we can't produce a unique model justification_ = JUSTIFICATION_UNKNOWN.
+// If the rows given could be a consistent start to a paragraph, set *consistent
+// true.
+ParagraphModel InternalParagraphModelByOutline(
+    const GenericVector<RowScratchRegisters> *rows,
+    int start, int end, int tolerance, bool *consistent) {
+  if (!AcceptableRowArgs(0, 2, __func__, rows, start, end)) {
+    *consistent = true;
+    return ParagraphModel();
+  }
+  ParagraphOutline outline(rows, start);
+  while (outline.end() < end)
+    outline.Extend();
+  return outline.Model(tolerance, consistent);
+}
+
 // Examine rows[start, end) and try to determine what sort of ParagraphModel
 // would fit them as a single paragraph.   If nothing fits,
 // justification_ = JUSTIFICATION_UNKNOWN and print the paragraph to debug
@@ -1863,6 +1924,8 @@ void ModelStrongEvidence(int debug_level,
     int end = start;
     ParagraphModel last_model;
     bool next_consistent;
+    // Outline of rows[start, end + 1), grown with end.
+    ParagraphOutline outline(rows, start);
     do {
       ++end;
       // rows[row, end) was consistent.
@@ -1878,8 +1941,9 @@ void ModelStrongEvidence(int debug_level,
         next_consistent = false;
       }
       if (next_consistent) {
-        ParagraphModel next_model = InternalParagraphModelByOutline(
-            rows, start, end + 1, tolerance, &next_consistent);
+        while (outline.end() < end + 1)
+          outline.Extend();
+        ParagraphModel next_model = outline.Model(tolerance, &next_consistent);
         if (((*rows)[start].ri_->ltr &&
              last_model.justification() == JUSTIFICATION_LEFT &&
              next_model.justification() != JUSTIFICATION_LEFT) ||
@@ -248,6 +248,9 @@ class ParagraphModelSmearer {
   // A model is still open in a row if some previous row has said model as a
   // start hypothesis, and all rows since (including this row) would fit as
   // either a body or start line in that model.
+  // Once open_models_ is complete, a recalculation after a change to the
+  // hypotheses of row_start - 1 stops as soon as it reproduces the stored
+  // open models of a row, as those of all later rows must then be unchanged.
   void CalculateOpenModels(int row_start, int row_end);
 
   SetOfModels &OpenModels(int row) {
@@ -268,6 +271,8 @@ class ParagraphModelSmearer {
   // TODO(eger): Think about whether we can get rid of "Open" models and just
   //   use the current hypotheses on RowScratchRegisters.
   GenericVector<SetOfModels> open_models_;
+  // True once open_models_ has been calculated for all rows.
+  bool open_models_complete_;
 };
 
 // Clear all hypotheses about lines [start, end) and reset the margins to the
@@ -726,6 +726,7 @@ BOOL8 Tesseract::word_bln_display(BLOCK* block, ROW* row, WERD_RES* word_res) {
   if (bln_word == NULL) {
     word_res->SetupForTessRecognition(unicharset, this, BestPix(), false,
                                       this->textord_use_cjk_fp_model,
+                                      poly_wide_objects_better, poly_debug,
                                       row, block);
     bln_word = word_res->chopped_word;
   }
@@ -833,7 +834,8 @@ BOOL8 Tesseract::word_display(BLOCK* block, ROW* row, WERD_RES* word_res) {
                                  // display poly approx
   if (word->display_flag(DF_POLYGONAL)) {
                                  // need to convert
-    TWERD* tword = TWERD::PolygonalCopy(word);
+    TWERD* tword = TWERD::PolygonalCopy(word, poly_wide_objects_better,
+                                        poly_debug);
     tword->plot(image_win);
     delete tword;
     displayed_something = TRUE;
@@ -75,6 +75,11 @@ Tesseract::Tesseract()
               tesseract::ShiroRekhaSplitter::NO_SPLIT,
               "Whether to use the top-line splitting process for Devanagari "
               "documents while performing ocr.", this->params()),
+    INT_MEMBER(devanagari_split_debuglevel, 0,
+               "Debug level for split shiro-rekha process.", this->params()),
+    BOOL_MEMBER(devanagari_split_debugimage, 0,
+                "Whether to create a debug image for split shiro-rekha "
+                "process.", this->params()),
     STRING_MEMBER(tessedit_write_params_to_file, "",
                   "Write all parameters to the given file.", this->params()),
     BOOL_MEMBER(tessedit_adapt_to_char_fragments, true,
@@ -377,6 +382,57 @@ Tesseract::Tesseract()
                      "for layout analysis.", this->params()),
     BOOL_MEMBER(textord_equation_detect, false, "Turn on equation detector",
                 this->params()),
+    BOOL_MEMBER(tessedit_osd_fast, false, "Use the fast, pruner-only"
+                " orientation and script detection", this->params()),
+    INT_MEMBER(textord_layout_reduction, 1, "Max factor (1, 2 or 4) by"
+               " which to reduce the image for line and image finding in"
+               " layout analysis", this->params()),
+    BOOL_MEMBER(textord_tabfind_find_tables, true, "run table detection",
+                this->params()),
+    BOOL_MEMBER(textord_tablefind_recognize_tables, false, "Enables the"
+                " table recognizer for table layout and filtering.",
+                this->params()),
+    BOOL_MEMBER(textord_tabfind_only_strokewidths, false,
+                "Only run stroke widths", this->params()),
+    BOOL_MEMBER(textord_tabfind_vertical_text, true,
+                "Enable vertical detection", this->params()),
+    BOOL_MEMBER(textord_tabfind_force_vertical_text, false,
+                "Force using vertical text page mode", this->params()),
+    BOOL_MEMBER(textord_tabfind_vertical_horizontal_mix, true, "find"
+                " horizontal lines such as headers in vertical page mode",
+                this->params()),
+    double_MEMBER(textord_tabfind_vertical_text_ratio, 0.5, "Fraction of"
+                  " textlines deemed vertical to use vertical page mode",
+                  this->params()),
+    double_MEMBER(textord_tabfind_aligned_gap_fraction, 0.75, "Fraction of"
+                  " height used as a minimum gap for aligned blobs.",
+                  this->params()),
+    double_MEMBER(textord_tabvector_vertical_gap_fraction, 0.5, "max"
+                  " fraction of mean blob width allowed for vertical gaps in"
+                  " vertical text", this->params()),
+    double_MEMBER(textord_tabvector_vertical_box_ratio, 0.5, "Fraction of"
+                  " box matches required to declare a line vertical",
+                  this->params()),
+    BOOL_MEMBER(equationdetect_save_bi_image, false, "Save input bi image",
+                this->params()),
+    BOOL_MEMBER(equationdetect_save_spt_image, false,
+                "Save special character image", this->params()),
+    BOOL_MEMBER(equationdetect_save_seed_image, false, "Save the seed image",
+                this->params()),
+    BOOL_MEMBER(equationdetect_save_merged_image, false,
+                "Save the merged image", this->params()),
+    BOOL_MEMBER(equationdetect_prefilter, true, "Skip equation detection on"
+                " pages without math-shaped blobs", this->params()),
+    STRING_MEMBER(tessedit_layout_templates, "", "File of page layouts to"
+                  " reuse on pages with matching ruled lines", this->params()),
+    BOOL_MEMBER(tessedit_layout_learn, false, "Add the layouts of unmatched"
+                " pages to tessedit_layout_templates", this->params()),
+    BOOL_MEMBER(tessedit_page_arena, false, "Allocate the results of each"
+                " page from a pool that is freed in one go when the page is"
+                " cleared", this->params()),
+    BOOL_MEMBER(poly_debug, FALSE, "Debug old poly", this->params()),
+    BOOL_MEMBER(poly_wide_objects_better, TRUE,
+                "More accurate approx on wide things", this->params()),
     backup_config_file_(NULL),
     pix_binary_(NULL),
     cube_binary_(NULL),
@@ -392,7 +448,9 @@ Tesseract::Tesseract()
     font_table_size_(0),
     cube_cntxt_(NULL),
     tess_cube_combiner_(NULL),
-    equ_detect_(NULL) {
+    equ_detect_(NULL),
+    layout_templates_(NULL),
+    page_layout_from_template_(false) {
 }
 
 Tesseract::~Tesseract() {
@@ -408,6 +466,7 @@ Tesseract::~Tesseract() {
     delete tess_cube_combiner_;
     tess_cube_combiner_ = NULL;
   }
+  delete layout_templates_;
 }
 
 void Tesseract::Clear() {
@@ -482,6 +541,8 @@ void Tesseract::PrepareForPageseg() {
   // the newly splitted image.
   splitter_.set_orig_pix(pix_binary());
   splitter_.set_pageseg_split_strategy(max_pageseg_strategy);
+  splitter_.set_debug_level(devanagari_split_debuglevel);
+  splitter_.set_make_debug_image(devanagari_split_debugimage);
   if (splitter_.Split(true)) {
     ASSERT_HOST(splitter_.splitted_image());
     pixDestroy(&pix_binary_);
@@ -510,6 +571,8 @@ void Tesseract::PrepareForTessOCR(BLOCK_LIST* block_list,
   // Utilize the segmentation information available.
   splitter_.set_segmentation_block_list(block_list);
   splitter_.set_ocr_split_strategy(max_ocr_strategy);
+  splitter_.set_debug_level(devanagari_split_debuglevel);
+  splitter_.set_make_debug_image(devanagari_split_debugimage);
   // Run the splitter for OCR
   bool split_for_ocr = splitter_.Split(false);
   // Restore pix_binary to the binarized original pix for future reference.
@@ -524,7 +587,7 @@ void Tesseract::PrepareForTessOCR(BLOCK_LIST* block_list,
                 pixGetHeight(pix_binary_));
     Pix* pix_for_ocr = split_for_ocr ? splitter_.splitted_image() :
         splitter_.orig_pix();
-    extract_edges(pix_for_ocr, &block);
+    extract_edges(&textord_, pix_for_ocr, &block);
     splitter_.RefreshSegmentationWithNewBlobs(block.blob_list());
   }
   // The splitter isn't needed any more after this, so save memory by clearing.
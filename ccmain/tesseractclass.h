@@ -26,6 +26,7 @@
 #include "docqual.h"
 #include "devanagari_processing.h"
 #include "genericvector.h"
+#include "layouttemplate.h"
 #include "params.h"
 #include "ocrclass.h"
 #include "textord.h"
@@ -118,7 +119,9 @@ struct TesseractStats {
       tilde_crunch_written(false),
       last_char_was_newline(true),
       last_char_was_tilde(false),
-      write_results_empty_block(true) {}
+      write_results_empty_block(true),
+      table_detect_pages(0),
+      table_detect_skipped(0) {}
 
   inT32 adaption_word_number;
   inT16 doc_blob_quality;
@@ -134,6 +137,9 @@ struct TesseractStats {
   bool last_char_was_newline;
   bool last_char_was_tilde;
   bool write_results_empty_block;
+  // Pages given to table detection, and those it skipped for lack of tables.
+  inT32 table_detect_pages;
+  inT32 table_detect_skipped;
 };
 
 class Tesseract : public Wordrec {
@@ -206,6 +212,9 @@ class Tesseract : public Wordrec {
   const Textord& textord() const {
     return textord_;
   }
+  const TesseractStats& stats() const {
+    return stats_;
+  }
   Textord* mutable_textord() {
     return &textord_;
   }
@@ -246,6 +255,9 @@ class Tesseract : public Wordrec {
       bool single_column, bool osd, bool only_osd,
       BLOCK_LIST* blocks, Tesseract* osd_tess, OSResults* osr,
       TO_BLOCK_LIST* to_blocks, Pix** photo_mask_pix, Pix** music_mask_pix);
+  bool MatchLayoutTemplate(TabVector_LIST* v_lines, TabVector_LIST* h_lines,
+                           BLOCK_LIST* blocks);
+  void LearnLayoutTemplate(BLOCK_LIST* blocks);
 
   //// control.h /////////////////////////////////////////////////////////
   bool ProcessTargetWord(const TBOX& word_box, const TBOX& target_word_box,
@@ -682,6 +694,10 @@ class Tesseract : public Wordrec {
             tesseract::ShiroRekhaSplitter::NO_SPLIT,
             "Whether to use the top-line splitting process for Devanagari "
             "documents while performing ocr.");
+  INT_VAR_H(devanagari_split_debuglevel, 0,
+            "Debug level for split shiro-rekha process.");
+  BOOL_VAR_H(devanagari_split_debugimage, 0,
+             "Whether to create a debug image for split shiro-rekha process.");
   STRING_VAR_H(tessedit_write_params_to_file, "",
                "Write all parameters to the given file.");
   BOOL_VAR_H(tessedit_adapt_to_char_fragments, true,
@@ -898,6 +914,52 @@ class Tesseract : public Wordrec {
              "Only initialize with the config file. Useful if the instance is "
              "not going to be used for OCR but say only for layout analysis.");
   BOOL_VAR_H(textord_equation_detect, false, "Turn on equation detector");
+  BOOL_VAR_H(tessedit_osd_fast, false,
+             "Use the fast, pruner-only orientation and script detection");
+  INT_VAR_H(textord_layout_reduction, 1,
+            "Max factor (1, 2 or 4) by which to reduce the image for line"
+            " and image finding in layout analysis");
+  BOOL_VAR_H(textord_tabfind_find_tables, true, "run table detection");
+  BOOL_VAR_H(textord_tablefind_recognize_tables, false,
+             "Enables the table recognizer for table layout and filtering.");
+  BOOL_VAR_H(textord_tabfind_only_strokewidths, false,
+             "Only run stroke widths");
+  BOOL_VAR_H(textord_tabfind_vertical_text, true, "Enable vertical detection");
+  BOOL_VAR_H(textord_tabfind_force_vertical_text, false,
+             "Force using vertical text page mode");
+  BOOL_VAR_H(textord_tabfind_vertical_horizontal_mix, true,
+             "find horizontal lines such as headers in vertical page mode");
+  double_VAR_H(textord_tabfind_vertical_text_ratio, 0.5,
+               "Fraction of textlines deemed vertical to use vertical page "
+               "mode");
+  double_VAR_H(textord_tabfind_aligned_gap_fraction, 0.75,
+               "Fraction of height used as a minimum gap for aligned blobs.");
+  // For TabVector::VerticalTextlinePartner.
+  double_VAR_H(textord_tabvector_vertical_gap_fraction, 0.5,
+               "max fraction of mean blob width allowed for vertical gaps in "
+               "vertical text");
+  double_VAR_H(textord_tabvector_vertical_box_ratio, 0.5,
+               "Fraction of box matches required to declare a line vertical");
+  // For EquationDetect.
+  BOOL_VAR_H(equationdetect_save_bi_image, false, "Save input bi image");
+  BOOL_VAR_H(equationdetect_save_spt_image, false,
+             "Save special character image");
+  BOOL_VAR_H(equationdetect_save_seed_image, false, "Save the seed image");
+  BOOL_VAR_H(equationdetect_save_merged_image, false,
+             "Save the merged image");
+  BOOL_VAR_H(equationdetect_prefilter, true,
+             "Skip equation detection on pages without math-shaped blobs");
+  STRING_VAR_H(tessedit_layout_templates, "",
+               "File of page layouts to reuse on pages with matching"
+               " ruled lines");
+  BOOL_VAR_H(tessedit_layout_learn, false,
+             "Add the layouts of unmatched pages to tessedit_layout_templates");
+  BOOL_VAR_H(tessedit_page_arena, false,
+             "Allocate the results of each page from a pool that is freed"
+             " in one go when the page is cleared");
+  BOOL_VAR_H(poly_debug, FALSE, "Debug old poly");
+  BOOL_VAR_H(poly_wide_objects_better, TRUE,
+             "More accurate approx on wide things");
 
   //// ambigsrecog.cpp /////////////////////////////////////////////////////////
   FILE *init_recog_training(const STRING &fname);
@@ -954,6 +1016,14 @@ class Tesseract : public Wordrec {
   TesseractCubeCombiner *tess_cube_combiner_;
   // Equation detector. Note: this pointer is NOT owned by the class.
   EquationDetect* equ_detect_;
+  // Page layouts read from tessedit_layout_templates, loaded on first use.
+  LayoutTemplateCache* layout_templates_;
+  // The file that layout_templates_ was loaded from.
+  STRING layout_templates_file_;
+  // Fingerprint of the page currently in layout analysis.
+  LayoutFingerprint page_fingerprint_;
+  // True if the blocks of the current page came from a layout template.
+  bool page_layout_from_template_;
 };
 
 }  // namespace tesseract
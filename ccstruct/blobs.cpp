@@ -83,6 +83,13 @@ void TESSLINE::CopyFrom(const TESSLINE& src) {
     EDGEPT* prevpt = NULL;
     EDGEPT* newpt = NULL;
     EDGEPT* srcpt = src.loop;
+    // Keep the copy in one block, so walking it walks contiguous memory.
+    int num_pts = 0;
+    do {
+      ++num_pts;
+      srcpt = srcpt->next;
+    } while (srcpt != src.loop);
+    tesseract::PageArena::ReservePacked(num_pts * sizeof(EDGEPT));
     do {
       newpt = new EDGEPT(*srcpt);
       if (prevpt == NULL) {
@@ -115,11 +122,30 @@ void TESSLINE::Clear() {
 
 // Normalize in-place using the DENORM.
 void TESSLINE::Normalize(const DENORM& denorm) {
+  // The points are gathered into an array so the DENORM can transform them
+  // all in one call.
+  const int kMaxStackPoints = 256;
+  TPOINT stack_pts[kMaxStackPoints];
+  int num_pts = 0;
   EDGEPT* pt = loop;
   do {
-    denorm.LocalNormTransform(pt->pos, &pt->pos);
+    ++num_pts;
+    pt = pt->next;
+  } while (pt != loop);
+  TPOINT* pts = num_pts <= kMaxStackPoints ? stack_pts : new TPOINT[num_pts];
+  int i = 0;
+  do {
+    pts[i++] = pt->pos;
+    pt = pt->next;
+  } while (pt != loop);
+  denorm.LocalNormTransform(num_pts, pts, pts);
+  i = 0;
+  do {
+    pt->pos = pts[i++];
     pt = pt->next;
   } while (pt != loop);
+  if (pts != stack_pts)
+    delete [] pts;
   SetupFromPos();
 }
 
@@ -249,16 +275,19 @@ void TESSLINE::plot(ScrollView* window, ScrollView::Color color,
 // of the resulting list of TESSLINEs.
 static TESSLINE** ApproximateOutlineList(C_OUTLINE_LIST* outlines,
                                          bool children,
+                                         bool wide_objects_better, bool debug,
                                          TESSLINE** tail) {
   C_OUTLINE_IT ol_it(outlines);
   for (ol_it.mark_cycle_pt(); !ol_it.cycled_list(); ol_it.forward()) {
     C_OUTLINE* outline = ol_it.data();
-    TESSLINE* tessline = ApproximateOutline(outline);
+    TESSLINE* tessline = ApproximateOutline(outline, wide_objects_better,
+                                            debug);
     tessline->is_hole = children;
     *tail = tessline;
     tail = &tessline->next;
     if (!outline->child()->empty()) {
-      tail = ApproximateOutlineList(outline->child(), true, tail);
+      tail = ApproximateOutlineList(outline->child(), true,
+                                    wide_objects_better, debug, tail);
     }
   }
   return tail;
@@ -266,10 +295,12 @@ static TESSLINE** ApproximateOutlineList(C_OUTLINE_LIST* outlines,
 
 // Factory to build a TBLOB from a C_BLOB with polygonal
 // approximation along the way.
-TBLOB* TBLOB::PolygonalCopy(C_BLOB* src) {
+TBLOB* TBLOB::PolygonalCopy(C_BLOB* src, bool wide_objects_better,
+                            bool debug) {
   C_OUTLINE_IT ol_it = src->out_list();
   TBLOB* tblob = new TBLOB;
-  ApproximateOutlineList(src->out_list(), false, &tblob->outlines);
+  ApproximateOutlineList(src->out_list(), false, wide_objects_better, debug,
+                         &tblob->outlines);
   return tblob;
 }
 
@@ -402,14 +433,15 @@ void TBLOB::plot(ScrollView* window, ScrollView::Color color,
 
 // Factory to build a TWERD from a (C_BLOB) WERD, with polygonal
 // approximation along the way.
-TWERD* TWERD::PolygonalCopy(WERD* src) {
+TWERD* TWERD::PolygonalCopy(WERD* src, bool wide_objects_better,
+                            bool debug) {
   TWERD* tessword = new TWERD;
   tessword->latin_script = src->flag(W_SCRIPT_IS_LATIN);
   C_BLOB_IT b_it(src->cblob_list());
   TBLOB *tail = NULL;
   for (b_it.mark_cycle_pt(); !b_it.cycled_list(); b_it.forward()) {
     C_BLOB* blob = b_it.data();
-    TBLOB* tblob = TBLOB::PolygonalCopy(blob);
+    TBLOB* tblob = TBLOB::PolygonalCopy(blob, wide_objects_better, debug);
     if (tail == NULL) {
       tessword->blobs = tblob;
     } else {
@@ -30,6 +30,7 @@
               I n c l u d e s
 ----------------------------------------------------------------------*/
 #include "clst.h"
+#include "pagearena.h"
 #include "rect.h"
 #include "vecfuncs.h"
 
@@ -70,6 +71,10 @@ struct TPOINT {
 typedef TPOINT VECTOR;           // structure for coordinates.
 
 struct EDGEPT {
+  // The points of an outline are nearly always made together, so they are
+  // packed together in memory, in blocks from the page arena if there is one.
+  PAGE_ARENA_PACKED_OPERATORS
+
   EDGEPT() : next(NULL), prev(NULL) {
     memset(flags, 0, EDGEPTFLAGS * sizeof(flags[0]));
   }
@@ -111,6 +116,8 @@ struct EDGEPT {
 CLISTIZEH(EDGEPT);
 
 struct TESSLINE {
+  PAGE_ARENA_OPERATORS
+
   TESSLINE() : is_hole(false), loop(NULL), next(NULL) {}
   TESSLINE(const TESSLINE& src) : loop(NULL), next(NULL) {
     CopyFrom(src);
@@ -172,6 +179,8 @@ struct TESSLINE {
 };                               // Outline structure.
 
 struct TBLOB {
+  PAGE_ARENA_OPERATORS
+
   TBLOB() : outlines(NULL), next(NULL) {}
   TBLOB(const TBLOB& src) : outlines(NULL), next(NULL) {
     CopyFrom(src);
@@ -184,8 +193,10 @@ struct TBLOB {
     return *this;
   }
   // Factory to build a TBLOB from a C_BLOB with polygonal
-  // approximation along the way.
-  static TBLOB* PolygonalCopy(C_BLOB* src);
+  // approximation along the way. wide_objects_better and debug are passed
+  // on to ApproximateOutline.
+  static TBLOB* PolygonalCopy(C_BLOB* src, bool wide_objects_better,
+                              bool debug);
   // Normalizes the blob for classification only if needed.
   // (Normally this means a non-zero classify rotation.)
   // If no Normalization is needed, then NULL is returned, and the denorm is
@@ -243,8 +254,10 @@ struct TWERD {
     return *this;
   }
   // Factory to build a TWERD from a (C_BLOB) WERD, with polygonal
-  // approximation along the way.
-  static TWERD* PolygonalCopy(WERD* src);
+  // approximation along the way. wide_objects_better and debug are passed
+  // on to ApproximateOutline.
+  static TWERD* PolygonalCopy(WERD* src, bool wide_objects_better,
+                              bool debug);
   // Setup for Baseline normalization, recording the normalization in the
   // DENORM, but doesn't do any normalization.
   void SetupBLNormalize(const BLOCK* block, const ROW* row,
@@ -73,6 +73,16 @@ void LLSQ::add(const LLSQ& other) {
   sigxy += other.sigxy;
   sigyy += other.sigyy;
 }
+// Adds the sums over a set of elements, accumulated elsewhere.
+void LLSQ::add_sums(double weight, double sum_x, double sum_y,
+                    double sum_xx, double sum_xy, double sum_yy) {
+  total_weight += weight;
+  sigx += sum_x;                     // update accumulators
+  sigy += sum_y;
+  sigxx += sum_xx;
+  sigxy += sum_xy;
+  sigyy += sum_yy;
+}
 
 
 /**********************************************************************
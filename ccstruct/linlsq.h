@@ -36,6 +36,9 @@ class LLSQ {
   void add(double x, double y, double weight);
   // Adds a whole LLSQ.
   void add(const LLSQ& other);
+  // Adds the sums over a set of elements, accumulated elsewhere.
+  void add_sums(double weight, double sum_x, double sum_y,
+                double sum_xx, double sum_xy, double sum_yy);
   // Deletes an element with a weight of 1.
   void remove(double x, double y);
   inT32 count() const {  // no of elements
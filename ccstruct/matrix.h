@@ -25,6 +25,9 @@
 #ifndef TESSERACT_CCSTRUCT_MATRIX_H__
 #define TESSERACT_CCSTRUCT_MATRIX_H__
 
+#include "errcode.h"
+#include "helpers.h"
+#include "ndminx.h"
 #include "ratngs.h"
 #include "unicharset.h"
 
@@ -190,10 +193,100 @@ class GENERIC_MATRIX : public GENERIC_2D_ARRAY<T> {
   int dimension() const { return this->dim1(); }
 };
 
-class MATRIX : public GENERIC_MATRIX<BLOB_CHOICE_LIST *> {
+// A generic class to store the upper triangle of a square matrix with
+// entries of type T, of which only a band along the diagonal is stored:
+// entry (column, row) is held if column <= row < column + bandwidth.
+// All the other entries read as empty, and putting one of them widens the
+// band to take it. Used where the entries far from the diagonal are rarely
+// or never set, so the memory is dimension * bandwidth, not dimension^2.
+template <class T>
+class BandTriMatrix {
+ public:
+  // Allocate a piece of memory to hold the band of a matrix of the given
+  // dimension. Initialize all the elements to empty instead of assuming
+  // that a default constructor can be used.
+  BandTriMatrix(int dimension, int bandwidth, const T& empty)
+    : empty_(empty), dimension_(dimension),
+      bandwidth_(ClipToRange(bandwidth, 1, MAX(dimension, 1))) {
+    int size = dimension_ * bandwidth_;
+    array_ = new T[size];
+    for (int i = 0; i < size; ++i)
+      array_[i] = empty_;
+  }
+  ~BandTriMatrix() { delete[] array_; }
+
+  // Provide the dimension of this square matrix.
+  int dimension() const { return dimension_; }
+  // Provide the number of entries stored for each column.
+  int bandwidth() const { return bandwidth_; }
+
+  // Put an element into the matrix at a specific location, widening the
+  // band if it is outside.
+  void put(int column, int row, const T& thing) {
+    ASSERT_HOST(column >= 0 && column <= row && row < dimension_);
+    if (row - column >= bandwidth_)
+      IncreaseBandwidth(row - column + 1);
+    array_[index(column, row)] = thing;
+  }
+
+  // Get the item at a specified location from the matrix. Returns empty
+  // for anything outside the band.
+  T get(int column, int row) const {
+    if (row < column || row - column >= bandwidth_)
+      return empty_;
+    return array_[index(column, row)];
+  }
+
+  // Delete objects pointed to by the elements of the matrix.
+  void delete_matrix_pointers() {
+    int size = dimension_ * bandwidth_;
+    for (int i = 0; i < size; ++i) {
+      T matrix_cell = array_[i];
+      if (matrix_cell != empty_)
+        delete matrix_cell;
+    }
+  }
+
+ private:
+  // Each column is stored as a contiguous band starting at the diagonal.
+  int index(int column, int row) const {
+    return column * bandwidth_ + row - column;
+  }
+
+  // Widens the band to at least the given bandwidth. As the band grows to
+  // fit the widest entry put, it is at least doubled to keep the copying
+  // down.
+  void IncreaseBandwidth(int bandwidth) {
+    int new_bandwidth = MIN(MAX(bandwidth, 2 * bandwidth_), dimension_);
+    T* new_array = new T[dimension_ * new_bandwidth];
+    for (int column = 0; column < dimension_; ++column) {
+      T* src = array_ + column * bandwidth_;
+      T* dest = new_array + column * new_bandwidth;
+      for (int i = 0; i < bandwidth_; ++i)
+        dest[i] = src[i];
+      for (int i = bandwidth_; i < new_bandwidth; ++i)
+        dest[i] = empty_;
+    }
+    delete[] array_;
+    array_ = new_array;
+    bandwidth_ = new_bandwidth;
+  }
+
+  T* array_;
+  T empty_;         // The unused cell.
+  int dimension_;   // Size of the square matrix.
+  int bandwidth_;   // Number of entries stored for each column.
+};
+
+// The ratings matrix of a word, with an entry for each run of consecutive
+// chunks that has been classified. Column is the first chunk of the run and
+// row the last. Only runs no wider than a character are tried, so the
+// matrix is banded.
+class MATRIX : public BandTriMatrix<BLOB_CHOICE_LIST *> {
  public:
-  MATRIX(int dimension) : GENERIC_MATRIX<BLOB_CHOICE_LIST *>(dimension,
-                                                             NOT_CLASSIFIED) {}
+  MATRIX(int dimension, int bandwidth)
+    : BandTriMatrix<BLOB_CHOICE_LIST *>(dimension, bandwidth,
+                                        NOT_CLASSIFIED) {}
   // Print a shortened version of the contents of the matrix.
   void print(const UNICHARSET &unicharset) const;
 };
@@ -184,6 +184,60 @@ void DENORM::LocalNormTransform(const FCOORD& pt, FCOORD* transformed) const {
   transformed->set_y(translated.y() + final_yshift_);
 }
 
+// Transforms count points as LocalNormTransform does to each one, but
+// with the choice of y-origin and y-scale taken once for the whole array.
+// The arithmetic is done in the same order as the single point version so
+// that the results are identical.
+void DENORM::LocalNormTransform(int count, const TPOINT* pts,
+                                TPOINT* transformed) const {
+  float rot_x = 1.0f, rot_y = 0.0f;
+  if (rotation_ != NULL) {
+    rot_x = rotation_->x();
+    rot_y = rotation_->y();
+  }
+  if (num_segs_ == 0 && row_ == NULL) {
+    // The common case of a uniform transform has no lookups at all.
+    for (int i = 0; i < count; ++i) {
+      float x = (pts[i].x - x_origin_) * x_scale_;
+      float y = (pts[i].y - y_origin_) * y_scale_;
+      if (rotation_ != NULL) {
+        float tmp = x * rot_x - y * rot_y;
+        y = y * rot_x + x * rot_y;
+        x = tmp;
+      }
+      transformed[i].x = IntCastRounded(x + final_xshift_);
+      transformed[i].y = IntCastRounded(y + final_yshift_);
+    }
+    return;
+  }
+  int seg_index = 0;
+  for (int i = 0; i < count; ++i) {
+    float orig_x = pts[i].x;
+    float y_origin, y_scale = y_scale_;
+    const DENORM_SEG* seg = NULL;
+    if (num_segs_ > 0) {
+      seg = SegmentNearIndex(orig_x, &seg_index);
+      if (seg->scale_factor > 0.0)
+        y_scale = seg->scale_factor;
+    }
+    if (seg != NULL && seg->ycoord != -MAX_INT32)
+      y_origin = seg->ycoord;
+    else if (row_ != NULL)
+      y_origin = row_->base_line(orig_x) + y_origin_;
+    else
+      y_origin = y_origin_;
+    float x = (orig_x - x_origin_) * x_scale_;
+    float y = (pts[i].y - y_origin) * y_scale;
+    if (rotation_ != NULL) {
+      float tmp = x * rot_x - y * rot_y;
+      y = y * rot_x + x * rot_y;
+      x = tmp;
+    }
+    transformed[i].x = IntCastRounded(x + final_xshift_);
+    transformed[i].y = IntCastRounded(y + final_yshift_);
+  }
+}
+
 // Transforms the given coords forward to normalized space using the
 // full transformation sequence defined by the block rotation, the
 // predecessors, deepest first, and finally this.
@@ -414,3 +468,23 @@ const DENORM_SEG* DENORM::BinarySearchSegment(float orig_x) const {
   while (top - bottom > 1);
   return &segs_[bottom];
 }
+
+// As BinarySearchSegment, but tries the segment at *index and its
+// neighbours first, and updates *index to the found segment.
+const DENORM_SEG* DENORM::SegmentNearIndex(float orig_x, int* index) const {
+  int i = *index;
+  // Segment i is the one BinarySearchSegment would find if orig_x is not
+  // left of it (or it is the first) and is left of the next one (or it is
+  // the last).
+  if (i > 0 && segs_[i].xstart > orig_x) {
+    --i;
+    if (i > 0 && segs_[i].xstart > orig_x)
+      i = BinarySearchSegment(orig_x) - segs_;
+  } else if (i + 1 < num_segs_ && segs_[i + 1].xstart <= orig_x) {
+    ++i;
+    if (i + 1 < num_segs_ && segs_[i + 1].xstart <= orig_x)
+      i = BinarySearchSegment(orig_x) - segs_;
+  }
+  *index = i;
+  return &segs_[i];
+}
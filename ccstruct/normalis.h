@@ -212,6 +212,13 @@ class DENORM {
   // using any block rotation or predecessor.
   void LocalNormTransform(const TPOINT& pt, TPOINT* transformed) const;
   void LocalNormTransform(const FCOORD& pt, FCOORD* transformed) const;
+  // Transforms count points as LocalNormTransform does to each one, but
+  // with the choice of y-origin and y-scale taken once for the whole array,
+  // and the segments found by walking from the segment of the previous
+  // point instead of by binary search. The results are identical.
+  // pts and transformed may be the same array.
+  void LocalNormTransform(int count, const TPOINT* pts,
+                          TPOINT* transformed) const;
   // Transforms the given coords forward to normalized space using the
   // full transformation sequence defined by the block rotation, the
   // predecessors, deepest first, and finally this.
@@ -297,6 +304,9 @@ class DENORM {
 
   // Finds the appropriate segment for a given original x-coord
   const DENORM_SEG* BinarySearchSegment(float orig_x) const;
+  // As BinarySearchSegment, but tries the segment at *index and its
+  // neighbours first, and updates *index to the found segment.
+  const DENORM_SEG* SegmentNearIndex(float orig_x, int* index) const;
 
   // Best available image.
   Pix* pix_;
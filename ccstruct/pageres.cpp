@@ -273,6 +273,8 @@ bool WERD_RES::SetupForTessRecognition(const UNICHARSET& unicharset_in,
                                    tesseract::Tesseract* tess, Pix* pix,
                                    bool numeric_mode,
                                    bool use_body_size,
+                                   bool poly_wide_objects_better,
+                                   bool poly_debug,
                                    ROW *row, BLOCK* block) {
   tesseract = tess;
   POLY_BLOCK* pb = block != NULL ? block->poly_block() : NULL;
@@ -285,7 +287,8 @@ bool WERD_RES::SetupForTessRecognition(const UNICHARSET& unicharset_in,
   }
   ClearResults();
   SetupWordScript(unicharset_in);
-  chopped_word = TWERD::PolygonalCopy(word);
+  chopped_word = TWERD::PolygonalCopy(word, poly_wide_objects_better,
+                                      poly_debug);
   if (use_body_size && row->body_size() > 0.0f) {
     chopped_word->SetupBLNormalize(block, row, row->body_size(),
                                    numeric_mode, &denorm);
@@ -26,6 +26,7 @@
 #include "normalis.h"
 #include "ocrblock.h"
 #include "ocrrow.h"
+#include "pagearena.h"
 #include "params_training_featdef.h"
 #include "ratngs.h"
 #include "rejctmap.h"
@@ -255,6 +256,7 @@ class PAGE_RES {                 // page result
 
 class BLOCK_RES:public ELIST_LINK {
  public:
+  PAGE_ARENA_OPERATORS
   BLOCK * block;               // real block
   inT32 char_count;            // chars in block
   inT32 rej_count;             // rejected chars
@@ -283,6 +285,7 @@ class BLOCK_RES:public ELIST_LINK {
 
 class ROW_RES:public ELIST_LINK {
  public:
+  PAGE_ARENA_OPERATORS
   ROW * row;                   // real row
   inT32 char_count;            // chars in block
   inT32 rej_count;             // rejected chars
@@ -313,6 +316,7 @@ enum CRUNCH_MODE
 // information about a word result.
 class WERD_RES : public ELIST_LINK {
  public:
+  PAGE_ARENA_OPERATORS
   // Which word is which?
   // There are 3 coordinate spaces in use here: a possibly rotated pixel space,
   // the original image coordinate space, and the BLN space in which the
@@ -563,10 +567,12 @@ class WERD_RES : public ELIST_LINK {
   // blob normalization instead of xheight + ascrise. This flag is for
   // those languages that are using CJK pitch model and thus it has to
   // be true if and only if tesseract->textord_use_cjk_fp_model is
-  // true.
+  // true. poly_wide_objects_better and poly_debug are the engine's params
+  // of the same names, passed on to TWERD::PolygonalCopy.
   bool SetupForTessRecognition(const UNICHARSET& unicharset_in,
                                tesseract::Tesseract* tesseract, Pix* pix,
                                bool numeric_mode, bool use_body_size,
+                               bool poly_wide_objects_better, bool poly_debug,
                                ROW *row, BLOCK* block);
 
   // Sets up the members used in recognition:
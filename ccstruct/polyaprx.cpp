@@ -24,16 +24,8 @@
 #endif
 #define FASTEDGELENGTH    256
 #include          "polyaprx.h"
-#include          "params.h"
 #include          "tprintf.h"
 
-#define EXTERN
-
-EXTERN BOOL_VAR (poly_debug, FALSE, "Debug old poly");
-EXTERN BOOL_VAR (poly_wide_objects_better, TRUE,
-"More accurate approx on wide things");
-
-
 #define FIXED       4            /*OUTLINE point is fixed */
 
 #define RUNLENGTH     1          /*length of run */
@@ -53,10 +45,13 @@ const int par2 = 6750 / (approx_dist * approx_dist);
  * tesspoly_outline
  *
  * Approximate an outline from chain codes form using the old tess algorithm.
+ * If wide_objects_better is false, wide outlines are approximated as
+ * coarsely as tall ones. If debug is true, the refinement is traced.
  **********************************************************************/
 
 
-TESSLINE* ApproximateOutline(C_OUTLINE* c_outline) {
+TESSLINE* ApproximateOutline(C_OUTLINE* c_outline, bool wide_objects_better,
+                             bool debug) {
   EDGEPT *edgept;                // converted steps
   TBOX loop_box;                  // bounding box
   inT32 area;                    // loop area
@@ -69,15 +64,22 @@ TESSLINE* ApproximateOutline(C_OUTLINE* c_outline) {
 
   loop_box = c_outline->bounding_box();
   area = loop_box.height();
-  if (!poly_wide_objects_better && loop_box.width() > area)
+  if (!wide_objects_better && loop_box.width() > area)
     area = loop_box.width();
   area *= area;
   edgept = edgesteps_to_edgepts(c_outline, edgepts);
   fix2(edgepts, area);
-  edgept = poly2 (edgepts, area);  // 2nd approximation.
+  edgept = poly2 (edgepts, area, debug);  // 2nd approximation.
   EDGEPT* startpt = edgept;
   EDGEPT* result = NULL;
   EDGEPT* prev_result = NULL;
+  // Keep the outline in one block, so walking it walks contiguous memory.
+  int num_pts = 0;
+  do {
+    ++num_pts;
+    edgept = edgept->next;
+  } while (edgept != startpt);
+  tesseract::PageArena::ReservePacked(num_pts * sizeof(EDGEPT));
   do {
     EDGEPT* new_pt = new EDGEPT;
     new_pt->pos = edgept->pos;
@@ -385,7 +387,8 @@ void fix2(                //polygonal approx
 
 EDGEPT *poly2(                  //second poly
               EDGEPT *startpt,  /*start of loop */
-              int area          /*area of blob box */
+              int area,         /*area of blob box */
+              bool debug        /*trace the refinement */
              ) {
   register EDGEPT *edgept;       /*current outline point */
   EDGEPT *loopstart;             /*starting point */
@@ -428,14 +431,14 @@ EDGEPT *poly2(                  //second poly
         }
         while ((edgept->flags[FLAGS] & FIXED) == 0
           && edgept != loopstart && edgesum < 126);
-        if (poly_debug)
+        if (debug)
           tprintf
             ("Poly2:starting at (%d,%d)+%d=(%d,%d),%d to (%d,%d)\n",
             linestart->pos.x, linestart->pos.y, linestart->flags[DIR],
             linestart->vec.x, linestart->vec.y, edgesum, edgept->pos.x,
             edgept->pos.y);
                                  /*reapproximate */
-        cutline(linestart, edgept, area);
+        cutline(linestart, edgept, area, debug);
 
         while ((edgept->next->flags[FLAGS] & FIXED)
           && edgept != loopstart)
@@ -484,7 +487,8 @@ EDGEPT *poly2(                  //second poly
 void cutline(                //recursive refine
              EDGEPT *first,  /*ends of line */
              EDGEPT *last,
-             int area        /*area of object */
+             int area,       /*area of object */
+             bool debug      /*trace the refinement */
             ) {
   register EDGEPT *edge;         /*current edge */
   TPOINT vecsum;                 /*vector sum */
@@ -528,7 +532,7 @@ void cutline(                //recursive refine
     }
     squaresum += perp;           /*sum squares */
     ptcount++;                   /*count points */
-    if (poly_debug)
+    if (debug)
       tprintf ("Cutline:Final perp=%d\n", perp);
     if (perp > maxperp) {
       maxperp = perp;
@@ -558,14 +562,14 @@ void cutline(                //recursive refine
                                  /*avoid overflow */
     perp = (squaresum / perp << 8) / ptcount;
 
-  if (poly_debug)
+  if (debug)
     tprintf ("Cutline:A=%d, max=%.2f(%.2f%%), msd=%.2f(%.2f%%)\n",
       area, maxperp / 256.0, maxperp * 200.0 / area,
       perp / 256.0, perp * 300.0 / area);
   if (maxperp * par1 >= 10 * area || perp * par2 >= 10 * area || vlen >= 126) {
     maxpoint->flags[FLAGS] |= FIXED;
                                  /*partitions */
-    cutline(first, maxpoint, area);
-    cutline(maxpoint, last, area);
+    cutline(first, maxpoint, area, debug);
+    cutline(maxpoint, last, area, debug);
   }
 }
@@ -24,7 +24,8 @@
 #include          "coutln.h"
 
 // convert a chain-coded input to the old OUTLINE approximation
-TESSLINE* ApproximateOutline(C_OUTLINE *c_outline);
+TESSLINE* ApproximateOutline(C_OUTLINE *c_outline, bool wide_objects_better,
+                             bool debug);
 EDGEPT *edgesteps_to_edgepts (   //convert outline
 C_OUTLINE * c_outline,           //input
 EDGEPT edgepts[]                 //output is array
@@ -34,11 +35,13 @@ void fix2(                //polygonal approx
           int area);
 EDGEPT *poly2(                  //second poly
               EDGEPT *startpt,  /*start of loop */
-              int area          /*area of blob box */
+              int area,         /*area of blob box */
+              bool debug        /*trace the refinement */
              );
 void cutline(                //recursive refine
              EDGEPT *first,  /*ends of line */
              EDGEPT *last,
-             int area        /*area of object */
+             int area,       /*area of object */
+             bool debug      /*trace the refinement */
             );
 #endif
@@ -27,15 +27,13 @@
 
 class ROW;
 
+namespace tesseract {
+class Textord;
+}
+
 class QSPLINE
 {
-  friend void make_first_baseline(TBOX *,
-                                  int,
-                                  int *,
-                                  int *,
-                                  QSPLINE *,
-                                  QSPLINE *,
-                                  float);
+  friend class tesseract::Textord;  // For make_first_baseline.
   friend void make_holed_baseline(TBOX *, int, QSPLINE *, QSPLINE *, float);
   friend void tweak_row_baseline(ROW *, double, double);
   public:
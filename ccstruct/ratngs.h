@@ -25,12 +25,14 @@
 #include "clst.h"
 #include "genericvector.h"
 #include "notdll.h"
+#include "pagearena.h"
 #include "unichar.h"
 #include "unicharset.h"
 #include "werd.h"
 
 class BLOB_CHOICE : public ELIST_LINK {
 public:
+    PAGE_ARENA_OPERATORS
 
     BLOB_CHOICE() {
         unichar_id_ = INVALID_UNICHAR_ID;
@@ -174,13 +176,15 @@ private:
     // k is defined as above to normalize -klog p to the range [0, 1].
     float certainty_; // absolute
     int script_id_;
+    // The members are ordered to leave no padding, as the ratings matrix of
+    // a long word holds a great many BLOB_CHOICEs.
+    inT16 xgap_before_;
+    inT16 xgap_after_;
     // Stores language model information about this BLOB_CHOICE. Used during
     // the segmentation search for BLOB_CHOICEs in BLOB_CHOICE_LISTs that are
     // recorded in the ratings matrix.
     // The pointer is owned/managed by the segmentation search.
     void *language_model_state_;
-    inT16 xgap_before_;
-    inT16 xgap_after_;
     // X-height range (in image pixels) that this classification supports.
     inT16 min_xheight_;
     inT16 max_xheight_;
@@ -210,6 +214,7 @@ enum PermuterType {
 
 class WERD_CHOICE {
 public:
+    PAGE_ARENA_OPERATORS
     static const float kBadRating;
 
     WERD_CHOICE(const UNICHARSET *unicharset)
@@ -33,11 +33,6 @@
 #include <assert.h>
 #endif
 
-/*----------------------------------------------------------------------
-              V a r i a b l e s
-----------------------------------------------------------------------*/
-BOOL_VAR(wordrec_display_splits, 0, "Display splits");
-
 makestructure(newsplit, free_split, SPLIT);
 
 /*----------------------------------------------------------------------
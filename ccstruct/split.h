@@ -42,12 +42,6 @@ typedef struct split_record
 
 typedef LIST SPLITS;             /*  SPLITS  */
 
-/*----------------------------------------------------------------------
-              V a r i a b l e s
-----------------------------------------------------------------------*/
-
-extern BOOL_VAR_H(wordrec_display_splits, 0, "Display splits");
-
 /*----------------------------------------------------------------------
               M a c r o s
 ----------------------------------------------------------------------*/
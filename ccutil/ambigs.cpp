@@ -157,6 +157,9 @@ void UnicharAmbigs::LoadUnicharAmbigs(FILE *AmbigFile,
     }
   }
 
+  replace_matcher_.Build(replace_ambigs_);
+  dang_matcher_.Build(dang_ambigs_);
+
   // Print what was read from the input file.
   if (debug_level > 1) {
     for (int tbl = 0; tbl < 2; ++tbl) {
@@ -328,4 +331,186 @@ void UnicharAmbigs::InsertIntoTable(
       AmbigSpec::compare_ambig_specs, false, ambig_spec);
 }
 
+// Edge of the trie of an AmbigMatcher under construction.
+struct AmbigTrieEdge {
+  int parent;
+  UNICHAR_ID id;
+  int child;
+};
+
+// Sorts AmbigTrieEdges by parent and then id.
+static int CompareAmbigTrieEdges(const void *e1, const void *e2) {
+  const AmbigTrieEdge *edge1 = static_cast<const AmbigTrieEdge *>(e1);
+  const AmbigTrieEdge *edge2 = static_cast<const AmbigTrieEdge *>(e2);
+  if (edge1->parent != edge2->parent)
+    return edge1->parent < edge2->parent ? -1 : 1;
+  if (edge1->id != edge2->id)
+    return edge1->id < edge2->id ? -1 : 1;
+  return 0;
+}
+
+// Sorts AmbigMatches by start and then order.
+static int CompareAmbigMatches(const void *m1, const void *m2) {
+  const AmbigMatch *match1 = static_cast<const AmbigMatch *>(m1);
+  const AmbigMatch *match2 = static_cast<const AmbigMatch *>(m2);
+  if (match1->start != match2->start)
+    return match1->start < match2->start ? -1 : 1;
+  if (match1->order != match2->order)
+    return match1->order < match2->order ? -1 : 1;
+  return 0;
+}
+
+AmbigMatcher::AmbigMatcher() {
+  Build(UnicharAmbigsVector());
+}
+
+// Builds the automaton from the given table.
+void AmbigMatcher::Build(const UnicharAmbigsVector &table) {
+  edge_starts_.clear();
+  edge_ids_.clear();
+  edge_targets_.clear();
+  fail_.clear();
+  output_link_.clear();
+  depth_.clear();
+  output_firsts_.clear();
+  output_counts_.clear();
+  specs_.clear();
+  // The lists are sorted by wrong_ngram and indexed by its first id, so
+  // taking them in turn gives all the specs in sorted order, and the trie
+  // can be built by comparing each spec only with the one before.
+  GenericVector<AmbigTrieEdge> edges;
+  GenericVector<int> path;  // Nodes along the previous spec.
+  GenericVector<int> spec_nodes;
+  path.push_back(0);
+  depth_.push_back(0);
+  const AmbigSpec *prev_spec = NULL;
+  for (int i = 0; i < table.size(); ++i) {
+    if (table[i] == NULL) continue;
+    AmbigSpec_IT spec_it(table[i]);
+    for (spec_it.mark_cycle_pt(); !spec_it.cycled_list(); spec_it.forward()) {
+      const AmbigSpec *spec = spec_it.data();
+      int common = 0;
+      if (prev_spec != NULL) {
+        while (common < spec->wrong_ngram_size &&
+               common < prev_spec->wrong_ngram_size &&
+               spec->wrong_ngram[common] == prev_spec->wrong_ngram[common])
+          ++common;
+      }
+      path.truncate(common + 1);
+      for (int d = common; d < spec->wrong_ngram_size; ++d) {
+        AmbigTrieEdge edge;
+        edge.parent = path[d];
+        edge.id = spec->wrong_ngram[d];
+        edge.child = depth_.size();
+        edges.push_back(edge);
+        depth_.push_back(d + 1);
+        path.push_back(edge.child);
+      }
+      spec_nodes.push_back(path[spec->wrong_ngram_size]);
+      specs_.push_back(spec);
+      prev_spec = spec;
+    }
+  }
+  int num_nodes = depth_.size();
+  // Equal ngrams are adjacent in sorted order, so the specs of each node
+  // are a contiguous run of specs_.
+  output_firsts_.init_to_size(num_nodes, 0);
+  output_counts_.init_to_size(num_nodes, 0);
+  for (int s = 0; s < spec_nodes.size(); ++s) {
+    if (output_counts_[spec_nodes[s]]++ == 0)
+      output_firsts_[spec_nodes[s]] = s;
+  }
+  // Pack the edges of each node together.
+  edges.sort(&CompareAmbigTrieEdges);
+  edge_starts_.init_to_size(num_nodes + 1, 0);
+  for (int e = 0; e < edges.size(); ++e) {
+    ++edge_starts_[edges[e].parent + 1];
+    edge_ids_.push_back(edges[e].id);
+    edge_targets_.push_back(edges[e].child);
+  }
+  for (int n = 0; n < num_nodes; ++n)
+    edge_starts_[n + 1] += edge_starts_[n];
+  // Fill in the fail and output links breadth first, so the links of
+  // shallower nodes are always ready.
+  fail_.init_to_size(num_nodes, 0);
+  output_link_.init_to_size(num_nodes, -1);
+  GenericVector<int> queue;
+  queue.push_back(0);
+  for (int q = 0; q < queue.size(); ++q) {
+    int node = queue[q];
+    for (int e = edge_starts_[node]; e < edge_starts_[node + 1]; ++e) {
+      int child = edge_targets_[e];
+      int fail = 0;
+      if (node != 0)
+        fail = NextState(fail_[node], edge_ids_[e]);
+      fail_[child] = fail;
+      output_link_[child] = output_counts_[fail] > 0 ? fail
+                                                     : output_link_[fail];
+      queue.push_back(child);
+    }
+  }
+}
+
+// Fills matches with every occurrence in ids[0, length) of the wrong ngram
+// of a spec in the table, sorted by start and then order.
+void AmbigMatcher::FindMatches(const UNICHAR_ID *ids, int length,
+                               GenericVector<AmbigMatch> *matches) const {
+  matches->clear();
+  if (specs_.empty()) return;
+  int state = 0;
+  for (int i = 0; i < length; ++i) {
+    state = NextState(state, ids[i]);
+    int node = output_counts_[state] > 0 ? state : output_link_[state];
+    for (; node >= 0; node = output_link_[node]) {
+      int end = output_firsts_[node] + output_counts_[node];
+      for (int s = output_firsts_[node]; s < end; ++s) {
+        AmbigMatch match;
+        match.start = i + 1 - depth_[node];
+        match.order = s;
+        match.spec = specs_[s];
+        matches->push_back(match);
+      }
+    }
+  }
+  matches->sort(&CompareAmbigMatches);
+}
+
+// Returns true if there is at least one match in ids[0, length).
+bool AmbigMatcher::AnyMatch(const UNICHAR_ID *ids, int length) const {
+  if (specs_.empty()) return false;
+  int state = 0;
+  for (int i = 0; i < length; ++i) {
+    state = NextState(state, ids[i]);
+    if (output_counts_[state] > 0 || output_link_[state] >= 0)
+      return true;
+  }
+  return false;
+}
+
+// Returns the child of node on the given id, or -1 if there is none.
+int AmbigMatcher::Child(int node, UNICHAR_ID id) const {
+  int bottom = edge_starts_[node];
+  int top = edge_starts_[node + 1];
+  while (bottom < top) {
+    int middle = (bottom + top) / 2;
+    if (edge_ids_[middle] < id)
+      bottom = middle + 1;
+    else
+      top = middle;
+  }
+  if (bottom < edge_starts_[node + 1] && edge_ids_[bottom] == id)
+    return edge_targets_[bottom];
+  return -1;
+}
+
+// Returns the state after reading id in the given state.
+int AmbigMatcher::NextState(int state, UNICHAR_ID id) const {
+  while (true) {
+    int child = Child(state, id);
+    if (child >= 0) return child;
+    if (state == 0) return 0;
+    state = fail_[state];
+  }
+}
+
 }  // namespace tesseract
@@ -138,6 +138,58 @@ ELISTIZEH(AmbigSpec);
 // wrong ngram starts with unichar id i.
 typedef GenericVector<AmbigSpec_LIST *> UnicharAmbigsVector;
 
+// An occurrence of the wrong ngram of an AmbigSpec in a string of unichar ids.
+struct AmbigMatch {
+  int start;  // Index of the first unichar id of the match.
+  int order;  // Index of the spec in the sorted order of the table.
+  const AmbigSpec *spec;
+};
+
+// Aho-Corasick automaton over the wrong ngrams of all the AmbigSpecs in a
+// UnicharAmbigsVector, which finds every ambig in a word in a single pass
+// over the word instead of walking the AmbigSpec_LIST at every position.
+class AmbigMatcher {
+ public:
+  AmbigMatcher();
+
+  // Builds the automaton from the given table, which must be kept, as the
+  // matches point to its AmbigSpecs.
+  void Build(const UnicharAmbigsVector &table);
+
+  // Fills matches with every occurrence in ids[0, length) of the wrong ngram
+  // of a spec in the table. The matches are sorted by start and then in the
+  // order of the AmbigSpec_LIST, which is the order the old walk of the list
+  // found them in.
+  void FindMatches(const UNICHAR_ID *ids, int length,
+                   GenericVector<AmbigMatch> *matches) const;
+  // Returns true if there is at least one match in ids[0, length).
+  bool AnyMatch(const UNICHAR_ID *ids, int length) const;
+
+ private:
+  // Returns the child of node on the given id, or -1 if there is none.
+  int Child(int node, UNICHAR_ID id) const;
+  // Returns the state after reading id in the given state.
+  int NextState(int state, UNICHAR_ID id) const;
+
+  // The edges out of node i are edge_ids_[j], edge_targets_[j] for j in
+  // [edge_starts_[i], edge_starts_[i + 1]), sorted by id. Node 0 is the root.
+  GenericVector<int> edge_starts_;
+  GenericVector<UNICHAR_ID> edge_ids_;
+  GenericVector<int> edge_targets_;
+  // Longest proper suffix of each node that is also a node.
+  GenericVector<int> fail_;
+  // Nearest node along the fail_ chain that ends a spec, or -1.
+  GenericVector<int> output_link_;
+  // Length of the ngram at each node.
+  GenericVector<int> depth_;
+  // The specs ending at node i are specs_[j] for j in
+  // [output_firsts_[i], output_firsts_[i] + output_counts_[i]).
+  GenericVector<int> output_firsts_;
+  GenericVector<int> output_counts_;
+  // All the specs in the sorted order of the table.
+  GenericVector<const AmbigSpec *> specs_;
+};
+
 class UnicharAmbigs {
  public:
   UnicharAmbigs() {}
@@ -149,6 +201,9 @@ class UnicharAmbigs {
 
   const UnicharAmbigsVector &dang_ambigs() const { return dang_ambigs_; }
   const UnicharAmbigsVector &replace_ambigs() const { return replace_ambigs_; }
+  // Automata over the two tables above.
+  const AmbigMatcher &dang_matcher() const { return dang_matcher_; }
+  const AmbigMatcher &replace_matcher() const { return replace_matcher_; }
 
   // Fills in two ambiguity tables (replaceable and dangerous) with information
   // read from the ambigs file. An ambiguity table is an array of lists.
@@ -204,6 +259,8 @@ class UnicharAmbigs {
                        AmbigSpec *ambig_spec, UNICHARSET *unicharset);
   UnicharAmbigsVector dang_ambigs_;
   UnicharAmbigsVector replace_ambigs_;
+  AmbigMatcher dang_matcher_;
+  AmbigMatcher replace_matcher_;
   GenericVector<UnicharIdVector *> one_to_one_definite_ambigs_;
   GenericVector<UnicharIdVector *> ambigs_for_adaption_;
   GenericVector<UnicharIdVector *> reverse_ambigs_for_adaption_;
@@ -34,7 +34,7 @@
 template <typename T>
 class GenericVector {
  public:
-  GenericVector() { this->init(kDefaultVectorSize); }
+  GenericVector() { this->init(0); }
   explicit GenericVector(int size) { this->init(size); }
 
   // Copy
@@ -176,11 +176,10 @@ class GenericVector {
     return data_new;
   }
 
-  // Sorts the members of this vector using the less than comparator (cmp_lt),
-  // which compares the values. Useful for GenericVectors to primitive types.
-  // Will not work so great for pointers (unless you just want to sort some
-  // pointers). You need to provide a specialization to sort_cmp to use
-  // your type.
+  // Sorts the members of this vector using operator<, which compares the
+  // values. Useful for GenericVectors to primitive types. Will not work so
+  // great for pointers (unless you just want to sort some pointers).
+  // Uses IntroSort, so the comparison is inlined for T.
   void sort();
 
   // Sort the array into the order defined by the qsort function comparator.
@@ -191,6 +190,14 @@ class GenericVector {
     qsort(data_, size_used_, sizeof(*data_), comparator);
   }
 
+  // Inserts t into the vector, which must already be sorted by the given
+  // qsort comparator, after any elements that compare equal to it, like
+  // CLIST::add_sorted. If unique is true and t is found before the place
+  // it would go (using operator==), nothing is added.
+  // Returns true if t was added.
+  bool add_sorted(int (*comparator)(const void*, const void*), bool unique,
+                  const T& t);
+
   // Searches the array (assuming sorted in ascending order, using sort()) for
   // an element equal to target and returns true if it is present.
   // Use binary_search to get the index of target, or its nearest candidate.
@@ -267,9 +274,10 @@ class GenericVector {
   // Init the object, allocating size memory.
   void init(int size);
 
-  // We are assuming that the object generally placed in thie
-  // vector are small enough that for efficiency it makes sence
-  // to start with a larger initial size.
+  // Many vectors are never used, so nothing is allocated until the first
+  // element is added. We are assuming that the object generally placed in
+  // thie vector are small enough that for efficiency it makes sence to
+  // then start with a larger size.
   static const int kDefaultVectorSize = 4;
   inT32   size_used_;
   inT32   size_reserved_;
@@ -281,6 +289,61 @@ class GenericVector {
 
 namespace tesseract {
 
+// Used by GenericVector::reserve to move count elements from src to the
+// default-constructed dest, after which src is deleted. The general version
+// assigns each element. Types that own memory specialize it to take over
+// the memory of the source instead of copying it, and types that can be
+// copied bitwise specialize it to use memcpy.
+template <typename T>
+struct ElementRelocator {
+  static void Relocate(T* src, T* dest, int count) {
+    for (int i = 0; i < count; ++i)
+      dest[i] = src[i];
+  }
+};
+
+template <typename T>
+struct ElementRelocator<T*> {
+  static void Relocate(T** src, T** dest, int count) {
+    memcpy(dest, src, count * sizeof(*src));
+  }
+};
+
+#define TESS_MEMCPY_RELOCATABLE(type)                      \
+  template <>                                              \
+  struct ElementRelocator<type> {                          \
+    static void Relocate(type* src, type* dest, int count) { \
+      memcpy(dest, src, count * sizeof(*src));             \
+    }                                                      \
+  }
+
+TESS_MEMCPY_RELOCATABLE(bool);
+TESS_MEMCPY_RELOCATABLE(char);
+TESS_MEMCPY_RELOCATABLE(signed char);
+TESS_MEMCPY_RELOCATABLE(unsigned char);
+TESS_MEMCPY_RELOCATABLE(short);
+TESS_MEMCPY_RELOCATABLE(unsigned short);
+TESS_MEMCPY_RELOCATABLE(int);
+TESS_MEMCPY_RELOCATABLE(unsigned int);
+TESS_MEMCPY_RELOCATABLE(long);
+TESS_MEMCPY_RELOCATABLE(unsigned long);
+TESS_MEMCPY_RELOCATABLE(long long);
+TESS_MEMCPY_RELOCATABLE(unsigned long long);
+TESS_MEMCPY_RELOCATABLE(float);
+TESS_MEMCPY_RELOCATABLE(double);
+
+#undef TESS_MEMCPY_RELOCATABLE
+
+// Vectors of vectors hand over their arrays with move.
+template <typename T>
+struct ElementRelocator<GenericVector<T> > {
+  static void Relocate(GenericVector<T>* src, GenericVector<T>* dest,
+                       int count) {
+    for (int i = 0; i < count; ++i)
+      dest[i].move(&src[i]);
+  }
+};
+
 template <typename T>
 bool cmp_eq(T const & t1, T const & t2) {
   return t1 == t2;
@@ -303,6 +366,122 @@ int sort_cmp(const void* t1, const void* t2) {
   }
 }
 
+// Helpers for IntroSort, below.
+const int kIntroSortThreshold = 16;
+
+template <typename T>
+void SortSwap(T* a, T* b) {
+  T tmp = *a;
+  *a = *b;
+  *b = tmp;
+}
+
+// Swaps the median of *a, *b and *c into *result.
+template <typename T>
+void MoveMedianToFirst(T* result, T* a, T* b, T* c) {
+  if (*a < *b) {
+    if (*b < *c)
+      SortSwap(result, b);
+    else if (*a < *c)
+      SortSwap(result, c);
+    else
+      SortSwap(result, a);
+  } else if (*a < *c) {
+    SortSwap(result, a);
+  } else if (*b < *c) {
+    SortSwap(result, c);
+  } else {
+    SortSwap(result, b);
+  }
+}
+
+// Moves data[root] down the max-heap in data[0, size) to its place.
+template <typename T>
+void SiftDown(T* data, int root, int size) {
+  T value = data[root];
+  int child;
+  while ((child = 2 * root + 1) < size) {
+    if (child + 1 < size && data[child] < data[child + 1])
+      ++child;
+    if (!(value < data[child]))
+      break;
+    data[root] = data[child];
+    root = child;
+  }
+  data[root] = value;
+}
+
+template <typename T>
+void HeapSortArray(T* data, int size) {
+  for (int i = size / 2 - 1; i >= 0; --i)
+    SiftDown(data, i, size);
+  for (int i = size - 1; i > 0; --i) {
+    SortSwap(&data[0], &data[i]);
+    SiftDown(data, 0, i);
+  }
+}
+
+template <typename T>
+void InsertionSort(T* data, int size) {
+  for (int i = 1; i < size; ++i) {
+    if (data[i] < data[i - 1]) {
+      T value = data[i];
+      int j = i;
+      do {
+        data[j] = data[j - 1];
+        --j;
+      } while (j > 0 && value < data[j - 1]);
+      data[j] = value;
+    }
+  }
+}
+
+// Partitions data[0, size) by quicksort until the pieces are no bigger than
+// kIntroSortThreshold, leaving them for the final insertion sort, or
+// heapsorts a piece if depth_limit partitions fail to get it that small.
+// The scans are bounds-checked, so an inconsistent operator< can't run them
+// off the end.
+template <typename T>
+void IntroSortLoop(T* data, int size, int depth_limit) {
+  while (size > kIntroSortThreshold) {
+    if (depth_limit-- == 0) {
+      HeapSortArray(data, size);
+      return;
+    }
+    // The pivot stays in data[0] while the rest is partitioned.
+    MoveMedianToFirst(data, data + 1, data + size / 2, data + size - 1);
+    T* left = data + 1;
+    T* right = data + size;
+    for (;;) {
+      while (left < right && *left < *data)
+        ++left;
+      --right;
+      while (left <= right && *data < *right)
+        --right;
+      if (left >= right)
+        break;
+      SortSwap(left, right);
+      ++left;
+    }
+    // Recurse on the right part and loop on the left.
+    IntroSortLoop(left, static_cast<int>(data + size - left), depth_limit);
+    size = static_cast<int>(left - data);
+  }
+}
+
+// Sorts data[0, size) into ascending order using operator<. Introsort is
+// quicksort with a median of three pivot, that falls back to heapsort if
+// the partitions go too deep and finishes with an insertion sort, so it is
+// O(n log n) at worst. It is not stable.
+template <typename T>
+void IntroSort(T* data, int size) {
+  int depth_limit = 0;
+  for (int n = size; n > 1; n >>= 1)
+    depth_limit += 2;
+  IntroSortLoop(data, size, depth_limit);
+  InsertionSort(data, size);
+}
+
 // Used by PointerVector::sort()
 // return < 0 if t1 < t2
 // return 0 if t1 == t2
@@ -473,15 +652,16 @@ GenericVector<T>::~GenericVector() {
 }
 
 // Reserve some memory. If the internal array contains elements, they are
-// copied.
+// relocated to the new array with ElementRelocator.
 template <typename T>
 void GenericVector<T>::reserve(int size) {
   if (size_reserved_ >= size || size <= 0)
     return;
   T* new_array = new T[size];
-  for (int i = 0; i < size_used_; ++i)
-    new_array[i] = data_[i];
-  if (data_ != NULL) delete[] data_;
+  if (data_ != NULL) {
+    tesseract::ElementRelocator<T>::Relocate(data_, new_array, size_used_);
+    delete[] data_;
+  }
   data_ = new_array;
   size_reserved_ = size;
 }
@@ -591,6 +771,30 @@ int GenericVector<T>::push_back(T object) {
   return index;
 }
 
+template <typename T>
+bool GenericVector<T>::add_sorted(int (*comparator)(const void*, const void*),
+                                  bool unique, const T& t) {
+  // Check for adding at the end.
+  if (size_used_ == 0 || comparator(&data_[size_used_ - 1], &t) < 0) {
+    push_back(t);
+    return true;
+  }
+  if (unique && data_[size_used_ - 1] == t)
+    return false;
+  int index = 0;
+  for (; index < size_used_; ++index) {
+    if (unique && data_[index] == t)
+      return false;
+    if (comparator(&data_[index], &t) > 0)
+      break;
+  }
+  if (index == size_used_)
+    push_back(t);
+  else
+    insert(t, index);
+  return true;
+}
+
 template <typename T>
 int GenericVector<T>::push_back_new(T object) {
   int index = get_index(object);
@@ -801,7 +1005,7 @@ void GenericVector<T>::move(GenericVector<T>* from) {
 
 template <typename T>
 void GenericVector<T>::sort() {
-  sort(&tesseract::sort_cmp<T>);
+  tesseract::IntroSort(data_, size_used_);
 }
 
 #endif  // TESSERACT_CCUTIL_GENERICVECTOR_H_
@@ -0,0 +1,453 @@
+///////////////////////////////////////////////////////////////////////
+// File:        pagearena.cpp
+// Description: Pooled allocator for the short-lived results of a page.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+///////////////////////////////////////////////////////////////////////
+
+#include "pagearena.h"
+
+#include <stdlib.h>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#include "ccutil.h"
+#include "errcode.h"
+#include "platform.h"
+
+namespace tesseract {
+
+// Objects are aligned to, and their sizes rounded up to, this many bytes.
+const int kArenaAlignment = 16;
+// Objects bigger than this go on the heap.
+const int kMaxArenaObjectSize = 1024;
+const int kNumSizeClasses = kMaxArenaObjectSize / kArenaAlignment;
+// Size and alignment of the chunks taken from the heap, so that the chunk
+// of any arena object can be found from its address.
+const int kArenaChunkBits = 16;
+const int kArenaChunkSize = 1 << kArenaChunkBits;
+
+// Starts each chunk, padded out to kArenaAlignment bytes.
+struct ArenaChunkHeader {
+  char* next;        // The next chunk of the same arena.
+  PageArena* arena;  // The arena that owns the chunk.
+};
+
+// Objects from New carry no header, so Delete tells an arena object from a
+// heap one by looking up its chunk in a map of the chunks in use by any
+// arena. The map is in two levels over the address space: the root holds a
+// leaf per 1 << (kArenaChunkBits + kChunkMapLeafBits) bytes of addresses,
+// made on first use and never freed, and a leaf holds a flag per chunk.
+// Flags are only set and cleared while no object lives in the chunk, so
+// lookups need no lock.
+const int kAddressBits = sizeof(void*) == 8 ? 48 : 32;
+const int kChunkMapLeafBits = 16;
+const int kChunkMapRootBits = kAddressBits - kArenaChunkBits -
+                              kChunkMapLeafBits;
+const int kChunkMapLeafSize = 1 << kChunkMapLeafBits;
+static unsigned char* volatile chunk_map[1 << kChunkMapRootBits];
+
+// Size and alignment of the blocks used by NewPacked, so that the block of
+// any packed object can be found from its address.
+const int kPackedBlockSize = 4096;
+
+// Starts each packed block, padded out to kArenaAlignment bytes.
+// refs is the number of live objects in the block, plus one while a thread
+// is filling it. Objects may be deleted on any thread, so it is changed
+// atomically.
+struct PackedBlockHeader {
+  volatile long refs;
+  PageArena* arena;  // NULL if the block is on the heap.
+};
+const int kPackedHeaderSize = kArenaAlignment;
+
+static TESS_THREAD_LOCAL PageArena* current_arena = NULL;
+// The packed block being filled by this thread, and its unused part.
+static TESS_THREAD_LOCAL char* packed_block = NULL;
+static TESS_THREAD_LOCAL char* packed_ptr = NULL;
+static TESS_THREAD_LOCAL char* packed_end = NULL;
+
+// Returns size bytes aligned to size.
+static void* AllocateAligned(int size) {
+  void* block = NULL;
+#ifdef _WIN32
+  block = _aligned_malloc(size, size);
+#else
+  if (posix_memalign(&block, size, size) != 0)
+    block = NULL;
+#endif
+  ASSERT_HOST(block != NULL);
+  return block;
+}
+
+// Frees memory from AllocateAligned.
+static void FreeAligned(void* block) {
+#ifdef _WIN32
+  _aligned_free(block);
+#else
+  free(block);
+#endif
+}
+
+// Returns true if the chunk starting at the given address is in use by an
+// arena.
+static bool IsArenaChunk(const char* chunk) {
+  size_t index = reinterpret_cast<size_t>(chunk) >> kArenaChunkBits;
+  size_t root_index = index >> kChunkMapLeafBits;
+  if (root_index >= static_cast<size_t>(1) << kChunkMapRootBits)
+    return false;
+  const unsigned char* leaf = chunk_map[root_index];
+  return leaf != NULL && leaf[index & (kChunkMapLeafSize - 1)] != 0;
+}
+
+// Marks the chunk starting at the given address as in use by an arena, or
+// not.
+static void SetArenaChunk(const char* chunk, bool in_use) {
+  size_t index = reinterpret_cast<size_t>(chunk) >> kArenaChunkBits;
+  size_t root_index = index >> kChunkMapLeafBits;
+  ASSERT_HOST(root_index < static_cast<size_t>(1) << kChunkMapRootBits);
+  unsigned char* leaf = chunk_map[root_index];
+  if (leaf == NULL) {
+    // Another thread may be making the same leaf, so only one is kept.
+    unsigned char* new_leaf =
+        static_cast<unsigned char*>(calloc(kChunkMapLeafSize, 1));
+    ASSERT_HOST(new_leaf != NULL);
+#ifdef _MSC_VER
+    leaf = static_cast<unsigned char*>(_InterlockedCompareExchangePointer(
+        reinterpret_cast<void* volatile*>(&chunk_map[root_index]), new_leaf,
+        NULL));
+#else
+    leaf = __sync_val_compare_and_swap(&chunk_map[root_index],
+                                       static_cast<unsigned char*>(NULL),
+                                       new_leaf);
+#endif
+    if (leaf == NULL)
+      leaf = new_leaf;
+    else
+      free(new_leaf);
+  }
+  leaf[index & (kChunkMapLeafSize - 1)] = in_use ? 1 : 0;
+}
+
+// Adds delta to the references of the block and returns the result.
+static long AddPackedRefs(char* block, long delta) {
+  PackedBlockHeader* header = reinterpret_cast<PackedBlockHeader*>(block);
+#ifdef _MSC_VER
+  return _InterlockedExchangeAdd(&header->refs, delta) + delta;
+#else
+  return __sync_add_and_fetch(&header->refs, delta);
+#endif
+}
+
+// A thread-specific key holding the block the thread is filling, so that
+// the thread's reference to it is dropped when the thread exits.
+static void ClosePackedBlockAtExit(void* block) {
+  if (block != NULL)
+    PageArena::DeletePacked(block);
+}
+
+#ifdef _WIN32
+static INIT_ONCE packed_key_once = INIT_ONCE_STATIC_INIT;
+static DWORD packed_key = FLS_OUT_OF_INDEXES;
+
+static VOID WINAPI ClosePackedBlockAtFlsExit(PVOID block) {
+  ClosePackedBlockAtExit(block);
+}
+
+static BOOL CALLBACK CreatePackedKey(PINIT_ONCE, PVOID, PVOID*) {
+  packed_key = FlsAlloc(ClosePackedBlockAtFlsExit);
+  return packed_key != FLS_OUT_OF_INDEXES;
+}
+
+// Sets the block to close when the calling thread exits.
+static void SetPackedBlockAtExit(char* block) {
+  InitOnceExecuteOnce(&packed_key_once, CreatePackedKey, NULL, NULL);
+  if (packed_key != FLS_OUT_OF_INDEXES)
+    FlsSetValue(packed_key, block);
+}
+#else
+static pthread_once_t packed_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t packed_key;
+static bool packed_key_ok = false;
+
+static void CreatePackedKey() {
+  packed_key_ok = pthread_key_create(&packed_key, ClosePackedBlockAtExit) == 0;
+}
+
+// Sets the block to close when the calling thread exits.
+static void SetPackedBlockAtExit(char* block) {
+  pthread_once(&packed_key_once, CreatePackedKey);
+  if (packed_key_ok)
+    pthread_setspecific(packed_key, block);
+}
+#endif
+
+PageArena::PageArena()
+  : mutex_(new CCUtilMutex), chunks_(NULL), chunk_ptr_(NULL),
+    chunk_end_(NULL), free_lists_(new void*[kNumSizeClasses]),
+    free_packed_blocks_(NULL), release_pending_(false), destroy_pending_(false) {
+  for (int i = 0; i < kNumSizeClasses; ++i)
+    free_lists_[i] = NULL;
+}
+
+PageArena::~PageArena() {
+  FreeChunks();
+  delete [] free_lists_;
+  delete mutex_;
+}
+
+// Returns the counts since the last Release.
+PageArenaStats PageArena::stats() const {
+  mutex_->Lock();
+  PageArenaStats result = stats_;
+  mutex_->Unlock();
+  return result;
+}
+
+// Gives the chunks back to the heap, now if there are no live objects,
+// otherwise as soon as the last of them is deleted, and resets the stats.
+void PageArena::Release() {
+  mutex_->Lock();
+  if (stats_.live_objects == 0)
+    FreeChunks();
+  else
+    release_pending_ = true;
+  stats_.allocations = 0;
+  stats_.bytes = 0;
+  mutex_->Unlock();
+}
+
+// Deletes the arena, now if there are no live objects, otherwise when the
+// last of them is deleted.
+void PageArena::Destroy() {
+  mutex_->Lock();
+  bool destroy = stats_.live_objects == 0;
+  destroy_pending_ = true;
+  mutex_->Unlock();
+  if (destroy)
+    delete this;
+}
+
+// Allocates size bytes from the current arena, or the heap if none.
+void* PageArena::New(size_t size) {
+  PageArena* arena = current_arena;
+  if (arena == NULL || size == 0 || size > kMaxArenaObjectSize)
+    return ::operator new(size);
+  return arena->Allocate((size - 1) / kArenaAlignment);
+}
+
+// Frees memory of the given size allocated by New.
+void PageArena::Delete(void* ptr, size_t size) {
+  if (ptr == NULL)
+    return;
+  char* chunk = static_cast<char*>(ptr) -
+      reinterpret_cast<size_t>(ptr) % kArenaChunkSize;
+  if (size == 0 || size > kMaxArenaObjectSize || !IsArenaChunk(chunk)) {
+    ::operator delete(ptr);
+    return;
+  }
+  PageArena* arena = reinterpret_cast<ArenaChunkHeader*>(chunk)->arena;
+  arena->Free(ptr, (size - 1) / kArenaAlignment);
+}
+
+// Allocates size bytes next to the previous packed allocation of the
+// calling thread, starting a new block if there is no room.
+void* PageArena::NewPacked(size_t size) {
+  size = (size + kArenaAlignment - 1) & ~(kArenaAlignment - 1);
+  ASSERT_HOST(size <= kPackedBlockSize - kPackedHeaderSize);
+  if (packed_block == NULL ||
+      static_cast<size_t>(packed_end - packed_ptr) < size)
+    OpenPackedBlock();
+  AddPackedRefs(packed_block, 1);
+  void* result = packed_ptr;
+  packed_ptr += size;
+  return result;
+}
+
+// Frees memory allocated by NewPacked. The block start is also accepted,
+// to drop the reference of the thread filling it.
+void PageArena::DeletePacked(void* ptr) {
+  if (ptr == NULL)
+    return;
+  char* block = static_cast<char*>(ptr) -
+      reinterpret_cast<size_t>(ptr) % kPackedBlockSize;
+  if (AddPackedRefs(block, -1) != 0)
+    return;
+  PageArena* arena = reinterpret_cast<PackedBlockHeader*>(block)->arena;
+  if (arena == NULL)
+    FreeAligned(block);
+  else
+    arena->FreePackedBlock(block);
+}
+
+// Starts a new block if the one being filled can't take size more bytes.
+void PageArena::ReservePacked(size_t size) {
+  size = (size + kArenaAlignment - 1) & ~(kArenaAlignment - 1);
+  if (size > kPackedBlockSize - kPackedHeaderSize)
+    return;
+  if (packed_block == NULL ||
+      static_cast<size_t>(packed_end - packed_ptr) < size)
+    OpenPackedBlock();
+}
+
+// Returns the arena in use by the calling thread, or NULL.
+PageArena* PageArena::current() {
+  return current_arena;
+}
+
+// Sets the arena in use by the calling thread. NULL to use the heap.
+void PageArena::set_current(PageArena* arena) {
+  if (arena != current_arena)
+    ClosePackedBlock();
+  current_arena = arena;
+}
+
+// Starts a new packed block for the calling thread, from the current arena
+// or the heap, holding a reference to it until it is closed.
+void PageArena::OpenPackedBlock() {
+  ClosePackedBlock();
+  PageArena* arena = current_arena;
+  char* block = static_cast<char*>(arena != NULL ? arena->AllocatePackedBlock()
+                                                 : AllocateAligned(
+                                                     kPackedBlockSize));
+  PackedBlockHeader* header = reinterpret_cast<PackedBlockHeader*>(block);
+  header->refs = 1;
+  header->arena = arena;
+  packed_block = block;
+  packed_ptr = block + kPackedHeaderSize;
+  packed_end = block + kPackedBlockSize;
+  SetPackedBlockAtExit(block);
+}
+
+// Drops the calling thread's reference to the block it is filling.
+void PageArena::ClosePackedBlock() {
+  if (packed_block == NULL)
+    return;
+  char* block = packed_block;
+  packed_block = NULL;
+  packed_ptr = NULL;
+  packed_end = NULL;
+  SetPackedBlockAtExit(NULL);
+  DeletePacked(block);
+}
+
+// Returns a block of the given size class.
+void* PageArena::Allocate(int size_class) {
+  int object_size = (size_class + 1) * kArenaAlignment;
+  mutex_->Lock();
+  void* block = free_lists_[size_class];
+  if (block != NULL) {
+    free_lists_[size_class] = *static_cast<void**>(block);
+  } else {
+    if (chunk_end_ - chunk_ptr_ < object_size) {
+      // Start a new chunk. The unused tail of the old one is abandoned.
+      char* chunk = static_cast<char*>(AllocateAligned(kArenaChunkSize));
+      ArenaChunkHeader* header = reinterpret_cast<ArenaChunkHeader*>(chunk);
+      header->next = chunks_;
+      header->arena = this;
+      SetArenaChunk(chunk, true);
+      chunks_ = chunk;
+      chunk_ptr_ = chunk + kArenaAlignment;
+      chunk_end_ = chunk + kArenaChunkSize;
+      stats_.reserved_bytes += kArenaChunkSize;
+    }
+    block = chunk_ptr_;
+    chunk_ptr_ += object_size;
+  }
+  ++stats_.allocations;
+  stats_.bytes += object_size;
+  ++stats_.live_objects;
+  mutex_->Unlock();
+  return block;
+}
+
+// Puts the block back on its free list. Returns true if the arena was
+// destroyed as a result.
+bool PageArena::Free(void* block, int size_class) {
+  mutex_->Lock();
+  *static_cast<void**>(block) = free_lists_[size_class];
+  free_lists_[size_class] = block;
+  bool destroy = RemoveLiveObject();
+  mutex_->Unlock();
+  if (destroy)
+    delete this;
+  return destroy;
+}
+
+// Returns a packed block, aligned to its size. Each block counts as one
+// object in the stats.
+void* PageArena::AllocatePackedBlock() {
+  mutex_->Lock();
+  void* block = free_packed_blocks_;
+  if (block != NULL) {
+    free_packed_blocks_ = *static_cast<void**>(block);
+  } else {
+    block = AllocateAligned(kPackedBlockSize);
+    stats_.reserved_bytes += kPackedBlockSize;
+  }
+  ++stats_.allocations;
+  stats_.bytes += kPackedBlockSize;
+  ++stats_.live_objects;
+  mutex_->Unlock();
+  return block;
+}
+
+// Puts the packed block back on its free list. Returns true if the arena
+// was destroyed as a result.
+bool PageArena::FreePackedBlock(void* block) {
+  mutex_->Lock();
+  *static_cast<void**>(block) = free_packed_blocks_;
+  free_packed_blocks_ = block;
+  bool destroy = RemoveLiveObject();
+  mutex_->Unlock();
+  if (destroy)
+    delete this;
+  return destroy;
+}
+
+// Counts one live object less, freeing the chunks if a release is pending
+// and it was the last. Returns true if the arena must now be destroyed.
+bool PageArena::RemoveLiveObject() {
+  if (--stats_.live_objects != 0)
+    return false;
+  if (destroy_pending_)
+    return true;
+  if (release_pending_)
+    FreeChunks();
+  return false;
+}
+
+// Frees all the chunks and clears the free lists. Mutex must be held.
+void PageArena::FreeChunks() {
+  while (chunks_ != NULL) {
+    char* next = reinterpret_cast<ArenaChunkHeader*>(chunks_)->next;
+    SetArenaChunk(chunks_, false);
+    FreeAligned(chunks_);
+    chunks_ = next;
+  }
+  chunk_ptr_ = NULL;
+  chunk_end_ = NULL;
+  for (int i = 0; i < kNumSizeClasses; ++i)
+    free_lists_[i] = NULL;
+  while (free_packed_blocks_ != NULL) {
+    void* next = *static_cast<void**>(free_packed_blocks_);
+    FreeAligned(free_packed_blocks_);
+    free_packed_blocks_ = next;
+  }
+  stats_.reserved_bytes = 0;
+  release_pending_ = false;
+}
+
+}  // namespace tesseract.
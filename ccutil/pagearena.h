@@ -0,0 +1,186 @@
+///////////////////////////////////////////////////////////////////////
+// File:        pagearena.h
+// Description: Pooled allocator for the short-lived results of a page.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+///////////////////////////////////////////////////////////////////////
+
+#ifndef TESSERACT_CCUTIL_PAGEARENA_H__
+#define TESSERACT_CCUTIL_PAGEARENA_H__
+
+#include <stddef.h>
+#include "host.h"
+
+namespace tesseract {
+
+class CCUtilMutex;
+
+// Counts of the use of a PageArena since it was last released.
+struct PageArenaStats {
+  PageArenaStats()
+    : allocations(0), bytes(0), reserved_bytes(0), live_objects(0) {}
+
+  inT64 allocations;     // Number of objects allocated.
+  inT64 bytes;           // Total size of the objects allocated.
+  inT64 reserved_bytes;  // Size of the chunks held by the arena.
+  inT64 live_objects;    // Number of objects not yet deleted.
+};
+
+// Allocator for the objects that make up the results of a page, which are
+// created and destroyed in their hundreds of thousands and all go at once
+// when the page is cleared. Objects are carved from large chunks and freed
+// objects are kept on per-size free lists for reuse, so the heap sees a
+// handful of chunk allocations per page instead of one per object, and the
+// whole lot is given back in one go by Release.
+// Classes opt in with PAGE_ARENA_OPERATORS, which makes their operator new
+// allocate from the arena made current on the allocating thread by
+// PageArenaScope, or from the plain heap if there is none. Arena objects
+// carry no header: chunks are aligned to their size and the chunks in use
+// are kept in a map, so an object may be deleted at any time, whether or not
+// the arena is current, and objects that outlive the page keep their chunks
+// alive until they go.
+// Small objects that are made in runs and walked in the same order, such as
+// the points of an outline, can opt in with PAGE_ARENA_PACKED_OPERATORS
+// instead. Each thread then hands them out in turn from an aligned block of
+// kPackedBlockSize bytes, without a per-object header, and the block goes
+// back to the arena, or the heap, when its last object is deleted. The
+// block a thread is filling is closed when the current arena changes and
+// when the thread exits.
+class PageArena {
+ public:
+  PageArena();
+
+  // Returns the counts since the last Release.
+  PageArenaStats stats() const;
+
+  // Gives the chunks back to the heap, now if there are no live objects,
+  // otherwise as soon as the last of them is deleted, and resets the stats.
+  void Release();
+  // Deletes the arena, now if there are no live objects, otherwise when the
+  // last of them is deleted. Use instead of delete.
+  void Destroy();
+
+  // Allocates size bytes from the current arena, or the heap if none.
+  // Used by PAGE_ARENA_OPERATORS.
+  static void* New(size_t size);
+  // Frees memory of the given size allocated by New.
+  // Used by PAGE_ARENA_OPERATORS.
+  static void Delete(void* ptr, size_t size);
+
+  // Allocates size bytes next to the previous packed allocation of the
+  // calling thread, starting a new block if there is no room.
+  // Used by PAGE_ARENA_PACKED_OPERATORS.
+  static void* NewPacked(size_t size);
+  // Frees memory allocated by NewPacked.
+  // Used by PAGE_ARENA_PACKED_OPERATORS.
+  static void DeletePacked(void* ptr);
+  // Starts a new block for the calling thread if the one it is filling does
+  // not have room for size more bytes, so that a run of that many bytes of
+  // packed objects ends up in a single block. Runs bigger than a block are
+  // left to span blocks.
+  static void ReservePacked(size_t size);
+
+  // Returns the arena in use by the calling thread, or NULL.
+  static PageArena* current();
+  // Sets the arena in use by the calling thread. NULL to use the heap.
+  // Closes the thread's packed block if the arena changes, so that no block
+  // of one arena is filled while another is current.
+  static void set_current(PageArena* arena);
+
+ private:
+  // Use Destroy.
+  ~PageArena();
+
+  // Returns a block of the given size class.
+  void* Allocate(int size_class);
+  // Puts the block back on its free list. Returns true if the arena was
+  // destroyed as a result.
+  bool Free(void* block, int size_class);
+  // Returns a packed block, aligned to its size.
+  void* AllocatePackedBlock();
+  // Puts the packed block back on its free list. Returns true if the arena
+  // was destroyed as a result.
+  bool FreePackedBlock(void* block);
+  // Counts one live object less, freeing the chunks if a release is pending
+  // and it was the last. Returns true if the arena must now be destroyed.
+  // Mutex must be held.
+  bool RemoveLiveObject();
+  // Frees all the chunks and clears the free lists. Mutex must be held.
+  void FreeChunks();
+
+  // Starts a new packed block for the calling thread.
+  static void OpenPackedBlock();
+  // Drops the calling thread's reference to the block it is filling.
+  static void ClosePackedBlock();
+
+  // Guards everything below, as objects may be deleted on any thread.
+  CCUtilMutex* mutex_;
+  // Singly-linked list of chunks, linked through their first word.
+  char* chunks_;
+  // Unused part of the head chunk.
+  char* chunk_ptr_;
+  char* chunk_end_;
+  // Heads of the free lists, indexed by size class, linked through the
+  // first word of each free block.
+  void** free_lists_;
+  // Free packed blocks, linked through their first word.
+  void* free_packed_blocks_;
+  PageArenaStats stats_;
+  // Release or Destroy was called with live objects.
+  bool release_pending_;
+  bool destroy_pending_;
+};
+
+// Makes the given arena current on the calling thread for the life of the
+// scope, restoring the previous one afterwards. A NULL arena leaves the
+// current one as it is.
+class PageArenaScope {
+ public:
+  explicit PageArenaScope(PageArena* arena)
+    : previous_(PageArena::current()) {
+    if (arena != NULL)
+      PageArena::set_current(arena);
+  }
+  ~PageArenaScope() {
+    PageArena::set_current(previous_);
+  }
+
+ private:
+  PageArena* previous_;
+};
+
+}  // namespace tesseract.
+
+// Put in the public part of a class to allocate its objects from the
+// current PageArena. Arrays are left on the heap. Objects must be deleted
+// through a pointer to their own class, or to a base with a virtual
+// destructor, so that delete is given their real size.
+#define PAGE_ARENA_OPERATORS                                              \
+  static void* operator new(size_t size) {                                \
+    return tesseract::PageArena::New(size);                               \
+  }                                                                       \
+  static void operator delete(void* ptr, size_t size) {                   \
+    tesseract::PageArena::Delete(ptr, size);                              \
+  }
+
+// Put in the public part of a small class to pack its objects into blocks
+// from the current PageArena in the order they are made. Arrays are left on
+// the heap.
+#define PAGE_ARENA_PACKED_OPERATORS                                       \
+  static void* operator new(size_t size) {                                \
+    return tesseract::PageArena::NewPacked(size);                         \
+  }                                                                       \
+  static void operator delete(void* ptr) {                                \
+    tesseract::PageArena::DeletePacked(ptr);                              \
+  }
+
+#endif  // TESSERACT_CCUTIL_PAGEARENA_H__
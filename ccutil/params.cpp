@@ -185,6 +185,136 @@ bool ParamUtils::GetParamAsString(const char *name,
   return false;
 }
 
+// Hashes a param name for ParamIndex.
+static uinT32 HashParamName(const char *name) {
+  uinT32 hash = 2166136261U;
+  for (; *name != '\0'; ++name) {
+    hash ^= static_cast<unsigned char>(*name);
+    hash *= 16777619U;
+  }
+  return hash;
+}
+
+void ParamIndex::Add(Param *param) {
+  if ((num_used_ + 1) * 2 > table_.size())
+    Grow();
+  int mask = table_.size() - 1;
+  int slot = HashParamName(param->name_str()) & mask;
+  while (table_[slot] != NULL)
+    slot = (slot + 1) & mask;
+  table_[slot] = param;
+  ++num_used_;
+}
+
+void ParamIndex::Remove(Param *param) {
+  if (table_.empty()) return;
+  int mask = table_.size() - 1;
+  int slot = HashParamName(param->name_str()) & mask;
+  while (table_[slot] != param) {
+    if (table_[slot] == NULL) return;
+    slot = (slot + 1) & mask;
+  }
+  // Close the gap by moving back any later entries of the run that would
+  // no longer be found from their home slot.
+  table_[slot] = NULL;
+  --num_used_;
+  int next = slot;
+  while (true) {
+    next = (next + 1) & mask;
+    if (table_[next] == NULL) break;
+    int home = HashParamName(table_[next]->name_str()) & mask;
+    bool home_in_gap = slot <= next ? (home <= slot || home > next)
+                                    : (home <= slot && home > next);
+    if (home_in_gap) {
+      table_[slot] = table_[next];
+      table_[next] = NULL;
+      slot = next;
+    }
+  }
+}
+
+// Returns the param with the given name, or NULL if there is none.
+Param *ParamIndex::Find(const char *name) const {
+  if (table_.empty()) return NULL;
+  int mask = table_.size() - 1;
+  int slot = HashParamName(name) & mask;
+  while (table_[slot] != NULL) {
+    if (strcmp(table_[slot]->name_str(), name) == 0) return table_[slot];
+    slot = (slot + 1) & mask;
+  }
+  return NULL;
+}
+
+// Doubles the size of the table.
+void ParamIndex::Grow() {
+  GenericVector<Param *> old_table;
+  old_table.init_to_size(table_.size(), NULL);
+  for (int i = 0; i < table_.size(); ++i)
+    old_table[i] = table_[i];
+  int new_size = table_.empty() ? 64 : table_.size() * 2;
+  table_.init_to_size(new_size, NULL);
+  num_used_ = 0;
+  for (int i = 0; i < old_table.size(); ++i) {
+    if (old_table[i] != NULL)
+      Add(old_table[i]);
+  }
+}
+
+// Sets the named param as ParamUtils::SetParam does, first saving its value
+// if it was not already changed through this overlay.
+bool ParamsOverlay::SetParam(const char *name, const char *value,
+                             SetParamConstraint constraint) {
+  SavedParams params;
+  ParamsVectors *globals = GlobalParams();
+  params.int_param = ParamUtils::FindParam<IntParam>(
+      name, globals->int_params, member_params_->int_params);
+  params.bool_param = ParamUtils::FindParam<BoolParam>(
+      name, globals->bool_params, member_params_->bool_params);
+  params.string_param = ParamUtils::FindParam<StringParam>(
+      name, globals->string_params, member_params_->string_params);
+  params.double_param = ParamUtils::FindParam<DoubleParam>(
+      name, globals->double_params, member_params_->double_params);
+  if (params.int_param == NULL && params.bool_param == NULL &&
+      params.string_param == NULL && params.double_param == NULL)
+    return false;
+  bool already_saved = false;
+  for (int i = 0; i < saved_.size() && !already_saved; ++i) {
+    already_saved = saved_[i].int_param == params.int_param &&
+        saved_[i].bool_param == params.bool_param &&
+        saved_[i].string_param == params.string_param &&
+        saved_[i].double_param == params.double_param;
+  }
+  if (!already_saved) {
+    if (params.int_param != NULL)
+      params.int_value = *params.int_param;
+    if (params.bool_param != NULL)
+      params.bool_value = *params.bool_param;
+    if (params.string_param != NULL)
+      params.string_value = params.string_param->string();
+    if (params.double_param != NULL)
+      params.double_value = *params.double_param;
+    saved_.push_back(params);
+  }
+  return ParamUtils::SetParam(name, value, constraint, member_params_);
+}
+
+// Puts back the values replaced since construction or the last Revert,
+// most recent first.
+void ParamsOverlay::Revert() {
+  for (int i = saved_.size() - 1; i >= 0; --i) {
+    const SavedParams &params = saved_[i];
+    if (params.int_param != NULL)
+      params.int_param->set_value(params.int_value);
+    if (params.bool_param != NULL)
+      params.bool_param->set_value(params.bool_value);
+    if (params.string_param != NULL)
+      params.string_param->set_value(params.string_value);
+    if (params.double_param != NULL)
+      params.double_param->set_value(params.double_value);
+  }
+  saved_.clear();
+}
+
 void ParamUtils::PrintParams(FILE *fp, const ParamsVectors *member_params) {
   int v, i;
   int num_iterations = (member_params == NULL) ? 1 : 2;
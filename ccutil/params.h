@@ -27,6 +27,7 @@
 
 namespace tesseract {
 
+class Param;
 class IntParam;
 class BoolParam;
 class StringParam;
@@ -40,11 +41,60 @@ enum SetParamConstraint {
   SET_PARAM_CONSTRAINT_NON_INIT_ONLY,
 };
 
+// Hash table of params by name, for finding a param without comparing its
+// name with every other. Names are assumed to be unique within a table.
+class ParamIndex {
+ public:
+  ParamIndex() : num_used_(0) {}
+
+  void Add(Param *param);
+  void Remove(Param *param);
+  // Returns the param with the given name, or NULL if there is none.
+  Param *Find(const char *name) const;
+
+ private:
+  // Doubles the size of the table.
+  void Grow();
+
+  // Open addressing with linear probing. The size is 0 or a power of 2,
+  // and empty slots are NULL.
+  GenericVector<Param *> table_;
+  int num_used_;
+};
+
+// The params of one type, in order of construction, with an index by name.
+// Params add and remove themselves, so the vector must not be changed
+// directly.
+template<class T>
+class ParamsVector : public GenericVector<T *> {
+ public:
+  void Add(T *param) {
+    this->push_back(param);
+    index_.Add(param);
+  }
+  void Remove(T *param) {
+    for (int i = 0; i < this->size(); ++i) {
+      if ((*this)[i] == param) {
+        this->remove(i);
+        index_.Remove(param);
+        return;
+      }
+    }
+  }
+  // Returns the param with the given name, or NULL if there is none.
+  T *Find(const char *name) const {
+    return static_cast<T *>(index_.Find(name));
+  }
+
+ private:
+  ParamIndex index_;
+};
+
 struct ParamsVectors {
-  GenericVector<IntParam *> int_params;
-  GenericVector<BoolParam *> bool_params;
-  GenericVector<StringParam *> string_params;
-  GenericVector<DoubleParam *> double_params;
+  ParamsVector<IntParam> int_params;
+  ParamsVector<BoolParam> bool_params;
+  ParamsVector<StringParam> string_params;
+  ParamsVector<DoubleParam> double_params;
 };
 
 // Utility functions for working with Tesseract parameters.
@@ -75,26 +125,10 @@ class ParamUtils {
   // GlobalParams() or in the given member_params.
   template<class T>
   static T *FindParam(const char *name,
-                      const GenericVector<T *> &global_vec,
-                      const GenericVector<T *> &member_vec) {
-    int i;
-    for (i = 0; i < global_vec.size(); ++i) {
-      if (strcmp(global_vec[i]->name_str(), name) == 0) return global_vec[i];
-    }
-    for (i = 0; i < member_vec.size(); ++i) {
-      if (strcmp(member_vec[i]->name_str(), name) == 0) return member_vec[i];
-    }
-    return NULL;
-  }
-  // Removes the given pointer to the param from the given vector.
-  template<class T>
-  static void RemoveParam(T *param_ptr, GenericVector<T *> *vec) {
-    for (int i = 0; i < vec->size(); ++i) {
-      if ((*vec)[i] == param_ptr) {
-        vec->remove(i);
-        return;
-      }
-    }
+                      const ParamsVector<T> &global_vec,
+                      const ParamsVector<T> &member_vec) {
+    T *param = global_vec.Find(name);
+    return param != NULL ? param : member_vec.Find(name);
   }
   // Fetches the value of the named param as a STRING. Returns false if not
   // found.
@@ -143,16 +177,16 @@ class IntParam : public Param {
             ParamsVectors *vec) : Param(name, comment, init) {
     value_ = value;
     params_vec_ = &(vec->int_params);
-    vec->int_params.push_back(this);
+    vec->int_params.Add(this);
   }
-  ~IntParam() { ParamUtils::RemoveParam<IntParam>(this, params_vec_); }
+  ~IntParam() { params_vec_->Remove(this); }
   operator inT32() const { return value_; }
   void set_value(inT32 value) { value_ = value; }
 
  private:
   inT32 value_;
   // Pointer to the vector that contains this param (not owened by this class).
-  GenericVector<IntParam *> *params_vec_;
+  ParamsVector<IntParam> *params_vec_;
 };
 
 class BoolParam : public Param {
@@ -161,16 +195,16 @@ class BoolParam : public Param {
             ParamsVectors *vec) : Param(name, comment, init) {
     value_ = value;
     params_vec_ = &(vec->bool_params);
-    vec->bool_params.push_back(this);
+    vec->bool_params.Add(this);
   }
-  ~BoolParam() { ParamUtils::RemoveParam<BoolParam>(this, params_vec_); }
+  ~BoolParam() { params_vec_->Remove(this); }
   operator BOOL8() const { return value_; }
   void set_value(BOOL8 value) { value_ = value; }
 
  private:
   BOOL8 value_;
   // Pointer to the vector that contains this param (not owned by this class).
-  GenericVector<BoolParam *> *params_vec_;
+  ParamsVector<BoolParam> *params_vec_;
 };
 
 class StringParam : public Param {
@@ -180,9 +214,9 @@ class StringParam : public Param {
               ParamsVectors *vec) : Param(name, comment, init) {
     value_ = value;
     params_vec_ = &(vec->string_params);
-    vec->string_params.push_back(this);
+    vec->string_params.Add(this);
   }
-  ~StringParam() { ParamUtils::RemoveParam<StringParam>(this, params_vec_); }
+  ~StringParam() { params_vec_->Remove(this); }
   operator STRING &() { return value_; }
   const char *string() const { return value_.string(); }
   bool empty() { return value_.length() <= 0; }
@@ -191,7 +225,7 @@ class StringParam : public Param {
  private:
   STRING value_;
   // Pointer to the vector that contains this param (not owened by this class).
-  GenericVector<StringParam *> *params_vec_;
+  ParamsVector<StringParam> *params_vec_;
 };
 
 class DoubleParam : public Param {
@@ -200,16 +234,66 @@ class DoubleParam : public Param {
               bool init, ParamsVectors *vec) : Param(name, comment, init) {
     value_ = value;
     params_vec_ = &(vec->double_params);
-    vec->double_params.push_back(this);
+    vec->double_params.Add(this);
   }
-  ~DoubleParam() { ParamUtils::RemoveParam<DoubleParam>(this, params_vec_); }
+  ~DoubleParam() { params_vec_->Remove(this); }
   operator double() const { return value_; }
   void set_value(double value) { value_ = value; }
 
  private:
   double value_;
   // Pointer to the vector that contains this param (not owned by this class).
-  GenericVector<DoubleParam *> *params_vec_;
+  ParamsVector<DoubleParam> *params_vec_;
+};
+
+// Set of temporary changes to params, which keeps the values they replaced
+// so that they can all be put back in time proportional to the number of
+// changes, instead of by reading the configs again. The changes to member
+// params affect only the owner of member_params, but the changes to global
+// params are seen by every thread while they last.
+class ParamsOverlay {
+ public:
+  explicit ParamsOverlay(ParamsVectors *member_params)
+    : member_params_(member_params) {}
+  // Puts back the replaced values.
+  ~ParamsOverlay() {
+    Revert();
+  }
+
+  bool empty() const {
+    return saved_.empty();
+  }
+
+  // Sets the named param as ParamUtils::SetParam does, first saving its value
+  // if it was not already changed through this overlay.
+  // Returns false if there is no param of that name.
+  bool SetParam(const char *name, const char *value,
+                SetParamConstraint constraint);
+  // Puts back the values replaced since construction or the last Revert,
+  // most recent first.
+  void Revert();
+
+ private:
+  // The params of each type with a given name, and their values before
+  // the first change through this overlay.
+  struct SavedParams {
+    SavedParams()
+      : int_param(NULL), bool_param(NULL), string_param(NULL),
+        double_param(NULL), int_value(0), bool_value(false),
+        double_value(0.0) {}
+
+    IntParam *int_param;
+    BoolParam *bool_param;
+    StringParam *string_param;
+    DoubleParam *double_param;
+    inT32 int_value;
+    BOOL8 bool_value;
+    STRING string_value;
+    double double_value;
+  };
+
+  ParamsVectors *member_params_;
+  GenericVector<SavedParams> saved_;
 };
 
 }  // namespace tesseract
@@ -45,6 +45,13 @@ typedef struct _BLOB {
 #define SIGNED signed
 #endif
 
+// Storage class of a variable with a separate instance per thread.
+#ifdef _MSC_VER
+#define TESS_THREAD_LOCAL __declspec(thread)
+#else
+#define TESS_THREAD_LOCAL __thread
+#endif
+
 #if defined(_WIN32) || defined(__CYGWIN__)
     #if defined(TESS_EXPORTS)
        #define TESS_API __declspec(dllexport)
@@ -33,8 +33,8 @@ const int kMaxIntSize = 22;
  * including total capacity and how much used (strlen with '\0').
  *
  * The implementation hides this header at the start of the data
- * buffer and appends the string on the end to keep sizeof(STRING)
- * unchanged from earlier versions so serialization is not affected.
+ * buffer and appends the string on the end. The buffer is the inline_
+ * member for short strings and a heap block for longer ones.
  *
  * The collection of MACROS provide different implementations depending
  * on whether the string keeps track of its strlen or not so that this
@@ -45,7 +45,12 @@ const int kMaxIntSize = 22;
 const int kMinCapacity = 16;
 
 char* STRING::AllocData(int used, int capacity) {
-  data_ = (STRING_HEADER *)alloc_string(capacity + sizeof(STRING_HEADER));
+  if (capacity <= kInlineCapacity) {
+    data_ = &inline_.header;
+    capacity = kInlineCapacity;
+  } else {
+    data_ = (STRING_HEADER *)alloc_string(capacity + sizeof(STRING_HEADER));
+  }
 
   // header is the metadata for this memory block
   STRING_HEADER* header = GetHeader();
@@ -55,7 +60,8 @@ char* STRING::AllocData(int used, int capacity) {
 }
 
 void STRING::DiscardData() {
-  free_string((char *)data_);
+  if (!IsInline())
+    free_string((char *)data_);
 }
 
 // This is a private method; ensure FixHeader is called (or used_ is well defined)
@@ -125,6 +131,22 @@ STRING::~STRING() {
   DiscardData();
 }
 
+// Clears this, takes the contents of from without copying them if they
+// are on the heap, and leaves from empty.
+void STRING::move(STRING* from) {
+  if (from == this)
+    return;
+  if (from->IsInline()) {
+    *this = *from;
+  } else {
+    DiscardData();
+    data_ = from->data_;
+  }
+  // Empty STRINGs contain just the "\0".
+  memcpy(from->AllocData(1, kMinCapacity), "", 1);
+  assert(InvariantOk());
+}
+
 // Writes to the given file. Returns false in case of error.
 bool STRING::Serialize(FILE* fp) const {
   inT32 len = length();
@@ -36,6 +36,9 @@
 #define STRING_IS_PROTECTED  0
 
 template <typename T> class GenericVector;
+namespace tesseract {
+template <typename T> struct ElementRelocator;
+}  // namespace tesseract.
 
 class TESS_API STRING
 {
@@ -98,6 +101,10 @@ class TESS_API STRING
     // ensure capcaity but keep pointer encapsulated
     inline void ensure(inT32 min_capacity) { ensure_cstr(min_capacity); }
 
+    // Clears this, takes the contents of from without copying them if they
+    // are on the heap, and leaves from empty.
+    void move(STRING* from);
+
   private:
     typedef struct STRING_HEADER {
       // How much space was allocated in the string buffer for char data.
@@ -117,11 +124,26 @@ class TESS_API STRING
       mutable int used_;
     } STRING_HEADER;
 
-    // To preserve the behavior of the old serialization, we only have space
-    // for one pointer in this structure. So we are embedding a data structure
-    // at the start of the storage that will hold additional state variables,
-    // then storing the actual string contents immediately after.
+    // Strings that need no more than this many chars, including the '\0',
+    // are held in inline_ instead of on the heap.
+    static const int kInlineCapacity = 16;
+
+    // We are embedding a data structure at the start of the storage that will
+    // hold additional state variables, then storing the actual string
+    // contents immediately after. The storage is either inline_ or a heap
+    // block, so data_ is all that the rest of the code needs to look at.
     STRING_HEADER* data_;
+    // Storage for short strings, which are the vast majority, so they cost
+    // no heap allocation. The header is a member of the union to align it.
+    union {
+      STRING_HEADER header;
+      char storage[sizeof(STRING_HEADER) + kInlineCapacity];
+    } inline_;
+
+    // Returns true if the string is held in inline_.
+    inline bool IsInline() const {
+      return data_ == &inline_.header;
+    }
 
     // returns the header part of the storage
     inline STRING_HEADER* GetHeader() {
@@ -158,4 +180,18 @@ class TESS_API STRING
     char* AllocData(int used, int capacity);
     void DiscardData();
 };
+
+namespace tesseract {
+
+// Lets GenericVector<STRING> take over the heap blocks of its elements when
+// it grows, instead of copying them.
+template <>
+struct ElementRelocator<STRING> {
+  static void Relocate(STRING* src, STRING* dest, int count) {
+    for (int i = 0; i < count; ++i)
+      dest[i].move(&src[i]);
+  }
+};
+
+}  // namespace tesseract.
 #endif
@@ -32,41 +32,43 @@ UNICHARMAP::~UNICHARMAP() {
 }
 
 // Search the given unichar representation in the tree. Each character in the
-// string is interpreted as an index in an array of nodes.
+// string is interpreted as an index in an array of nodes. Stop once the tree
+// does not have anymore nodes or once we found the right unichar_repr.
 UNICHAR_ID UNICHARMAP::unichar_to_id(const char* const unichar_repr) const {
+  if (unichar_repr == NULL || *unichar_repr == '\0') return INVALID_UNICHAR_ID;
+
   const char* current_char = unichar_repr;
   UNICHARMAP_NODE* current_nodes = nodes;
 
-  assert(*unichar_repr != '\0');
-
-  do {
-    if (*(current_char + 1) == '\0')
-      return current_nodes[static_cast<unsigned char>(*current_char)].id;
+  while (current_nodes != 0 && *(current_char + 1) != '\0') {
     current_nodes =
         current_nodes[static_cast<unsigned char>(*current_char)].children;
     ++current_char;
-  } while (true);
+  }
+  if (current_nodes == 0) return INVALID_UNICHAR_ID;
+  return current_nodes[static_cast<unsigned char>(*current_char)].id;
 }
 
 // Search the given unichar representation in the tree, using length characters
 // from it maximum. Each character in the string is interpreted as an index in
-// an array of nodes.
+// an array of nodes. Stop once the tree does not have anymore nodes or once we
+// found the right unichar_repr.
 UNICHAR_ID UNICHARMAP::unichar_to_id(const char* const unichar_repr,
                                      int length) const {
+  if (unichar_repr == NULL || *unichar_repr == '\0') return INVALID_UNICHAR_ID;
+  if (length <= 0 || length > UNICHAR_LEN) return INVALID_UNICHAR_ID;
+
   const char* current_char = unichar_repr;
   UNICHARMAP_NODE* current_nodes = nodes;
 
-  assert(*unichar_repr != '\0');
-  assert(length > 0 && length <= UNICHAR_LEN);
-
-  do {
-    if (length == 1 || *(current_char + 1) == '\0')
-      return current_nodes[static_cast<unsigned char>(*current_char)].id;
+  while (current_nodes != 0 && (length > 1 && *(current_char + 1) != '\0')) {
     current_nodes =
         current_nodes[static_cast<unsigned char>(*current_char)].children;
     ++current_char;
     --length;
-  } while (true);
+  }
+  if (current_nodes == 0) return INVALID_UNICHAR_ID;
+  return current_nodes[static_cast<unsigned char>(*current_char)].id;
 }
 
 // Search the given unichar representation in the tree, creating the possibly
@@ -37,14 +37,12 @@ class UNICHARMAP {
   void insert(const char* const unichar_repr, UNICHAR_ID id);
 
   // Return the id associated with the given unichar representation,
-  // this representation MUST exist within the UNICHARMAP.
-  // The length of the representation MUST be non-zero.
+  // or INVALID_UNICHAR_ID if it is not present in the UNICHARMAP.
   UNICHAR_ID unichar_to_id(const char* const unichar_repr) const;
 
   // Return the id associated with the given unichar representation,
-  // this representation MUST exist within the UNICHARMAP. The first
-  // length characters (maximum) from unichar_repr are used. The length
-  // MUST be non-zero.
+  // or INVALID_UNICHAR_ID if it is not present in the UNICHARMAP. The first
+  // length characters (maximum) from unichar_repr are used.
   UNICHAR_ID unichar_to_id(const char* const unichar_repr, int length) const;
 
   // Return true if the given unichar representation is already present in the
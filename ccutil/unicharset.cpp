@@ -145,6 +145,9 @@ void UNICHARSET::UNICHAR_PROPERTIES::CopyFrom(const UNICHAR_PROPERTIES& src) {
 
 UNICHARSET::UNICHARSET() :
     unichars(NULL),
+    hot_flags(NULL),
+    hot_script_ids(NULL),
+    hot_other_cases(NULL),
     ids(),
     size_used(0),
     size_reserved(0),
@@ -168,21 +171,46 @@ void UNICHARSET::reserve(int unichars_number) {
     }
     delete[] unichars;
     unichars = unichars_new;
+    delete[] hot_flags;
+    hot_flags = new uinT8[unichars_number];
+    delete[] hot_script_ids;
+    hot_script_ids = new int[unichars_number];
+    delete[] hot_other_cases;
+    hot_other_cases = new UNICHAR_ID[unichars_number];
     size_reserved = unichars_number;
-  }
+    for (int k = 0; k < unichars_number; ++k)
+      update_hot_properties(k);
+  }
+}
+
+// Copies the hot properties of the given unichar from its slot.
+void UNICHARSET::update_hot_properties(UNICHAR_ID unichar_id) {
+  const UNICHAR_PROPERTIES& properties = unichars[unichar_id].properties;
+  uinT8 flags = 0;
+  if (properties.isalpha)
+    flags |= HOT_ISALPHA;
+  if (properties.islower)
+    flags |= HOT_ISLOWER;
+  if (properties.isupper)
+    flags |= HOT_ISUPPER;
+  if (properties.isdigit)
+    flags |= HOT_ISDIGIT;
+  if (properties.ispunctuation)
+    flags |= HOT_ISPUNCTUATION;
+  hot_flags[unichar_id] = flags;
+  hot_script_ids[unichar_id] = properties.script_id;
+  hot_other_cases[unichar_id] = properties.other_case;
 }
 
 const UNICHAR_ID
 UNICHARSET::unichar_to_id(const char* const unichar_repr) const {
-  return ids.contains(unichar_repr) ?
-    ids.unichar_to_id(unichar_repr) : INVALID_UNICHAR_ID;
+  return ids.unichar_to_id(unichar_repr);
 }
 
 const UNICHAR_ID UNICHARSET::unichar_to_id(const char* const unichar_repr,
                                            int length) const {
   assert(length > 0 && length <= UNICHAR_LEN);
-  return ids.contains(unichar_repr, length) ?
-    ids.unichar_to_id(unichar_repr, length) : INVALID_UNICHAR_ID;
+  return ids.unichar_to_id(unichar_repr, length);
 }
 
 // Return the minimum number of bytes that matches a legal UNICHAR_ID,
@@ -351,6 +379,7 @@ void UNICHARSET::SetPropertiesFromOther(const UNICHARSET& src) {
         properties.mirror = ch;
       }
       unichars[ch].properties.CopyFrom(properties);
+      update_hot_properties(ch);
     }
   }
 }
@@ -416,6 +445,7 @@ void UNICHARSET::AppendOtherUnicharset(const UNICHARSET& src) {
         // Mirror will have its ranges set later as it is contained in src.
       }
       unichars[id].properties.mirror = unichar_to_id(mirror_str);
+      update_hot_properties(id);
     }
   }
 }
@@ -535,6 +565,7 @@ void UNICHARSET::unichar_insert(const char* const unichar_repr) {
         this->get_script(frag->get_unichar());
     }
     this->unichars[size_used].properties.enabled = true;
+    update_hot_properties(size_used);
     ids.insert(unichar_repr, size_used);
     ++size_used;
   }
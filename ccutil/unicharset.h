@@ -243,6 +243,12 @@ class UNICHARSET {
       delete[] unichars;
       unichars = NULL;
     }
+    delete[] hot_flags;
+    hot_flags = NULL;
+    delete[] hot_script_ids;
+    hot_script_ids = NULL;
+    delete[] hot_other_cases;
+    hot_other_cases = NULL;
     script_table_size_reserved = 0;
     size_reserved = 0;
     size_used = 0;
@@ -335,26 +341,31 @@ class UNICHARSET {
   // Set the isalpha property of the given unichar to the given value.
   void set_isalpha(UNICHAR_ID unichar_id, bool value) {
     unichars[unichar_id].properties.isalpha = value;
+    update_hot_properties(unichar_id);
   }
 
   // Set the islower property of the given unichar to the given value.
   void set_islower(UNICHAR_ID unichar_id, bool value) {
     unichars[unichar_id].properties.islower = value;
+    update_hot_properties(unichar_id);
   }
 
   // Set the isupper property of the given unichar to the given value.
   void set_isupper(UNICHAR_ID unichar_id, bool value) {
     unichars[unichar_id].properties.isupper = value;
+    update_hot_properties(unichar_id);
   }
 
   // Set the isdigit property of the given unichar to the given value.
   void set_isdigit(UNICHAR_ID unichar_id, bool value) {
     unichars[unichar_id].properties.isdigit = value;
+    update_hot_properties(unichar_id);
   }
 
   // Set the ispunctuation property of the given unichar to the given value.
   void set_ispunctuation(UNICHAR_ID unichar_id, bool value) {
     unichars[unichar_id].properties.ispunctuation = value;
+    update_hot_properties(unichar_id);
   }
 
   // Set the isngram property of the given unichar to the given value.
@@ -366,11 +377,13 @@ class UNICHARSET {
   // Value is copied and thus can be a temporary;
   void set_script(UNICHAR_ID unichar_id, const char* value) {
     unichars[unichar_id].properties.script_id = add_script(value);
+    update_hot_properties(unichar_id);
   }
 
   // Set other_case unichar id in the properties for the given unichar id.
   void set_other_case(UNICHAR_ID unichar_id, UNICHAR_ID other_case) {
     unichars[unichar_id].properties.other_case = other_case;
+    update_hot_properties(unichar_id);
   }
 
   // Set the direction property of the given unichar to the given value.
@@ -392,35 +405,35 @@ class UNICHARSET {
   bool get_isalpha(UNICHAR_ID unichar_id) const {
     if (INVALID_UNICHAR_ID == unichar_id) return false;
     ASSERT_HOST(contains_unichar_id(unichar_id));
-    return unichars[unichar_id].properties.isalpha;
+    return (hot_flags[unichar_id] & HOT_ISALPHA) != 0;
   }
 
   // Return the islower property of the given unichar.
   bool get_islower(UNICHAR_ID unichar_id) const {
     if (INVALID_UNICHAR_ID == unichar_id) return false;
     ASSERT_HOST(contains_unichar_id(unichar_id));
-    return unichars[unichar_id].properties.islower;
+    return (hot_flags[unichar_id] & HOT_ISLOWER) != 0;
   }
 
   // Return the isupper property of the given unichar.
   bool get_isupper(UNICHAR_ID unichar_id) const {
     if (INVALID_UNICHAR_ID == unichar_id) return false;
     ASSERT_HOST(contains_unichar_id(unichar_id));
-    return unichars[unichar_id].properties.isupper;
+    return (hot_flags[unichar_id] & HOT_ISUPPER) != 0;
   }
 
   // Return the isdigit property of the given unichar.
   bool get_isdigit(UNICHAR_ID unichar_id) const {
     if (INVALID_UNICHAR_ID == unichar_id) return false;
     ASSERT_HOST(contains_unichar_id(unichar_id));
-    return unichars[unichar_id].properties.isdigit;
+    return (hot_flags[unichar_id] & HOT_ISDIGIT) != 0;
   }
 
   // Return the ispunctuation property of the given unichar.
   bool get_ispunctuation(UNICHAR_ID unichar_id) const {
     if (INVALID_UNICHAR_ID == unichar_id) return false;
     ASSERT_HOST(contains_unichar_id(unichar_id));
-    return unichars[unichar_id].properties.ispunctuation;
+    return (hot_flags[unichar_id] & HOT_ISPUNCTUATION) != 0;
   }
 
   // Return the isngram property of the given unichar.
@@ -552,7 +565,7 @@ class UNICHARSET {
   int get_script(UNICHAR_ID unichar_id) const {
     if (INVALID_UNICHAR_ID == unichar_id) return null_sid_;
     ASSERT_HOST(contains_unichar_id(unichar_id));
-    return unichars[unichar_id].properties.script_id;
+    return hot_script_ids[unichar_id];
   }
 
   // Return the character properties, eg. alpha/upper/lower/digit/punct,
@@ -572,7 +585,7 @@ class UNICHARSET {
   UNICHAR_ID get_other_case(UNICHAR_ID unichar_id) const {
     if (INVALID_UNICHAR_ID == unichar_id) return INVALID_UNICHAR_ID;
     ASSERT_HOST(contains_unichar_id(unichar_id));
-    return unichars[unichar_id].properties.other_case;
+    return hot_other_cases[unichar_id];
   }
 
   // Returns the direction property of the given unichar.
@@ -593,16 +606,16 @@ class UNICHARSET {
   UNICHAR_ID to_lower(UNICHAR_ID unichar_id) const {
     if (INVALID_UNICHAR_ID == unichar_id) return INVALID_UNICHAR_ID;
     ASSERT_HOST(contains_unichar_id(unichar_id));
-    if (unichars[unichar_id].properties.islower) return unichar_id;
-    return unichars[unichar_id].properties.other_case;
+    if (hot_flags[unichar_id] & HOT_ISLOWER) return unichar_id;
+    return hot_other_cases[unichar_id];
   }
 
   // Returns UNICHAR_ID of the corresponding upper-case unichar.
   UNICHAR_ID to_upper(UNICHAR_ID unichar_id) const {
     if (INVALID_UNICHAR_ID == unichar_id) return INVALID_UNICHAR_ID;
     ASSERT_HOST(contains_unichar_id(unichar_id));
-    if (unichars[unichar_id].properties.isupper) return unichar_id;
-    return unichars[unichar_id].properties.other_case;
+    if (hot_flags[unichar_id] & HOT_ISUPPER) return unichar_id;
+    return hot_other_cases[unichar_id];
   }
 
   // Return a pointer to the CHAR_FRAGMENT class if the given
@@ -658,10 +671,6 @@ class UNICHARSET {
   // Return a pointer to the CHAR_FRAGMENT class struct if the given
   // unichar representation represents a character fragment.
   const CHAR_FRAGMENT *get_fragment(const char* const unichar_repr) const {
-    if (unichar_repr == NULL || unichar_repr[0] == '\0' ||
-        !ids.contains(unichar_repr)) {
-      return NULL;
-    }
     return get_fragment(unichar_to_id(unichar_repr));
   }
 
@@ -850,7 +859,26 @@ class UNICHARSET {
   bool load_via_fgets(TessResultCallback2<char *, char *, int> *fgets_cb,
                       bool skip_fragments);
 
+  // Bits of hot_flags.
+  enum HotFlags {
+    HOT_ISALPHA = 0x1,
+    HOT_ISLOWER = 0x2,
+    HOT_ISUPPER = 0x4,
+    HOT_ISDIGIT = 0x8,
+    HOT_ISPUNCTUATION = 0x10
+  };
+
+  // Copies the hot properties of the given unichar from its slot.
+  void update_hot_properties(UNICHAR_ID unichar_id);
+
   UNICHAR_SLOT* unichars;
+  // Copies of the properties most used by the language model, with an array
+  // per property, parallel to unichars. A lookup in the inner loops then
+  // touches a byte or an int instead of a whole UNICHAR_SLOT. Only the
+  // setters and update_hot_properties may write them.
+  uinT8* hot_flags;
+  int* hot_script_ids;
+  UNICHAR_ID* hot_other_cases;
   UNICHARMAP ids;
   int size_used;
   int size_reserved;
@@ -113,6 +113,7 @@ struct ADAPT_RESULTS {
 };
 
 struct PROTO_KEY {
+  tesseract::Classify *classify;  // Owner of the pruner parameters.
   ADAPT_TEMPLATES Templates;
   CLASS_ID ClassId;
   int ConfigId;
@@ -201,8 +202,8 @@ void Classify::AdaptiveClassifier(TBLOB *Blob,
     PrintAdaptiveMatchResults(stdout, Results);
   }
 
-  if (LargeSpeckle(Blob))
-    AddLargeSpeckleTo(Choices);
+  if (LargeSpeckle(Blob, speckle_large_max_size))
+    AddLargeSpeckleTo(Choices, speckle_small_certainty, speckle_large_penalty);
 
 #ifndef GRAPHICS_DISABLED
   if (classify_enable_adaptive_debugger)
@@ -435,7 +436,8 @@ void Classify::LearnPieces(const char* filename, int start, int length,
     tess_bn_matching.set_value(false);    // turn it off
     tess_cn_matching.set_value(false);
     LearnBlob(feature_defs_, filename, rotated_blob, *denorm,
-              correct_text);
+              GetFeatureExtParams(), correct_text,
+              classify_font_name.string());
   } else if (unicharset.contains_unichar(correct_text)) {
     UNICHAR_ID class_id = unicharset.unichar_to_id(correct_text);
     int font_id = word->fontinfo != NULL
@@ -1681,6 +1683,9 @@ void Classify::ConvertMatchesToChoices(const DENORM& denorm, const TBOX& box,
   BLOB_CHOICE_IT temp_it;
   bool contains_nonfrag = false;
   temp_it.set_to_list(Choices);
+  // Length of Choices before any are added, as the list doesn't keep its
+  // length and counting it for every match is quadratic.
+  int initial_length = temp_it.length();
   int choices_length = 0;
   // With no shape_table_ maintain the previous MAX_MATCHES as the maximum
   // number of returned results, but with a shape_table_ we want to have room
@@ -1700,7 +1705,7 @@ void Classify::ConvertMatchesToChoices(const DENORM& denorm, const TBOX& box,
     int fontinfo_id2 = next.fontinfo_id2;
     bool adapted = next.adapted;
     bool current_is_frag = (unicharset.get_fragment(next.unichar_id) != NULL);
-    if (temp_it.length()+1 == max_matches &&
+    if (initial_length + choices_length + 1 == max_matches &&
         !contains_nonfrag && current_is_frag) {
       continue;  // look for a non-fragmented character to fill the
                  // last spot in Choices if only fragments are present
@@ -1964,7 +1969,8 @@ int Classify::GetBaselineFeatures(TBLOB *Blob,
 
   if (!FeaturesHaveBeenExtracted) {
     FeaturesOK = ExtractIntFeat(Blob, denorm, BaselineFeatures,
-                                CharNormFeatures, &FXInfo, NULL);
+                                CharNormFeatures, &FXInfo,
+                                GetRadiusLimits(), NULL);
     FeaturesHaveBeenExtracted = TRUE;
   }
 
@@ -2058,7 +2064,7 @@ int Classify::GetCharNormFeatures(TBLOB *Blob,
   if (!FeaturesHaveBeenExtracted) {
     FeaturesOK = ExtractIntFeat(Blob, denorm, BaselineFeatures,
                                 CharNormFeatures, &FXInfo,
-                                FeatureOutlineIndex);
+                                GetRadiusLimits(), FeatureOutlineIndex);
     FeaturesHaveBeenExtracted = TRUE;
   }
 
@@ -2347,6 +2353,7 @@ void Classify::MakePermanent(ADAPT_TEMPLATES Templates,
 
   // Free memory associated with temporary config (since ADAPTED_CONFIG
   // is a union we need to clean up before we record permanent config).
+  ProtoKey.classify = this;
   ProtoKey.Templates = Templates;
   ProtoKey.ClassId = ClassId;
   ProtoKey.ConfigId = ConfigId;
@@ -2401,8 +2408,9 @@ int MakeTempProtoPerm(void *item1, void *item2) {
     return FALSE;
 
   MakeProtoPermanent(Class, TempProto->ProtoId);
-  AddProtoToClassPruner(&(TempProto->Proto), ProtoKey->ClassId,
-                         ProtoKey->Templates->Templates);
+  ProtoKey->classify->AddProtoToClassPruner(&(TempProto->Proto),
+                                            ProtoKey->ClassId,
+                                            ProtoKey->Templates->Templates);
   FreeTempProto(TempProto);
 
   return TRUE;
@@ -2588,9 +2596,8 @@ void Classify::ShowBestMatchFor(TBLOB *Blob,
   INT_RESULT_STRUCT CNResult, BLResult;
   inT32 BlobLength;
   uinT32 ConfigMask;
-  static int next_config = -1;
 
-  if (PreTrainedOn) next_config = -1;
+  if (PreTrainedOn) next_config_ = -1;
 
   CNResult.Rating = BLResult.Rating = 2.0;
 
@@ -2667,12 +2674,12 @@ void Classify::ShowBestMatchFor(TBLOB *Blob,
 
   tprintf("\n");
   if (BLResult.Rating < CNResult.Rating) {
-    if (next_config < 0) {
+    if (next_config_ < 0) {
       ConfigMask = 1 << BLResult.Config;
-      next_config = 0;
+      next_config_ = 0;
     } else {
-      ConfigMask = 1 << next_config;
-      ++next_config;
+      ConfigMask = 1 << next_config_;
+      ++next_config_;
     }
     classify_norm_method.set_value(baseline);
 
@@ -33,10 +33,7 @@
 #define MAXFILENAME             80
 #define MAXMATCHES              10
 
-static const char kUnknownFontName[] = "UnknownFont";
-
-STRING_VAR(classify_font_name, kUnknownFontName,
-           "Default font name to be used in training");
+const char kUnknownFontName[] = "UnknownFont";
 
 /**----------------------------------------------------------------------------
         Global Data Definitions and Declarations
@@ -50,17 +47,18 @@ extern char imagefile[];
 
 /*---------------------------------------------------------------------------*/
 void LearnBlob(const FEATURE_DEFS_STRUCT &FeatureDefs, const STRING& filename,
-               TBLOB * Blob, const DENORM& denorm, const char* BlobText) {
+               TBLOB * Blob, const DENORM& denorm,
+               const FEATURE_EXT_PARAMS& fx_params,
+               const char* BlobText, const char* FontName) {
 /*
  **      Parameters:
  **              Blob            blob whose micro-features are to be learned
  **              Row             row of text that blob came from
  **              BlobText        text that corresponds to blob
- **              TextLength      number of characters in blob
+ **              FontName        name of font currently being trained on,
+ **                              or kUnknownFontName to take it from filename
  **      Globals:
  **              imagefile       base filename of the page being learned
- **              classify_font_name
- **                              name of font currently being trained on
  **      Operation:
  **              Extract micro-features from the specified blob and append
  **              them to the appropriate file.
@@ -73,7 +71,7 @@ void LearnBlob(const FEATURE_DEFS_STRUCT &FeatureDefs, const STRING& filename,
   STRING Filename(filename);
 
   // If no fontname was set, try to extract it from the filename
-  STRING CurrFontName = classify_font_name;
+  STRING CurrFontName = FontName;
   if (CurrFontName == kUnknownFontName) {
     // filename is expected to be of the form [lang].[fontname].exp[num]
     // The [lang], [fontname] and [num] fields should not have '.' characters.
@@ -95,18 +93,19 @@ void LearnBlob(const FEATURE_DEFS_STRUCT &FeatureDefs, const STRING& filename,
     cprintf("TRAINING ... Font name = %s\n", CurrFontName.string());
   }
 
-  LearnBlob(FeatureDefs, FeatureFile, Blob, denorm, BlobText,
+  LearnBlob(FeatureDefs, FeatureFile, Blob, denorm, fx_params, BlobText,
             CurrFontName.string());
 }                                // LearnBlob
 
 void LearnBlob(const FEATURE_DEFS_STRUCT &FeatureDefs, FILE* FeatureFile,
                TBLOB* Blob, const DENORM& denorm,
+               const FEATURE_EXT_PARAMS& fx_params,
                const char* BlobText, const char* FontName) {
   CHAR_DESC CharDesc;
 
   ASSERT_HOST(FeatureFile != NULL);
 
-  CharDesc = ExtractBlobFeatures(FeatureDefs, denorm, Blob);
+  CharDesc = ExtractBlobFeatures(FeatureDefs, denorm, Blob, fx_params);
   if (CharDesc == NULL) {
     cprintf("LearnBLob: CharDesc was NULL. Aborting.\n");
     return;
@@ -25,6 +25,10 @@
 #include "oldlist.h"
 #include "blobs.h"
 
+// Font name given to LearnBlob when the font is not known, so that it takes
+// the font name from the filename instead.
+extern const char kUnknownFontName[];
+
 /*---------------------------------------------------------------------------
           Macros
 ----------------------------------------------------------------------------*/
@@ -40,11 +44,14 @@
           Public Function Prototypes
 ----------------------------------------------------------------------------**/
 void LearnBlob(const FEATURE_DEFS_STRUCT &FeatureDefs, const STRING& filename,
-               TBLOB * Blob, const DENORM& denorm, const char* BlobText);
+               TBLOB * Blob, const DENORM& denorm,
+               const FEATURE_EXT_PARAMS& fx_params,
+               const char* BlobText, const char* FontName);
 
 void LearnBlob(const FEATURE_DEFS_STRUCT &FeatureDefs, FILE* File, TBLOB* Blob,
-               const DENORM& denorm, const char* BlobText,
-               const char* FontName);
+               const DENORM& denorm,
+               const FEATURE_EXT_PARAMS& fx_params,
+               const char* BlobText, const char* FontName);
 
 /**----------------------------------------------------------------------------
         Global Data Definitions and Declarations
@@ -22,6 +22,7 @@
 #endif
 
 #include "classify.h"
+#include "blobclass.h"
 #include "fontinfo.h"
 #include "intproto.h"
 #include "mfoutline.h"
@@ -128,6 +129,68 @@ Classify::Classify()
                "Class Pruner CutoffStrength:         ", this->params()),
     INT_MEMBER(classify_integer_matcher_multiplier, 14,
                "Integer Matcher Multiplier  0-255:   ", this->params()),
+    INT_MEMBER(classify_num_cp_levels, 3, "Number of Class Pruner Levels",
+               this->params()),
+    double_MEMBER(classify_cp_angle_pad_loose, 45.0,
+                  "Class Pruner Angle Pad Loose", this->params()),
+    double_MEMBER(classify_cp_angle_pad_medium, 20.0,
+                  "Class Pruner Angle Pad Medium", this->params()),
+    double_MEMBER(classify_cp_angle_pad_tight, 10.0,
+                  "CLass Pruner Angle Pad Tight", this->params()),
+    double_MEMBER(classify_cp_end_pad_loose, 0.5, "Class Pruner End Pad Loose",
+                  this->params()),
+    double_MEMBER(classify_cp_end_pad_medium, 0.5,
+                  "Class Pruner End Pad Medium", this->params()),
+    double_MEMBER(classify_cp_end_pad_tight, 0.5, "Class Pruner End Pad Tight",
+                  this->params()),
+    double_MEMBER(classify_cp_side_pad_loose, 2.5,
+                  "Class Pruner Side Pad Loose", this->params()),
+    double_MEMBER(classify_cp_side_pad_medium, 1.2,
+                  "Class Pruner Side Pad Medium", this->params()),
+    double_MEMBER(classify_cp_side_pad_tight, 0.6,
+                  "Class Pruner Side Pad Tight", this->params()),
+    double_MEMBER(classify_pp_angle_pad, 45.0, "Proto Pruner Angle Pad",
+                  this->params()),
+    double_MEMBER(classify_pp_end_pad, 0.5, "Proto Prune End Pad",
+                  this->params()),
+    double_MEMBER(classify_pp_side_pad, 2.5, "Proto Pruner Side Pad",
+                  this->params()),
+    INT_MEMBER(classify_radius_gyr_min_man, 255,
+               "Minimum Radius of Gyration Mantissa 0-255:        ",
+               this->params()),
+    INT_MEMBER(classify_radius_gyr_min_exp, 0,
+               "Minimum Radius of Gyration Exponent 0-255:        ",
+               this->params()),
+    INT_MEMBER(classify_radius_gyr_max_man, 158,
+               "Maximum Radius of Gyration Mantissa 0-255:        ",
+               this->params()),
+    INT_MEMBER(classify_radius_gyr_max_exp, 8,
+               "Maximum Radius of Gyration Exponent 0-255:        ",
+               this->params()),
+    double_MEMBER(classify_norm_adj_midpoint, 32.0, "Norm adjust midpoint ...",
+                  this->params()),
+    double_MEMBER(classify_norm_adj_curl, 2.0, "Norm adjust curl ...",
+                  this->params()),
+    double_MEMBER(classify_pico_feature_length, 0.05, "Pico Feature Length",
+                  this->params()),
+    double_MEMBER(speckle_large_max_size, 0.30, "Max large speckle size",
+                  this->params()),
+    double_MEMBER(speckle_small_penalty, 10.0, "Small speckle penalty",
+                  this->params()),
+    double_MEMBER(speckle_large_penalty, 10.0, "Large speckle penalty",
+                  this->params()),
+    double_MEMBER(speckle_small_certainty, -1.0, "Small speckle certainty",
+                  this->params()),
+    double_MEMBER(classify_min_slope, 0.414213562,
+                  "Slope below which lines are called horizontal",
+                  this->params()),
+    double_MEMBER(classify_max_slope, 2.414213562,
+                  "Slope above which lines are called vertical",
+                  this->params()),
+    STRING_MEMBER(classify_font_name, kUnknownFontName,
+                  "Default font name to be used in training", this->params()),
+    STRING_MEMBER(classify_training_file, "MicroFeatures", "Training file",
+                  this->params()),
     EnableLearning(true),
     INT_MEMBER(il1_adaption_test, 0, "Dont adapt to i/I at beginning of word",
                this->params()),
@@ -170,6 +233,7 @@ Classify::Classify()
   learn_debug_win_ = NULL;
   learn_fragmented_word_debug_win_ = NULL;
   learn_fragments_debug_win_ = NULL;
+  next_config_ = -1;
 
   CharNormCutoffs = new uinT16[MAX_NUM_CLASSES];
   BaselineCutoffs = new uinT16[MAX_NUM_CLASSES];
@@ -184,4 +248,25 @@ Classify::~Classify() {
   delete[] BaselineCutoffs;
 }
 
+// Returns the radius of gyration limits for ExtractIntFeat, taken from the
+// classify_radius_gyr_* params of this engine.
+INT_FX_RADIUS_LIMITS Classify::GetRadiusLimits() const {
+  INT_FX_RADIUS_LIMITS limits;
+  limits.MinMan = static_cast<uinT8>(classify_radius_gyr_min_man);
+  limits.MinExp = static_cast<uinT8>(classify_radius_gyr_min_exp);
+  limits.MaxMan = static_cast<uinT8>(classify_radius_gyr_max_man);
+  limits.MaxExp = static_cast<uinT8>(classify_radius_gyr_max_exp);
+  return limits;
+}
+
+// Returns the params for the feature extractors called through FX_FUNC,
+// taken from the params of this engine.
+FEATURE_EXT_PARAMS Classify::GetFeatureExtParams() const {
+  FEATURE_EXT_PARAMS fx_params;
+  fx_params.RadiusLimits = GetRadiusLimits();
+  fx_params.MinSlope = static_cast<FLOAT32>(classify_min_slope);
+  fx_params.MaxSlope = static_cast<FLOAT32>(classify_max_slope);
+  return fx_params;
+}
+
 }  // namespace tesseract
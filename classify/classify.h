@@ -22,6 +22,7 @@
 #include "adaptive.h"
 #include "ccstruct.h"
 #include "classify.h"
+#include "cluster.h"
 #include "dict.h"
 #include "featdefs.h"
 #include "fontinfo.h"
@@ -98,6 +99,9 @@ class Classify : public CCStruct {
   /* normmatch.cpp ************************************************************/
   FLOAT32 ComputeNormMatch(CLASS_ID ClassId,
                            const FEATURE_STRUCT& feature, BOOL8 DebugMatch);
+  double NormEvidenceOf(register double NormAdj) const;
+  void PrintNormMatch(FILE *File, int NumParams, PROTOTYPE *Proto,
+                      FEATURE Feature) const;
   void FreeNormProtos();
   NORM_PROTOS *ReadNormProtos(FILE *File, inT64 end_offset);
   /* protos.cpp ***************************************************************/
@@ -105,6 +109,21 @@ class Classify : public CCStruct {
   void ConvertProto(PROTO Proto, int ProtoId, INT_CLASS Class);
   INT_TEMPLATES CreateIntTemplates(CLASSES FloatProtos,
                                    const UNICHARSET& target_unicharset);
+  /* intproto.cpp *************************************************************/
+  void AddProtoToClassPruner(PROTO Proto, CLASS_ID ClassId,
+                             INT_TEMPLATES Templates);
+  void AddProtoToProtoPruner(PROTO Proto, int ProtoId,
+                             INT_CLASS Class, bool debug);
+  // Copies the class pruner pads for the given "tightness" level into
+  // EndPad, SidePad and AnglePad.
+  void GetCPPadsForLevel(int Level, FLOAT32 *EndPad, FLOAT32 *SidePad,
+                         FLOAT32 *AnglePad);
+  // Returns the radius of gyration limits for ExtractIntFeat, taken from the
+  // classify_radius_gyr_* params of this engine.
+  INT_FX_RADIUS_LIMITS GetRadiusLimits() const;
+  // Returns the params for the feature extractors called through FX_FUNC,
+  // taken from the params of this engine.
+  FEATURE_EXT_PARAMS GetFeatureExtParams() const;
   /* adaptmatch.cpp ***********************************************************/
 
   // Learn the given word using its chopped_word, seam_array, denorm,
@@ -424,6 +443,55 @@ class Classify : public CCStruct {
             "Class Pruner CutoffStrength:         ");
   INT_VAR_H(classify_integer_matcher_multiplier, 14,
             "Integer Matcher Multiplier  0-255:   ");
+  /* intproto.cpp ************************************************************/
+  INT_VAR_H(classify_num_cp_levels, 3, "Number of Class Pruner Levels");
+  double_VAR_H(classify_cp_angle_pad_loose, 45.0,
+               "Class Pruner Angle Pad Loose");
+  double_VAR_H(classify_cp_angle_pad_medium, 20.0,
+               "Class Pruner Angle Pad Medium");
+  double_VAR_H(classify_cp_angle_pad_tight, 10.0,
+               "CLass Pruner Angle Pad Tight");
+  double_VAR_H(classify_cp_end_pad_loose, 0.5, "Class Pruner End Pad Loose");
+  double_VAR_H(classify_cp_end_pad_medium, 0.5, "Class Pruner End Pad Medium");
+  double_VAR_H(classify_cp_end_pad_tight, 0.5, "Class Pruner End Pad Tight");
+  double_VAR_H(classify_cp_side_pad_loose, 2.5, "Class Pruner Side Pad Loose");
+  double_VAR_H(classify_cp_side_pad_medium, 1.2,
+               "Class Pruner Side Pad Medium");
+  double_VAR_H(classify_cp_side_pad_tight, 0.6, "Class Pruner Side Pad Tight");
+  double_VAR_H(classify_pp_angle_pad, 45.0, "Proto Pruner Angle Pad");
+  double_VAR_H(classify_pp_end_pad, 0.5, "Proto Prune End Pad");
+  double_VAR_H(classify_pp_side_pad, 2.5, "Proto Pruner Side Pad");
+  INT_VAR_H(classify_radius_gyr_min_man, 255,
+            "Minimum Radius of Gyration Mantissa 0-255:        ");
+  INT_VAR_H(classify_radius_gyr_min_exp, 0,
+            "Minimum Radius of Gyration Exponent 0-255:        ");
+  INT_VAR_H(classify_radius_gyr_max_man, 158,
+            "Maximum Radius of Gyration Mantissa 0-255:        ");
+  INT_VAR_H(classify_radius_gyr_max_exp, 8,
+            "Maximum Radius of Gyration Exponent 0-255:        ");
+  /* normmatch.cpp ***********************************************************/
+  /* control knobs used to control the normalization adjustment process */
+  double_VAR_H(classify_norm_adj_midpoint, 32.0, "Norm adjust midpoint ...");
+  double_VAR_H(classify_norm_adj_curl, 2.0, "Norm adjust curl ...");
+  /* picofeat.cpp ************************************************************/
+  double_VAR_H(classify_pico_feature_length, 0.05, "Pico Feature Length");
+  /* speckle.cpp *************************************************************/
+  /* define control knobs for adjusting definition of speckle */
+  double_VAR_H(speckle_large_max_size, 0.30, "Max large speckle size");
+  double_VAR_H(speckle_small_penalty, 10.0, "Small speckle penalty");
+  double_VAR_H(speckle_large_penalty, 10.0, "Large speckle penalty");
+  double_VAR_H(speckle_small_certainty, -1.0, "Small speckle certainty");
+  /* mfx.cpp *****************************************************************/
+  /* old numbers corresponded to 10.0 degrees and 80.0 degrees */
+  double_VAR_H(classify_min_slope, 0.414213562,
+               "Slope below which lines are called horizontal");
+  double_VAR_H(classify_max_slope, 2.414213562,
+               "Slope above which lines are called vertical");
+  /* blobclass.cpp ***********************************************************/
+  STRING_VAR_H(classify_font_name, kUnknownFontName,
+               "Default font name to be used in training");
+  /* protos.cpp **************************************************************/
+  STRING_VAR_H(classify_training_file, "MicroFeatures", "Training file");
 
   // Use class variables to hold onto built-in templates and adapted templates.
   INT_TEMPLATES PreTrainedTemplates;
@@ -504,6 +572,8 @@ class Classify : public CCStruct {
   ScrollView* learn_debug_win_;
   ScrollView* learn_fragmented_word_debug_win_;
   ScrollView* learn_fragments_debug_win_;
+  // Adapted config shown next by ShowBestMatchFor, or -1 to show the best.
+  int next_config_;
 };
 }  // namespace tesseract
 
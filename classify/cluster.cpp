@@ -188,7 +188,7 @@ struct CHISTRUCT{
   FLOAT64 ChiSquared;
 };
 
-// For use with KDWalk / MakePotentialClusters
+// For use with MakePotentialClusters
 struct ClusteringContext {
   HEAP *heap;  // heap used to hold temp clusters, "best" on top
   TEMPCLUSTER *candidates;  // array of potential clusters
@@ -237,8 +237,8 @@ static const uinT16 kBucketsTable[LOOKUPTABLESIZE] = {
 --------------------------------------------------------------------------*/
 void CreateClusterTree(CLUSTERER *Clusterer);
 
-void MakePotentialClusters(ClusteringContext *context, CLUSTER *Cluster,
-                           inT32 Level);
+void MakePotentialClusters(ClusteringContext *context, CLUSTER **Clusters,
+                           inT32 NumClusters);
 
 CLUSTER *FindNearestNeighbor(KDTREE *Tree,
                              CLUSTER *Cluster,
@@ -422,12 +422,16 @@ MakeClusterer (inT16 SampleSize, const PARAM_DESC ParamDesc[]) {
 
   // allocate a kd tree to hold the samples
   Clusterer->KDTree = MakeKDTree (SampleSize, ParamDesc);
+  Clusterer->PendingSamples = NULL;
+  Clusterer->MaxPendingSamples = 0;
 
   // Initialize cache of histogram buckets to minimize recomputing them.
   for (int d = 0; d < DISTRIBUTION_COUNT; ++d) {
     for (int c = 0; c < MAXBUCKETS + 1 - MINBUCKETS; ++c)
       Clusterer->bucket_cache[d][c] = NULL;
   }
+  Clusterer->CharFlags = NULL;
+  Clusterer->NumCharFlags = 0;
 
   return Clusterer;
 }                                // MakeClusterer
@@ -471,9 +475,16 @@ SAMPLE* MakeSample(CLUSTERER * Clusterer, const FLOAT32* Feature,
   for (i = 0; i < Clusterer->SampleSize; i++)
     Sample->Mean[i] = Feature[i];
 
-  // add the sample to the KD tree - keep track of the total # of samples
-  Clusterer->NumberOfSamples++;
-  KDStore (Clusterer->KDTree, Sample->Mean, (char *) Sample);
+  // queue the sample for the KD tree - keep track of the total # of samples
+  // the tree is bulk built from the queue when clustering starts
+  if (Clusterer->NumberOfSamples >= Clusterer->MaxPendingSamples) {
+    Clusterer->MaxPendingSamples =
+      Clusterer->MaxPendingSamples > 0 ? Clusterer->MaxPendingSamples * 2 : 64;
+    Clusterer->PendingSamples = (SAMPLE **) Erealloc (
+      Clusterer->PendingSamples,
+      Clusterer->MaxPendingSamples * sizeof (SAMPLE *));
+  }
+  Clusterer->PendingSamples[Clusterer->NumberOfSamples++] = Sample;
   if (CharID >= Clusterer->NumChar)
     Clusterer->NumChar = CharID + 1;
 
@@ -534,6 +545,8 @@ void FreeClusterer(CLUSTERER *Clusterer) {
     memfree (Clusterer->ParamDesc);
     if (Clusterer->KDTree != NULL)
       FreeKDTree (Clusterer->KDTree);
+    if (Clusterer->PendingSamples != NULL)
+      memfree (Clusterer->PendingSamples);
     if (Clusterer->Root != NULL)
       FreeCluster (Clusterer->Root);
     // Free up all used buckets structures.
@@ -542,6 +555,8 @@ void FreeClusterer(CLUSTERER *Clusterer) {
         if (Clusterer->bucket_cache[d][c] != NULL)
           FreeBuckets(Clusterer->bucket_cache[d][c]);
     }
+    if (Clusterer->CharFlags != NULL)
+      memfree(Clusterer->CharFlags);
 
     memfree(Clusterer);
   }
@@ -695,15 +710,27 @@ void CreateClusterTree(CLUSTERER *Clusterer) {
   ClusteringContext context;
   HEAPENTRY HeapEntry;
   TEMPCLUSTER *PotentialCluster;
+  inT32 NumSamples = Clusterer->NumberOfSamples;
+
+  // build a balanced kd-tree from all of the samples in one go
+  FLOAT32 **Keys = (FLOAT32 **) Emalloc(NumSamples * sizeof(FLOAT32 *));
+  for (int i = 0; i < NumSamples; i++)
+    Keys[i] = Clusterer->PendingSamples[i]->Mean;
+  KDBulkStore(Clusterer->KDTree, NumSamples, Keys,
+              (void **) Clusterer->PendingSamples);
+  memfree(Keys);
 
   // each sample and its nearest neighbor form a "potential" cluster
   // save these in a heap with the "best" potential clusters on top
   context.tree = Clusterer->KDTree;
   context.candidates = (TEMPCLUSTER *)
-    Emalloc(Clusterer->NumberOfSamples * sizeof(TEMPCLUSTER));
+    Emalloc(NumSamples * sizeof(TEMPCLUSTER));
   context.next = 0;
-  context.heap = MakeHeap(Clusterer->NumberOfSamples);
-  KDWalk(context.tree, (void_proc)MakePotentialClusters, &context);
+  context.heap = MakeHeap(NumSamples);
+  MakePotentialClusters(&context, Clusterer->PendingSamples, NumSamples);
+  memfree(Clusterer->PendingSamples);
+  Clusterer->PendingSamples = NULL;
+  Clusterer->MaxPendingSamples = 0;
 
   // form potential clusters into actual clusters - always do "best" first
   while (GetTopOfHeap(context.heap, &HeapEntry) != EMPTY) {
@@ -753,28 +780,43 @@ void CreateClusterTree(CLUSTERER *Clusterer) {
 /** MakePotentialClusters **************************************************
   Parameters:
       context  ClusteringContext (see definition above)
-      Cluster  current cluster being visited in kd-tree walk
-      Level  level of this cluster in the kd-tree
+      Clusters  clusters in the kd-tree to make potential clusters for
+      NumClusters  number of entries in Clusters
   Operation:
-      This routine is designed to be used in concert with the
-      KDWalk routine.  It will create a potential cluster for
-      each sample in the kd-tree that is being walked.  This
-      potential cluster will then be pushed on the heap.
+      This routine creates a potential cluster for each of the
+      given clusters by pairing it with its nearest neighbor in
+      the kd-tree, and pushes each potential cluster on the heap.
+      The kd-tree is only read while the neighbors are found, so
+      the searches run in parallel; the heap is filled afterwards
+      in the order of Clusters so the result does not depend on
+      the number of threads.
 ******************************************************************************/
 void MakePotentialClusters(ClusteringContext *context,
-                           CLUSTER *Cluster, inT32 Level) {
+                           CLUSTER **Clusters, inT32 NumClusters) {
   HEAPENTRY HeapEntry;
-  int next = context->next;
-  context->candidates[next].Cluster = Cluster;
-  HeapEntry.Data = (char *) &(context->candidates[next]);
-  context->candidates[next].Neighbor =
-      FindNearestNeighbor(context->tree,
-                          context->candidates[next].Cluster,
-                          &HeapEntry.Key);
-  if (context->candidates[next].Neighbor != NULL) {
+  FLOAT32 *Distances = (FLOAT32 *) Emalloc(NumClusters * sizeof(FLOAT32));
+  TEMPCLUSTER *candidates = context->candidates;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif  // _OPENMP
+  for (int i = 0; i < NumClusters; i++) {
+    candidates[i].Cluster = Clusters[i];
+    candidates[i].Neighbor =
+        FindNearestNeighbor(context->tree, Clusters[i], &Distances[i]);
+  }
+
+  context->next = 0;
+  for (int i = 0; i < NumClusters; i++) {
+    if (candidates[i].Neighbor == NULL)
+      continue;
+    candidates[context->next] = candidates[i];
+    HeapEntry.Key = Distances[i];
+    HeapEntry.Data = (char *) &(candidates[context->next]);
     HeapStore(context->heap, &HeapEntry);
     context->next++;
   }
+  memfree(Distances);
 }                                // MakePotentialClusters
 
 
@@ -1916,22 +1958,30 @@ ComputeChiSquared (uinT16 DegreesOfFreedom, FLOAT64 Alpha)
      for the specified number of degrees of freedom.  Search the list for
      the desired chi-squared. */
   SearchKey.Alpha = Alpha;
-  OldChiSquared = (CHISTRUCT *) first_node (search (ChiWith[DegreesOfFreedom],
-    &SearchKey, AlphaMatch));
-
-  if (OldChiSquared == NULL) {
-    OldChiSquared = NewChiStruct (DegreesOfFreedom, Alpha);
-    OldChiSquared->ChiSquared = Solve (ChiArea, OldChiSquared,
-      (FLOAT64) DegreesOfFreedom,
-      (FLOAT64) CHIACCURACY);
-    ChiWith[DegreesOfFreedom] = push (ChiWith[DegreesOfFreedom],
-      OldChiSquared);
-  }
-  else {
-    // further optimization might move OldChiSquared to front of list
+  FLOAT64 ChiSquared;
+  // the cache is shared by all clusterers, which may run concurrently.
+#ifdef _OPENMP
+#pragma omp critical(chi_squared_cache)
+#endif  // _OPENMP
+  {
+    OldChiSquared = (CHISTRUCT *) first_node (search (ChiWith[DegreesOfFreedom],
+      &SearchKey, AlphaMatch));
+
+    if (OldChiSquared == NULL) {
+      OldChiSquared = NewChiStruct (DegreesOfFreedom, Alpha);
+      OldChiSquared->ChiSquared = Solve (ChiArea, OldChiSquared,
+        (FLOAT64) DegreesOfFreedom,
+        (FLOAT64) CHIACCURACY);
+      ChiWith[DegreesOfFreedom] = push (ChiWith[DegreesOfFreedom],
+        OldChiSquared);
+    }
+    else {
+      // further optimization might move OldChiSquared to front of list
+    }
+    ChiSquared = OldChiSquared->ChiSquared;
   }
 
-  return (OldChiSquared->ChiSquared);
+  return (ChiSquared);
 
 }                                // ComputeChiSquared
 
@@ -2594,8 +2644,8 @@ CLUSTER * Cluster, FLOAT32 MaxIllegal)
  */
 #define ILLEGAL_CHAR    2
 {
-  static BOOL8 *CharFlags = NULL;
-  static inT32 NumFlags = 0;
+  BOOL8 *CharFlags;
+  inT32 NumFlags;
   int i;
   LIST SearchState;
   SAMPLE *Sample;
@@ -2608,12 +2658,17 @@ CLUSTER * Cluster, FLOAT32 MaxIllegal)
   NumCharInCluster = Cluster->SampleCount;
   NumIllegalInCluster = 0;
 
-  if (Clusterer->NumChar > NumFlags) {
-    if (CharFlags != NULL)
-      memfree(CharFlags);
-    NumFlags = Clusterer->NumChar;
-    CharFlags = (BOOL8 *) Emalloc (NumFlags * sizeof (BOOL8));
+  // the flags are kept in the clusterer rather than in a static, so that
+  // different clusterers can be used concurrently.
+  if (Clusterer->NumChar > Clusterer->NumCharFlags) {
+    if (Clusterer->CharFlags != NULL)
+      memfree(Clusterer->CharFlags);
+    Clusterer->NumCharFlags = Clusterer->NumChar;
+    Clusterer->CharFlags =
+      (BOOL8 *) Emalloc (Clusterer->NumCharFlags * sizeof (BOOL8));
   }
+  CharFlags = Clusterer->CharFlags;
+  NumFlags = Clusterer->NumCharFlags;
 
   for (i = 0; i < NumFlags; i++)
     CharFlags[i] = FALSE;
@@ -88,11 +88,17 @@ typedef struct {
   PARAM_DESC *ParamDesc;         // description of each parameter
   inT32 NumberOfSamples;         // total number of samples being clustered
   KDTREE *KDTree;                // for optimal nearest neighbor searching
+  // samples waiting to be bulk loaded into KDTree by ClusterSamples.
+  SAMPLE **PendingSamples;
+  inT32 MaxPendingSamples;
   CLUSTER *Root;                 // ptr to root cluster of cluster tree
   LIST ProtoList;                // list of prototypes
   inT32 NumChar;                 // # of characters represented by samples
   // cache of reusable histograms by distribution type and number of buckets.
   BUCKETS* bucket_cache[DISTRIBUTION_COUNT][MAXBUCKETS + 1 - MINBUCKETS];
+  // scratch flags (one per character) used by MultipleCharSamples.
+  BOOL8 *CharFlags;
+  inT32 NumCharFlags;
 } CLUSTERER;
 
 typedef struct {
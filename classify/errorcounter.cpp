@@ -13,6 +13,9 @@
 //
 ///////////////////////////////////////////////////////////////////////
 #include <ctime>
+#ifdef _OPENMP
+#include <omp.h>
+#endif  // _OPENMP
 
 #include "errorcounter.h"
 
@@ -38,57 +41,171 @@ double ErrorCounter::ComputeErrorRate(ShapeClassifier* classifier,
     const UnicityTable<FontInfo>& fontinfo_table,
     const GenericVector<Pix*>& page_images, SampleIterator* it,
     double* unichar_error,  double* scaled_error, STRING* fonts_report) {
+  GenericVector<ShapeClassifier*> classifiers;
+  classifiers.push_back(classifier);
+  return ComputeErrorRate(classifiers, report_level, boosting_mode,
+                          fontinfo_table, page_images, it, unichar_error,
+                          scaled_error, fonts_report);
+}
+
+// As above, but with one classifier per thread. The samples are shared out
+// between the threads, each with its own ErrorCounter, and the counters are
+// merged at the end, so the results do not depend on the number of threads.
+// Debug output (report_level > 3) needs the samples in order, so it uses
+// only the first classifier.
+double ErrorCounter::ComputeErrorRate(
+    const GenericVector<ShapeClassifier*>& classifiers,
+    int report_level, CountTypes boosting_mode,
+    const UnicityTable<FontInfo>& fontinfo_table,
+    const GenericVector<Pix*>& page_images, SampleIterator* it,
+    double* unichar_error,  double* scaled_error, STRING* fonts_report) {
   int charsetsize = it->shape_table()->unicharset().size();
   int shapesize = it->CompactCharsetSize();
   int fontsize = it->sample_set()->NumFonts();
   ErrorCounter counter(charsetsize, shapesize, fontsize);
   GenericVector<ShapeRating> results;
 
+  // Collect the samples first so they can be shared out between threads.
+  GenericVector<TrainingSample*> samples;
+  GenericVector<int> keep_ids;
+  GenericVector<int> global_indices;
+  for (it->Begin(); !it->AtEnd(); it->Next()) {
+    samples.push_back(it->MutableSample());
+    keep_ids.push_back(it->GetSparseClassID());
+    global_indices.push_back(it->GlobalSampleIndex());
+  }
+  int total_samples = samples.size();
+  int num_threads = report_level > 3 ? 1 : classifiers.size();
+
+#ifdef _OPENMP
+  double start = omp_get_wtime();
+#else
   clock_t start = clock();
-  int total_samples = 0;
+#endif  // _OPENMP
   double unscaled_error = 0.0;
   // Set a number of samples on which to run the classify debug mode.
   int error_samples = report_level > 3 ? report_level * report_level : 0;
-  // Iterate over all the samples, accumulating errors.
-  for (it->Begin(); !it->AtEnd(); it->Next()) {
-    TrainingSample* mutable_sample = it->MutableSample();
-    int page_index = mutable_sample->page_num();
-    Pix* page_pix = 0 <= page_index && page_index < page_images.size()
-                  ? page_images[page_index] : NULL;
-    // No debug, no keep this.
-    classifier->ClassifySample(*mutable_sample, page_pix, 0, INVALID_UNICHAR_ID,
-                               &results);
-    if (mutable_sample->class_id() == 0) {
-      // This is junk so use the special counter.
-      counter.AccumulateJunk(*it->shape_table(), results, mutable_sample);
-    } else if (counter.AccumulateErrors(report_level > 3, boosting_mode,
-                                        fontinfo_table, *it->shape_table(),
-                                        results, mutable_sample) &&
-               error_samples > 0) {
-      // Running debug, keep the correct answer, and debug the classifier.
-      tprintf("Error on sample %d: Classifier debug output:\n",
-              it->GlobalSampleIndex());
-      int keep_this = it->GetSparseClassID();
-      classifier->ClassifySample(*mutable_sample, page_pix, 1, keep_this,
-                                 &results);
-      --error_samples;
+  if (num_threads <= 1) {
+    // Iterate over all the samples, accumulating errors.
+    ShapeClassifier* classifier = classifiers[0];
+    for (int s = 0; s < total_samples; ++s) {
+      TrainingSample* mutable_sample = samples[s];
+      Pix* page_pix = PageImage(page_images, *mutable_sample);
+      // No debug, no keep this.
+      classifier->ClassifySample(*mutable_sample, page_pix, 0,
+                                 INVALID_UNICHAR_ID, &results);
+      bool is_error;
+      if (mutable_sample->class_id() == 0) {
+        // This is junk so use the special counter.
+        counter.AccumulateJunk(*it->shape_table(), results, *mutable_sample,
+                               &is_error);
+        mutable_sample->set_is_error(is_error);
+      } else {
+        bool debug_it = counter.AccumulateErrors(report_level > 3,
+                                                 boosting_mode,
+                                                 fontinfo_table,
+                                                 *it->shape_table(), results,
+                                                 *mutable_sample, &is_error);
+        mutable_sample->set_is_error(is_error);
+        if (debug_it && error_samples > 0) {
+          // Running debug, keep the correct answer, and debug the classifier.
+          tprintf("Error on sample %d: Classifier debug output:\n",
+                  global_indices[s]);
+          classifier->ClassifySample(*mutable_sample, page_pix, 1,
+                                     keep_ids[s], &results);
+          --error_samples;
+        }
+      }
+    }
+  } else {
+    // The iterator may visit the same sample more than once, possibly on
+    // different threads at the same time, so the threads only record the
+    // is_error result of each visit, and the samples are set afterwards.
+    GenericVector<bool> visit_errors;
+    visit_errors.init_to_size(total_samples, false);
+    GenericVector<ErrorCounter*> thread_counters;
+    for (int t = 0; t < num_threads; ++t)
+      thread_counters.push_back(new ErrorCounter(charsetsize, shapesize,
+                                                 fontsize));
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic, 16)
+#endif  // _OPENMP
+    for (int s = 0; s < total_samples; ++s) {
+#ifdef _OPENMP
+      int t = omp_get_thread_num();
+#else
+      int t = 0;
+#endif  // _OPENMP
+      GenericVector<ShapeRating> thread_results;
+      const TrainingSample& sample = *samples[s];
+      classifiers[t]->ClassifySample(sample, PageImage(page_images, sample),
+                                     0, INVALID_UNICHAR_ID, &thread_results);
+      bool is_error;
+      if (sample.class_id() == 0) {
+        thread_counters[t]->AccumulateJunk(*it->shape_table(), thread_results,
+                                           sample, &is_error);
+      } else {
+        thread_counters[t]->AccumulateErrors(false, boosting_mode,
+                                             fontinfo_table,
+                                             *it->shape_table(),
+                                             thread_results, sample,
+                                             &is_error);
+      }
+      visit_errors[s] = is_error;
+    }
+    for (int t = 0; t < num_threads; ++t) {
+      counter.Merge(*thread_counters[t]);
+      delete thread_counters[t];
+    }
+    // Set the flags and sum the weights in visit order, as the serial loop
+    // would have, so the last visit of a sample decides its flag.
+    counter.scaled_error_ = 0.0;
+    for (int s = 0; s < total_samples; ++s) {
+      samples[s]->set_is_error(visit_errors[s]);
+      if (visit_errors[s])
+        counter.scaled_error_ += samples[s]->weight();
     }
-    ++total_samples;
   }
+#ifdef _OPENMP
+  double total_time = omp_get_wtime() - start;
+#else
   double total_time = 1.0 * (clock() - start) / CLOCKS_PER_SEC;
+#endif  // _OPENMP
   // Create the appropriate error report.
   unscaled_error = counter.ReportErrors(report_level, boosting_mode,
                                         fontinfo_table,
                                         *it, unichar_error, fonts_report);
   if (scaled_error != NULL) *scaled_error = counter.scaled_error_;
-  if (report_level > 1) {
-    // It is useful to know the time in microseconds/char.
-    tprintf("Errors computed in %.2fs at %.1f μs/char\n",
-            total_time, 1000000.0 * total_time / total_samples);
+  if (report_level > 1 && total_samples > 0) {
+    // It is useful to know the time in microseconds/char, and the throughput.
+    tprintf("Errors computed in %.2fs at %.1f μs/char, %.0f samples/s"
+            " on %d thread%s\n",
+            total_time, 1000000.0 * total_time / total_samples,
+            total_time > 0.0 ? total_samples / total_time : 0.0,
+            num_threads, num_threads == 1 ? "" : "s");
   }
   return unscaled_error;
 }
 
+// Returns the page image for the given sample, or NULL if there is none.
+Pix* ErrorCounter::PageImage(const GenericVector<Pix*>& page_images,
+                             const TrainingSample& sample) {
+  int page_index = sample.page_num();
+  return 0 <= page_index && page_index < page_images.size()
+       ? page_images[page_index] : NULL;
+}
+
+// Adds the counts from other into this.
+void ErrorCounter::Merge(const ErrorCounter& other) {
+  scaled_error_ += other.scaled_error_;
+  for (int f = 0; f < font_counts_.size(); ++f)
+    font_counts_[f] += other.font_counts_[f];
+  for (int c = 0; c < unichar_counts_.dim1(); ++c) {
+    for (int s = 0; s < unichar_counts_.dim2(); ++s)
+      unichar_counts_(c, s) += other.unichar_counts_(c, s);
+  }
+}
+
 // Constructor is private. Only anticipated use of ErrorCounter is via
 // the static ComputeErrorRate.
 ErrorCounter::ErrorCounter(int charsetsize, int shapesize, int fontsize)
@@ -101,27 +218,28 @@ ErrorCounter::~ErrorCounter() {
 
 // Accumulates the errors from the classifier results on a single sample.
 // Returns true if debug is true and a CT_UNICHAR_TOPN_ERR error occurred.
-// boosting_mode selects the type of error to be used for boosting and the
-// is_error_ member of sample is set according to whether the required type
-// of error occurred. The font_table provides access to font properties
-// for error counting and shape_table is used to understand the relationship
-// between unichar_ids and shape_ids in the results
+// boosting_mode selects the type of error to be used for boosting and
+// *is_error is set according to whether the required type of error occurred,
+// for the caller to copy to the sample. The font_table provides access to
+// font properties for error counting and shape_table is used to understand
+// the relationship between unichar_ids and shape_ids in the results
 bool ErrorCounter::AccumulateErrors(bool debug, CountTypes boosting_mode,
                                     const UnicityTable<FontInfo>& font_table,
                                     const ShapeTable& shape_table,
                                     const GenericVector<ShapeRating>& results,
-                                    TrainingSample* sample) {
+                                    const TrainingSample& sample,
+                                    bool* is_error) {
   int num_results = results.size();
   int res_index = 0;
   bool debug_it = false;
-  int font_id = sample->font_id();
-  int unichar_id = sample->class_id();
-  sample->set_is_error(false);
+  int font_id = sample.font_id();
+  int unichar_id = sample.class_id();
+  *is_error = false;
   if (num_results == 0) {
     // Reject. We count rejects as a separate category, but still mark the
     // sample as an error in case any training module wants to use that to
     // improve the classifier.
-    sample->set_is_error(true);
+    *is_error = true;
     ++font_counts_[font_id].n[CT_REJECT];
   } else if (shape_table.GetShape(results[0].shape_id).
           ContainsUnicharAndFont(unichar_id, font_id)) {
@@ -148,7 +266,7 @@ bool ErrorCounter::AccumulateErrors(bool debug, CountTypes boosting_mode,
     // here if we want them.
     if (!attributes_match)
       ++font_counts_[font_id].n[CT_FONT_ATTR_ERR];
-    if (boosting_mode == CT_SHAPE_TOP_ERR) sample->set_is_error(true);
+    if (boosting_mode == CT_SHAPE_TOP_ERR) *is_error = true;
     // Find rank of correct unichar answer. (Ignoring the font.)
     while (res_index < num_results &&
            !shape_table.GetShape(results[res_index].shape_id).
@@ -166,16 +284,16 @@ bool ErrorCounter::AccumulateErrors(bool debug, CountTypes boosting_mode,
         ++unichar_counts_(unichar_id, results[0].shape_id);
       // This is a unichar error.
       ++font_counts_[font_id].n[CT_UNICHAR_TOP1_ERR];
-      if (boosting_mode == CT_UNICHAR_TOP1_ERR) sample->set_is_error(true);
+      if (boosting_mode == CT_UNICHAR_TOP1_ERR) *is_error = true;
       if (res_index >= MIN(2, num_results)) {
         // It is also a 2nd choice unichar error.
         ++font_counts_[font_id].n[CT_UNICHAR_TOP2_ERR];
-        if (boosting_mode == CT_UNICHAR_TOP2_ERR) sample->set_is_error(true);
+        if (boosting_mode == CT_UNICHAR_TOP2_ERR) *is_error = true;
       }
       if (res_index >= num_results) {
         // It is also a top-n choice unichar error.
         ++font_counts_[font_id].n[CT_UNICHAR_TOPN_ERR];
-        if (boosting_mode == CT_UNICHAR_TOPN_ERR) sample->set_is_error(true);
+        if (boosting_mode == CT_UNICHAR_TOPN_ERR) *is_error = true;
         debug_it = debug;
       }
     }
@@ -184,8 +302,8 @@ bool ErrorCounter::AccumulateErrors(bool debug, CountTypes boosting_mode,
   font_counts_[font_id].n[CT_NUM_RESULTS] += num_results;
   font_counts_[font_id].n[CT_RANK] += res_index;
   // If it was an error for boosting then sum the weight.
-  if (sample->is_error()) {
-    scaled_error_ += sample->weight();
+  if (*is_error) {
+    scaled_error_ += sample.weight();
   }
   if (debug_it) {
     tprintf("%d results for char %s font %d :",
@@ -203,26 +321,27 @@ bool ErrorCounter::AccumulateErrors(bool debug, CountTypes boosting_mode,
 }
 
 // Accumulates counts for junk. Counts only whether the junk was correctly
-// rejected or not.
+// rejected or not, and sets *is_error if not.
 void ErrorCounter::AccumulateJunk(const ShapeTable& shape_table,
                                   const GenericVector<ShapeRating>& results,
-                                  TrainingSample* sample) {
+                                  const TrainingSample& sample,
+                                  bool* is_error) {
   // For junk we accept no answer, or an explicit shape answer matching the
   // class id of the sample.
   int num_results = results.size();
-  int font_id = sample->font_id();
-  int unichar_id = sample->class_id();
+  int font_id = sample.font_id();
+  int unichar_id = sample.class_id();
   if (num_results > 0 &&
       !shape_table.GetShape(results[0].shape_id).ContainsUnichar(unichar_id)) {
     // This is a junk error.
     ++font_counts_[font_id].n[CT_ACCEPTED_JUNK];
-    sample->set_is_error(true);
+    *is_error = true;
     // It counts as an error for boosting too so sum the weight.
-    scaled_error_ += sample->weight();
+    scaled_error_ += sample.weight();
   } else {
     // Correctly rejected.
     ++font_counts_[font_id].n[CT_REJECTED_JUNK];
-    sample->set_is_error(false);
+    *is_error = false;
   }
 }
 
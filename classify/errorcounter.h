@@ -121,6 +121,19 @@ class ErrorCounter {
                                  double* unichar_error,
                                  double* scaled_error,
                                  STRING* fonts_report);
+  // As above, but evaluates the samples in parallel, using one classifier
+  // per thread from classifiers, which must not share mutable state. The
+  // result is the same as using just classifiers[0]. The time report
+  // (report_level > 1) includes the throughput in samples/s.
+  static double ComputeErrorRate(
+      const GenericVector<ShapeClassifier*>& classifiers,
+      int report_level, CountTypes boosting_mode,
+      const UnicityTable<FontInfo>& fontinfo_table,
+      const GenericVector<Pix*>& page_images,
+      SampleIterator* it,
+      double* unichar_error,
+      double* scaled_error,
+      STRING* fonts_report);
 
  private:
   // Simple struct to hold an array of counts.
@@ -139,22 +152,30 @@ class ErrorCounter {
 
   // Accumulates the errors from the classifier results on a single sample.
   // Returns true if debug is true and a CT_UNICHAR_TOPN_ERR error occurred.
-  // boosting_mode selects the type of error to be used for boosting and the
-  // is_error_ member of sample is set according to whether the required type
-  // of error occurred. The font_table provides access to font properties
+  // boosting_mode selects the type of error to be used for boosting and
+  // *is_error is set according to whether the required type of error occurred,
+  // for the caller to copy to the sample, as the same sample may be visited
+  // more than once at the same time on different threads. The font_table provides access to font properties
   // for error counting and shape_table is used to understand the relationship
   // between unichar_ids and shape_ids in the results
   bool AccumulateErrors(bool debug, CountTypes boosting_mode,
                         const UnicityTable<FontInfo>& font_table,
                         const ShapeTable& shape_table,
                         const GenericVector<ShapeRating>& results,
-                        TrainingSample* sample);
+                        const TrainingSample& sample, bool* is_error);
+
+  // Adds the counts from other into this.
+  void Merge(const ErrorCounter& other);
+
+  // Returns the page image for the given sample, or NULL if there is none.
+  static Pix* PageImage(const GenericVector<Pix*>& page_images,
+                        const TrainingSample& sample);
 
   // Accumulates counts for junk. Counts only whether the junk was correctly
-  // rejected or not.
+  // rejected or not, and sets *is_error if not.
   void AccumulateJunk(const ShapeTable& shape_table,
                       const GenericVector<ShapeRating>& results,
-                      TrainingSample* sample);
+                      const TrainingSample& sample, bool* is_error);
 
   // Creates a report of the error rate. The report_level controls the detail
   // that is reported to stderr via tprintf:
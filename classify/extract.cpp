@@ -43,14 +43,16 @@ void ExtractorStub();
  * @param FeatureDefs	definitions of feature types/extractors
  * @param denorm	Normalize/denormalize to access original image
  * @param Blob		blob to extract features from
+ * @param fx_params	engine params for the feature extractors
  *
  * @return The character features extracted from Blob.
  * @note Exceptions: none
  * @note History: Sun Jan 21 10:07:28 1990, DSJ, Created.
  */
 CHAR_DESC ExtractBlobFeatures(const FEATURE_DEFS_STRUCT &FeatureDefs,
-                              const DENORM& denorm, TBLOB *Blob) {
-  return (ExtractFlexFeatures(FeatureDefs, Blob, denorm));
+                              const DENORM& denorm, TBLOB *Blob,
+                              const FEATURE_EXT_PARAMS& fx_params) {
+  return (ExtractFlexFeatures(FeatureDefs, Blob, denorm, fx_params));
 }                                /* ExtractBlobFeatures */
 
 /*-----------------------------------------------------------------------------
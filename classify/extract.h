@@ -27,7 +27,8 @@ class DENORM;
           Public Function Prototypes
 -----------------------------------------------------------------------------*/
 CHAR_DESC ExtractBlobFeatures(const FEATURE_DEFS_STRUCT &FeatureDefs,
-                              const DENORM& denorm, TBLOB *Blob);
+                              const DENORM& denorm, TBLOB *Blob,
+                              const FEATURE_EXT_PARAMS& fx_params);
 
 /*---------------------------------------------------------------------------
           Private Function Prototypes
@@ -29,11 +29,13 @@
 ----------------------------------------------------------------------------**/
 /*---------------------------------------------------------------------------*/
 CHAR_DESC ExtractFlexFeatures(const FEATURE_DEFS_STRUCT &FeatureDefs,
-                              TBLOB *Blob, const DENORM& denorm) {
+                              TBLOB *Blob, const DENORM& denorm,
+                              const FEATURE_EXT_PARAMS& fx_params) {
 /*
  **	Parameters:
  **		Blob		blob to extract features from
  **		denorm  control parameter for feature extractor
+ **		fx_params  engine params for the feature extractors
  **	Globals: none
  **	Operation: Allocate a new character descriptor and fill it in by
  **		calling all feature extractors which are enabled.
@@ -50,7 +52,8 @@ CHAR_DESC ExtractFlexFeatures(const FEATURE_DEFS_STRUCT &FeatureDefs,
     if (FeatureDefs.FeatureExtractors[Type] != NULL &&
         FeatureDefs.FeatureExtractors[Type]->Extractor != NULL) {
       CharDesc->FeatureSets[Type] =
-        (FeatureDefs.FeatureExtractors[Type])->Extractor(Blob, denorm);
+        (FeatureDefs.FeatureExtractors[Type])->Extractor(Blob, denorm,
+                                                      fx_params);
       if (CharDesc->FeatureSets[Type] == NULL) {
         FreeCharDescription(CharDesc);
         return NULL;
@@ -28,6 +28,7 @@
           Public Function Prototypes
 ----------------------------------------------------------------------------**/
 CHAR_DESC ExtractFlexFeatures(const FEATURE_DEFS_STRUCT &FeatureDefs,
-                              TBLOB *Blob, const DENORM& denorm);
+                              TBLOB *Blob, const DENORM& denorm,
+                              const FEATURE_EXT_PARAMS& fx_params);
 
 #endif
@@ -38,43 +38,17 @@ uinT8 BinaryAnglePlusPi(inT32 Y, inT32 X);
 uinT8 MySqrt2();
 void ClipRadius();
 
-INT_VAR(classify_radius_gyr_min_man, 255,
-        "Minimum Radius of Gyration Mantissa 0-255:        ");
-
-INT_VAR(classify_radius_gyr_min_exp, 0,
-        "Minimum Radius of Gyration Exponent 0-255:        ");
-
-INT_VAR(classify_radius_gyr_max_man, 158,
-        "Maximum Radius of Gyration Mantissa 0-255:        ");
-
-INT_VAR(classify_radius_gyr_max_exp, 8,
-        "Maximum Radius of Gyration Exponent 0-255:        ");
-
 /**----------------------------------------------------------------------------
         Global Data Definitions and Declarations
 ----------------------------------------------------------------------------**/
 #define  ATAN_TABLE_SIZE    64
 
-// Look up table for arc tangent containing:
-//    atan(0.0) ... atan(ATAN_TABLE_SIZE - 1 / ATAN_TABLE_SIZE)
-// The entries are in binary degrees where a full circle is 256 binary degrees.
-static uinT8 AtanTable[ATAN_TABLE_SIZE];
-// Look up table for cos and sin to turn the intfx feature angle to a vector.
-// Also protected by atan_table_mutex.
-static float cos_table[INT_CHAR_NORM_RANGE];
-static float sin_table[INT_CHAR_NORM_RANGE];
-// Guards write access to AtanTable so we dont create it more than once.
-tesseract::CCUtilMutex atan_table_mutex;
-
-
-/**----------------------------------------------------------------------------
-            Public Code
-----------------------------------------------------------------------------**/
-/*---------------------------------------------------------------------------*/
-void InitIntegerFX() {
-  static bool atan_table_init = false;
-  atan_table_mutex.Lock();
-  if (!atan_table_init) {
+// Look up tables for arc tangent, cos and sin. They are filled in by the
+// constructor of the single static instance, during static initialization,
+// so they are never written once any engine is running, and need no lock.
+class IntFxTables {
+ public:
+  IntFxTables() {
     for (int i = 0; i < ATAN_TABLE_SIZE; i++) {
       AtanTable[i] =
           (uinT8) (atan ((i / (float) ATAN_TABLE_SIZE)) * 128.0 / PI + 0.5);
@@ -83,23 +57,44 @@ void InitIntegerFX() {
       cos_table[i] = cos(i * 2 * PI / INT_CHAR_NORM_RANGE + PI);
       sin_table[i] = sin(i * 2 * PI / INT_CHAR_NORM_RANGE + PI);
     }
-    atan_table_init = true;
   }
-  atan_table_mutex.Unlock();
+
+  // Arc tangent containing:
+  //    atan(0.0) ... atan(ATAN_TABLE_SIZE - 1 / ATAN_TABLE_SIZE)
+  // The entries are in binary degrees where a full circle is 256 binary
+  // degrees.
+  uinT8 AtanTable[ATAN_TABLE_SIZE];
+  // Cos and sin to turn the intfx feature angle to a vector.
+  float cos_table[INT_CHAR_NORM_RANGE];
+  float sin_table[INT_CHAR_NORM_RANGE];
+};
+static const IntFxTables kIntFxTables;
+
+
+/**----------------------------------------------------------------------------
+            Public Code
+----------------------------------------------------------------------------**/
+/*---------------------------------------------------------------------------*/
+// The tables are built during static initialization, so there is nothing to
+// do here. Kept for the callers that initialize before feature extraction.
+void InitIntegerFX() {
 }
 
 // Returns a vector representing the direction of a feature with the given
 // theta direction in an INT_FEATURE_STRUCT.
 FCOORD FeatureDirection(uinT8 theta) {
-  return FCOORD(cos_table[theta], sin_table[theta]);
+  return FCOORD(kIntFxTables.cos_table[theta],
+                kIntFxTables.sin_table[theta]);
 }
 
 TrainingSample* GetIntFeatures(tesseract::NormalizationMode mode,
-                               TBLOB *blob, const DENORM& denorm) {
+                               TBLOB *blob, const DENORM& denorm,
+                               const INT_FX_RADIUS_LIMITS& radius_limits) {
   INT_FEATURE_ARRAY blfeatures;
   INT_FEATURE_ARRAY cnfeatures;
   INT_FX_RESULT_STRUCT fx_info;
-  ExtractIntFeat(blob, denorm, blfeatures, cnfeatures, &fx_info, NULL);
+  ExtractIntFeat(blob, denorm, blfeatures, cnfeatures, &fx_info,
+                 radius_limits, NULL);
   TrainingSample* sample = NULL;
   if (mode == tesseract::NM_CHAR_ANISOTROPIC) {
     int num_features = fx_info.NumCN;
@@ -145,6 +140,7 @@ int ExtractIntFeat(TBLOB *Blob,
                    INT_FEATURE_ARRAY BLFeat,
                    INT_FEATURE_ARRAY CNFeat,
                    INT_FX_RESULT_STRUCT* Results,
+                   const INT_FX_RADIUS_LIMITS& RadiusLimits,
                    inT32 *FeatureOutlineArray) {
 
   TESSLINE *OutLine;
@@ -320,7 +316,7 @@ int ExtractIntFeat(TBLOB *Blob,
     Iy = 1;
   RxInv = MySqrt2 (NumBLFeatures, Ix, &RxExp);
   RyInv = MySqrt2 (NumBLFeatures, Iy, &RyExp);
-  ClipRadius(&RxInv, &RxExp, &RyInv, &RyExp);
+  ClipRadius(&RxInv, &RxExp, &RyInv, &RyExp, RadiusLimits);
 
   Results->Rx = (inT16) (51.2 / (double) RxInv * pow (2.0, (double) RxExp));
   Results->Ry = (inT16) (51.2 / (double) RyInv * pow (2.0, (double) RyExp));
@@ -446,7 +442,7 @@ uinT8 BinaryAnglePlusPi(inT32 Y, inT32 X) {
     Ratio = AbsX * ATAN_TABLE_SIZE / AbsY;
   if (Ratio >= ATAN_TABLE_SIZE)
     Ratio = ATAN_TABLE_SIZE - 1;
-  Atan = AtanTable[Ratio];
+  Atan = kIntFxTables.AtanTable[Ratio];
   if (X >= 0)
     if (Y >= 0)
       if (AbsX > AbsY)
@@ -591,13 +587,14 @@ uinT8 MySqrt2(uinT16 N, uinT32 I, uinT8 *Exp) {
 
 
 /*-------------------------------------------------------------------------*/
-void ClipRadius(uinT8 *RxInv, uinT8 *RxExp, uinT8 *RyInv, uinT8 *RyExp) {
+void ClipRadius(uinT8 *RxInv, uinT8 *RxExp, uinT8 *RyInv, uinT8 *RyExp,
+                const INT_FX_RADIUS_LIMITS& RadiusLimits) {
   register uinT8 AM, BM, AE, BE;
   register uinT8 BitN, LastCarry;
   int RxInvLarge, RyInvSmall;
 
-  AM = classify_radius_gyr_min_man;
-  AE = classify_radius_gyr_min_exp;
+  AM = RadiusLimits.MinMan;
+  AE = RadiusLimits.MinExp;
   BM = *RxInv;
   BE = *RxExp;
   LastCarry = 1;
@@ -627,12 +624,12 @@ void ClipRadius(uinT8 *RxInv, uinT8 *RxExp, uinT8 *RyInv, uinT8 *RyExp) {
   BitN = BitN & 1;
 
   if (BitN == 1) {
-    *RxInv = classify_radius_gyr_min_man;
-    *RxExp = classify_radius_gyr_min_exp;
+    *RxInv = RadiusLimits.MinMan;
+    *RxExp = RadiusLimits.MinExp;
   }
 
-  AM = classify_radius_gyr_min_man;
-  AE = classify_radius_gyr_min_exp;
+  AM = RadiusLimits.MinMan;
+  AE = RadiusLimits.MinExp;
   BM = *RyInv;
   BE = *RyExp;
   LastCarry = 1;
@@ -662,12 +659,12 @@ void ClipRadius(uinT8 *RxInv, uinT8 *RxExp, uinT8 *RyInv, uinT8 *RyExp) {
   BitN = BitN & 1;
 
   if (BitN == 1) {
-    *RyInv = classify_radius_gyr_min_man;
-    *RyExp = classify_radius_gyr_min_exp;
+    *RyInv = RadiusLimits.MinMan;
+    *RyExp = RadiusLimits.MinExp;
   }
 
-  AM = classify_radius_gyr_max_man;
-  AE = classify_radius_gyr_max_exp;
+  AM = RadiusLimits.MaxMan;
+  AE = RadiusLimits.MaxExp;
   BM = *RxInv;
   BE = *RxExp;
   LastCarry = 1;
@@ -703,8 +700,8 @@ void ClipRadius(uinT8 *RxInv, uinT8 *RxExp, uinT8 *RyInv, uinT8 *RyExp) {
 
   AM = *RyInv;
   AE = *RyExp;
-  BM = classify_radius_gyr_max_man;
-  BE = classify_radius_gyr_max_exp;
+  BM = RadiusLimits.MaxMan;
+  BE = RadiusLimits.MaxExp;
   LastCarry = 1;
   while ((AM != 0) || (BM != 0)) {
     if (AE > BE) {
@@ -737,8 +734,8 @@ void ClipRadius(uinT8 *RxInv, uinT8 *RxExp, uinT8 *RyInv, uinT8 *RyExp) {
     RyInvSmall = 0;
 
   if (RxInvLarge && RyInvSmall) {
-    *RyInv = classify_radius_gyr_max_man;
-    *RyExp = classify_radius_gyr_max_exp;
+    *RyInv = RadiusLimits.MaxMan;
+    *RyExp = RadiusLimits.MaxExp;
   }
 
 }
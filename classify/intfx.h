@@ -42,6 +42,24 @@ struct INT_FX_RESULT_STRUCT {
   uinT8 YTop;                    // Top of blob in BLN coords.
 };
 
+// Limits applied by ClipRadius to the inverse radii of gyration, each as a
+// mantissa and exponent pair. An engine fills them in from its own
+// classify_radius_gyr_* params, so two engines never share them.
+struct INT_FX_RADIUS_LIMITS {
+  uinT8 MinMan;                  // Minimum radius of gyration mantissa.
+  uinT8 MinExp;                  // Minimum radius of gyration exponent.
+  uinT8 MaxMan;                  // Maximum radius of gyration mantissa.
+  uinT8 MaxExp;                  // Maximum radius of gyration exponent.
+};
+
+// Values of the classify params used by the feature extractors called
+// through FX_FUNC, filled in by an engine from its own params.
+struct FEATURE_EXT_PARAMS {
+  INT_FX_RADIUS_LIMITS RadiusLimits;  // For ExtractIntFeat.
+  FLOAT32 MinSlope;              // Slope below which lines are horizontal.
+  FLOAT32 MaxSlope;              // Slope above which lines are vertical.
+};
+
 /**----------------------------------------------------------------------------
           Public Function Prototypes
 ----------------------------------------------------------------------------**/
@@ -53,13 +71,14 @@ FCOORD FeatureDirection(uinT8 theta);
 
 tesseract::TrainingSample* GetIntFeatures(
     tesseract::NormalizationMode mode, TBLOB *blob,
-    const DENORM& denorm);
+    const DENORM& denorm, const INT_FX_RADIUS_LIMITS& radius_limits);
 
 int ExtractIntFeat(TBLOB *Blob,
                    const DENORM& denorm,
                    INT_FEATURE_ARRAY BLFeat,
                    INT_FEATURE_ARRAY CNFeat,
                    INT_FX_RESULT_STRUCT* Results,
+                   const INT_FX_RADIUS_LIMITS& RadiusLimits,
                    inT32 *FeatureOutlineArray = 0);
 
 uinT8 BinaryAnglePlusPi(inT32 Y, inT32 X);
@@ -74,5 +93,6 @@ uinT16 MySqrt(inT32 X, inT32 Y);
 
 uinT8 MySqrt2(uinT16 N, uinT32 I, uinT8 *Exp);
 
-void ClipRadius(uinT8 *RxInv, uinT8 *RxExp, uinT8 *RyInv, uinT8 *RyExp);
+void ClipRadius(uinT8 *RxInv, uinT8 *RxExp, uinT8 *RyInv, uinT8 *RyExp,
+                const INT_FX_RADIUS_LIMITS& RadiusLimits);
 #endif
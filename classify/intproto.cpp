@@ -145,11 +145,6 @@ void FillPPCircularBits(uinT32
 void FillPPLinearBits(uinT32 ParamTable[NUM_PP_BUCKETS][WERDS_PER_PP_VECTOR],
                       int Bit, FLOAT32 Center, FLOAT32 Spread, bool debug);
 
-void GetCPPadsForLevel(int Level,
-                       FLOAT32 *EndPad,
-                       FLOAT32 *SidePad,
-                       FLOAT32 *AnglePad);
-
 ScrollView::Color GetMatchColorFor(FLOAT32 Evidence);
 
 void GetNextFill(TABLE_FILLER *Filler, FILL_SPEC *Fill);
@@ -185,24 +180,6 @@ ScrollView *ProtoDisplayWindow = NULL;
         Variables
 -----------------------------------------------------------------------------*/
 
-/* control knobs */
-INT_VAR(classify_num_cp_levels, 3, "Number of Class Pruner Levels");
-double_VAR(classify_cp_angle_pad_loose, 45.0,
-           "Class Pruner Angle Pad Loose");
-double_VAR(classify_cp_angle_pad_medium, 20.0,
-           "Class Pruner Angle Pad Medium");
-double_VAR(classify_cp_angle_pad_tight, 10.0,
-           "CLass Pruner Angle Pad Tight");
-double_VAR(classify_cp_end_pad_loose, 0.5, "Class Pruner End Pad Loose");
-double_VAR(classify_cp_end_pad_medium, 0.5, "Class Pruner End Pad Medium");
-double_VAR(classify_cp_end_pad_tight, 0.5, "Class Pruner End Pad Tight");
-double_VAR(classify_cp_side_pad_loose, 2.5, "Class Pruner Side Pad Loose");
-double_VAR(classify_cp_side_pad_medium, 1.2, "Class Pruner Side Pad Medium");
-double_VAR(classify_cp_side_pad_tight, 0.6, "Class Pruner Side Pad Tight");
-double_VAR(classify_pp_angle_pad, 45.0, "Proto Pruner Angle Pad");
-double_VAR(classify_pp_end_pad, 0.5, "Proto Prune End Pad");
-double_VAR(classify_pp_side_pad, 2.5, "Proto Pruner Side Pad");
-
 /*-----------------------------------------------------------------------------
               Public Code
 -----------------------------------------------------------------------------*/
@@ -317,8 +294,9 @@ int AddIntProto(INT_CLASS Class) {
 
 
 /*---------------------------------------------------------------------------*/
-void AddProtoToClassPruner (PROTO Proto, CLASS_ID ClassId,
-                            INT_TEMPLATES Templates)
+namespace tesseract {
+void Classify::AddProtoToClassPruner (PROTO Proto, CLASS_ID ClassId,
+                                      INT_TEMPLATES Templates)
 /*
  ** Parameters:
  **   Proto   floating-pt proto to add to class pruner
@@ -361,8 +339,8 @@ void AddProtoToClassPruner (PROTO Proto, CLASS_ID ClassId,
 
 
 /*---------------------------------------------------------------------------*/
-void AddProtoToProtoPruner(PROTO Proto, int ProtoId,
-                           INT_CLASS Class, bool debug) {
+void Classify::AddProtoToProtoPruner(PROTO Proto, int ProtoId,
+                                     INT_CLASS Class, bool debug) {
 /*
  ** Parameters:
  **   Proto floating-pt proto to be added to proto pruner
@@ -419,6 +397,7 @@ void AddProtoToProtoPruner(PROTO Proto, int ProtoId,
 
   FillPPLinearBits(ProtoSet->ProtoPruner[PRUNER_Y], Index, Y, Pad, debug);
 }                                /* AddProtoToProtoPruner */
+}  // namespace tesseract
 
 
 /*---------------------------------------------------------------------------*/
@@ -1505,10 +1484,11 @@ CLASS_ID Classify::GetClassToDebug(const char *Prompt, bool* adaptive_on,
 #endif
 
 /*---------------------------------------------------------------------------*/
-void GetCPPadsForLevel(int Level,
-                       FLOAT32 *EndPad,
-                       FLOAT32 *SidePad,
-                       FLOAT32 *AnglePad) {
+namespace tesseract {
+void Classify::GetCPPadsForLevel(int Level,
+                                 FLOAT32 *EndPad,
+                                 FLOAT32 *SidePad,
+                                 FLOAT32 *AnglePad) {
 /*
  ** Parameters:
  **   Level   "tightness" level to return pads for
@@ -1554,6 +1534,7 @@ void GetCPPadsForLevel(int Level,
     *AnglePad = 0.5;
 
 }                                /* GetCPPadsForLevel */
+}  // namespace tesseract
 
 
 /*---------------------------------------------------------------------------*/
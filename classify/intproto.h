@@ -203,13 +203,6 @@ int AddIntConfig(INT_CLASS Class);
 
 int AddIntProto(INT_CLASS Class);
 
-void AddProtoToClassPruner(PROTO Proto,
-                           CLASS_ID ClassId,
-                           INT_TEMPLATES Templates);
-
-void AddProtoToProtoPruner(PROTO Proto, int ProtoId,
-                           INT_CLASS Class, bool debug);
-
 int BucketFor(FLOAT32 Param, FLOAT32 Offset, int NumBuckets);
 
 int CircBucketFor(FLOAT32 Param, FLOAT32 Offset, int NumBuckets);
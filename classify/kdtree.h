@@ -49,6 +49,8 @@ struct KDNODE {
 struct KDTREE {
   inT16 KeySize;                 /* number of dimensions in the tree */
   KDNODE Root;                   /* Root.Left points to actual root node */
+  KDNODE *NodeBlock;             /* contiguous nodes made by KDBulkStore */
+  inT32 NumBlockNodes;           /* number of nodes in NodeBlock */
   PARAM_DESC KeyDesc[1];         /* description of each dimension */
 };
 
@@ -64,6 +66,8 @@ KDTREE *MakeKDTree(inT16 KeySize, const PARAM_DESC KeyDesc[]);
 
 void KDStore(KDTREE *Tree, FLOAT32 *Key, void *Data);
 
+void KDBulkStore(KDTREE *Tree, inT32 NumKeys, FLOAT32 *Keys[], void *Data[]);
+
 void KDDelete(KDTREE * Tree, FLOAT32 Key[], void *Data);
 
 void KDNearestNeighborSearch(
@@ -79,7 +83,7 @@ void FreeKDTree(KDTREE *Tree);
 -----------------------------------------------------------------------------*/
 KDNODE *MakeKDNode(KDTREE *tree, FLOAT32 Key[], void *Data, int Index);
 
-void FreeKDNode(KDNODE *Node);
+void FreeKDNode(KDTREE *tree, KDNODE *Node);
 
 FLOAT32 DistanceSquared(int k, PARAM_DESC *dim, FLOAT32 p1[], FLOAT32 p2[]);
 
@@ -92,5 +96,5 @@ void Walk(KDTREE *tree, void_proc action, void *context,
 
 void InsertNodes(KDTREE *tree, KDNODE *nodes);
 
-void FreeSubTree(KDNODE *SubTree);
+void FreeSubTree(KDTREE *tree, KDNODE *SubTree);
 #endif
@@ -68,6 +68,9 @@ MasterTrainer::~MasterTrainer() {
   delete [] fragments_;
   for (int p = 0; p < page_images_.size(); ++p)
     pixDestroy(&page_images_[p]);
+  // The samples do not delete their features from these, so it is safe to
+  // unmap them before the samples are destroyed.
+  sample_stores_.delete_data_pointers();
 }
 
 // WARNING! Serialize/DeSerialize are only partial, providing
@@ -140,7 +143,8 @@ void MasterTrainer::LoadUnicharset(const char* filename) {
 // If verification, then these are verification samples, not training.
 void MasterTrainer::ReadTrainingSamples(FILE  *fp,
                                         const FEATURE_DEFS_STRUCT& feature_defs,
-                                        bool verification) {
+                                        bool verification,
+                                        SampleStoreWriter* writer) {
   char buffer[2048];
   int int_feature_type = ShortNameToFeatureType(feature_defs, kIntFeatureType);
   int micro_feature_type = ShortNameToFeatureType(feature_defs,
@@ -169,16 +173,39 @@ void MasterTrainer::ReadTrainingSamples(FILE  *fp,
     CHAR_DESC char_desc = ReadCharDescription(feature_defs, fp);
     TrainingSample* sample = new TrainingSample;
     sample->set_font_id(font_id);
-    sample->set_page_num(page_number + page_images_.size());
+    sample->set_page_num(page_number);
     sample->set_bounding_box(bounding_box);
     sample->ExtractCharDesc(int_feature_type, micro_feature_type,
                             cn_feature_type, geo_feature_type, char_desc);
+    if (writer != NULL && !writer->Write(buffer, unichar.string(), *sample))
+      tprintf("Failed to write sample to binary sample file\n");
+    sample->set_page_num(page_number + page_images_.size());
     AddSample(verification, unichar.string(), sample);
     FreeCharDescription(char_desc);
   }
   charsetsize_ = unicharset_.size();
 }
 
+// Memory-maps the given binary SampleStore file and adds its samples to the
+// trainer as ReadTrainingSamples would.
+bool MasterTrainer::ReadSampleStore(const char* filename, bool verification) {
+  SampleStore* store = new SampleStore;
+  if (!store->Open(filename)) {
+    delete store;
+    return false;
+  }
+  sample_stores_.push_back(store);
+  for (const SampleStoreRecord* record = store->First(); record != NULL;
+       record = store->Next(record)) {
+    TrainingSample* sample = SampleStore::MakeSample(record);
+    sample->set_font_id(GetFontInfoId(SampleStore::FontName(record)));
+    sample->set_page_num(sample->page_num() + page_images_.size());
+    AddSample(verification, SampleStore::Unichar(record), sample);
+  }
+  charsetsize_ = unicharset_.size();
+  return true;
+}
+
 // Adds the given single sample to the trainer, setting the classid
 // appropriately from the given unichar_str.
 void MasterTrainer::AddSample(bool verification, const char* unichar,
@@ -267,14 +294,25 @@ void MasterTrainer::SetupMasterShapes() {
   ShapeTable char_shapes_begin_fragment(samples_.unicharset());
   ShapeTable char_shapes_end_fragment(samples_.unicharset());
   ShapeTable char_shapes(samples_.unicharset());
-  for (int c = 0; c < samples_.charsetsize(); ++c) {
-    ShapeTable shapes(samples_.unicharset());
+  // The font clustering of each class is independent of the other classes,
+  // so the classes are clustered in parallel and collected in order.
+  int charsetsize = samples_.charsetsize();
+  PointerVector<ShapeTable> class_shapes;
+  class_shapes.init_to_size(charsetsize, NULL);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif  // _OPENMP
+  for (int c = 0; c < charsetsize; ++c) {
+    ShapeTable* shapes = new ShapeTable(samples_.unicharset());
     for (int f = 0; f < num_fonts; ++f) {
       if (samples_.NumClassSamples(f, c, true) > 0)
-        shapes.AddShape(c, f);
+        shapes->AddShape(c, f);
     }
-    ClusterShapes(kMinClusteredShapes, 1, kFontMergeDistance, &shapes);
-
+    ClusterShapes(kMinClusteredShapes, 1, kFontMergeDistance, shapes);
+    class_shapes[c] = shapes;
+  }
+  for (int c = 0; c < charsetsize; ++c) {
+    const ShapeTable& shapes = *class_shapes[c];
     const CHAR_FRAGMENT *fragment = samples_.unicharset().get_fragment(c);
 
     if (fragment == NULL)
@@ -760,6 +798,15 @@ void MasterTrainer::TestClassifierOnSamples(int report_level,
                  test_classifier, report_string);
 }
 
+// As above, but runs in parallel with one of test_classifiers per thread.
+void MasterTrainer::TestClassifierOnSamples(
+    int report_level, bool replicate_samples,
+    const GenericVector<ShapeClassifier*>& test_classifiers,
+    STRING* report_string) {
+  TestClassifier(report_level, replicate_samples, &samples_,
+                 test_classifiers, report_string);
+}
+
 // Tests the given test_classifier on the given samples
 // report_levels:
 // 0 = no output.
@@ -777,20 +824,31 @@ double MasterTrainer::TestClassifier(int report_level,
                                      TrainingSampleSet* samples,
                                      ShapeClassifier* test_classifier,
                                      STRING* report_string) {
+  GenericVector<ShapeClassifier*> test_classifiers;
+  test_classifiers.push_back(test_classifier);
+  return TestClassifier(report_level, replicate_samples, samples,
+                        test_classifiers, report_string);
+}
+
+// As above, but runs in parallel with one of test_classifiers per thread.
+double MasterTrainer::TestClassifier(
+    int report_level, bool replicate_samples, TrainingSampleSet* samples,
+    const GenericVector<ShapeClassifier*>& test_classifiers,
+    STRING* report_string) {
+  const ShapeTable* shape_table = test_classifiers[0]->GetShapeTable();
   SampleIterator sample_it;
-  sample_it.Init(NULL, test_classifier->GetShapeTable(), replicate_samples,
-                 samples);
+  sample_it.Init(NULL, shape_table, replicate_samples, samples);
   if (report_level > 0) {
     int num_samples = 0;
     for (sample_it.Begin(); !sample_it.AtEnd(); sample_it.Next())
       ++num_samples;
     tprintf("Iterator has charset size of %d/%d, %d shapes, %d samples\n",
             sample_it.SparseCharsetSize(), sample_it.CompactCharsetSize(),
-            test_classifier->GetShapeTable()->NumShapes(), num_samples);
+            shape_table->NumShapes(), num_samples);
     tprintf("Testing %sREPLICATED:\n", replicate_samples ? "" : "NON-");
   }
   double unichar_error = 0.0;
-  ErrorCounter::ComputeErrorRate(test_classifier, report_level,
+  ErrorCounter::ComputeErrorRate(test_classifiers, report_level,
                                  CT_SHAPE_TOP_ERR, fontinfo_table_,
                                  page_images_, &sample_it, &unichar_error,
                                  NULL, report_string);
@@ -894,70 +952,142 @@ void MasterTrainer::ReplaceFragmentedSamples() {
 // * No shape shall have more than max_shape_unichars in it,
 // * Don't merge shapes where the distance between them exceeds max_dist.
 const float kInfiniteDist = 999.0f;
+
+// Helper finds the minimum distance in the given row of the shape distance
+// matrix. The first of equal minima wins. Returns kInfiniteDist and index -1
+// if there is no finite distance in the row.
+static void FindRowMinDist(const GenericVector<ShapeDist>& row,
+                           float* min_dist, int* min_index) {
+  *min_dist = kInfiniteDist;
+  *min_index = -1;
+  for (int i = 0; i < row.size(); ++i) {
+    if (row[i].distance < *min_dist) {
+      *min_dist = row[i].distance;
+      *min_index = i;
+    }
+  }
+}
+
+// Helper sets the distance at the given index in a row of the shape distance
+// matrix, keeping the cached minimum of the row up to date.
+static void SetRowDist(int index, float dist, GenericVector<ShapeDist>* row,
+                       float* min_dist, int* min_index) {
+  (*row)[index].distance = dist;
+  if (index == *min_index) {
+    if (dist > *min_dist)
+      FindRowMinDist(*row, min_dist, min_index);
+    else
+      *min_dist = dist;
+  } else if (dist < *min_dist || (dist == *min_dist && index < *min_index)) {
+    *min_dist = dist;
+    *min_index = index;
+  }
+}
+
+// Helper returns the smallest of the cached row minima and the pair of
+// shapes that it belongs to, preferring the first in row-major order.
+static float FindMinShapeDist(const GenericVector<float>& row_min_dists,
+                              const GenericVector<int>& row_min_indices,
+                              int* min_s1, int* min_s2) {
+  float min_dist = kInfiniteDist;
+  for (int s1 = 0; s1 < row_min_dists.size(); ++s1) {
+    if (row_min_dists[s1] < min_dist) {
+      min_dist = row_min_dists[s1];
+      *min_s1 = s1;
+      *min_s2 = s1 + 1 + row_min_indices[s1];
+    }
+  }
+  return min_dist;
+}
+
+// The distances are computed in parallel, but they are deterministic, and
+// all the decisions are made serially in the original order, so the result
+// does not depend on the number of threads.
 void MasterTrainer::ClusterShapes(int min_shapes,  int max_shape_unichars,
                                   float max_dist, ShapeTable* shapes) {
   int num_shapes = shapes->NumShapes();
   int max_merges = num_shapes - min_shapes;
   GenericVector<ShapeDist>* shape_dists =
       new GenericVector<ShapeDist>[num_shapes];
-  float min_dist = kInfiniteDist;
-  int min_s1 = 0;
-  int min_s2 = 0;
+  // Minimum of each row of shape_dists, so the closest pair can be found
+  // without scanning the whole matrix after each merge.
+  GenericVector<float> row_min_dists;
+  row_min_dists.init_to_size(num_shapes, kInfiniteDist);
+  GenericVector<int> row_min_indices;
+  row_min_indices.init_to_size(num_shapes, -1);
   tprintf("Computing shape distances...");
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif  // _OPENMP
   for (int s1 = 0; s1 < num_shapes; ++s1) {
+    GenericVector<ShapeDist>& row = shape_dists[s1];
+    row.reserve(num_shapes - s1 - 1);
     for (int s2 = s1 + 1; s2 < num_shapes; ++s2) {
       ShapeDist dist(s1, s2, ShapeDistance(*shapes, s1, s2));
-      shape_dists[s1].push_back(dist);
-      if (dist.distance < min_dist) {
-        min_dist = dist.distance;
-        min_s1 = s1;
-        min_s2 = s2;
-      }
+      row.push_back(dist);
     }
-    tprintf(" %d", s1);
+    FindRowMinDist(row, &row_min_dists[s1], &row_min_indices[s1]);
   }
-  tprintf("\n");
+  tprintf(" %d\n", num_shapes);
+  int min_s1 = 0;
+  int min_s2 = 0;
+  float min_dist = FindMinShapeDist(row_min_dists, row_min_indices,
+                                    &min_s1, &min_s2);
+  // Distances of the other shapes to the result of the latest merge.
+  GenericVector<float> merged_dists;
+  merged_dists.init_to_size(num_shapes, kInfiniteDist);
   int num_merged = 0;
   while (num_merged < max_merges && min_dist < max_dist) {
     tprintf("Distance = %f: ", min_dist);
     int num_unichars = shapes->MergedUnicharCount(min_s1, min_s2);
-    shape_dists[min_s1][min_s2 - min_s1 - 1].distance = kInfiniteDist;
+    SetRowDist(min_s2 - min_s1 - 1, kInfiniteDist, &shape_dists[min_s1],
+               &row_min_dists[min_s1], &row_min_indices[min_s1]);
     if (num_unichars > max_shape_unichars) {
       tprintf("Merge of %d and %d with %d would exceed max of %d unichars\n",
               min_s1, min_s2, num_unichars, max_shape_unichars);
     } else {
       shapes->MergeShapes(min_s1, min_s2);
       shape_dists[min_s2].clear();
+      row_min_dists[min_s2] = kInfiniteDist;
+      row_min_indices[min_s2] = -1;
       ++num_merged;
 
+      // Recompute the distances that involve the merged shape in parallel.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif  // _OPENMP
+      for (int s = 0; s < num_shapes; ++s) {
+        merged_dists[s] = kInfiniteDist;
+        if (s < min_s1) {
+          if (!shape_dists[s].empty())
+            merged_dists[s] = ShapeDistance(*shapes, s, min_s1);
+        } else if (s > min_s1) {
+          if (shape_dists[min_s1][s - min_s1 - 1].distance < kInfiniteDist)
+            merged_dists[s] = ShapeDistance(*shapes, min_s1, s);
+        }
+      }
       for (int s = 0; s < min_s1; ++s) {
         if (!shape_dists[s].empty()) {
-          shape_dists[s][min_s1 - s - 1].distance =
-              ShapeDistance(*shapes, s, min_s1);
-          shape_dists[s][min_s2 - s -1].distance = kInfiniteDist;
+          SetRowDist(min_s1 - s - 1, merged_dists[s], &shape_dists[s],
+                     &row_min_dists[s], &row_min_indices[s]);
+          SetRowDist(min_s2 - s - 1, kInfiniteDist, &shape_dists[s],
+                     &row_min_dists[s], &row_min_indices[s]);
         }
       }
       for (int s2 = min_s1 + 1; s2 < num_shapes; ++s2) {
         if (shape_dists[min_s1][s2 - min_s1 - 1].distance < kInfiniteDist)
-          shape_dists[min_s1][s2 - min_s1 - 1].distance =
-              ShapeDistance(*shapes, min_s1, s2);
+          SetRowDist(s2 - min_s1 - 1, merged_dists[s2], &shape_dists[min_s1],
+                     &row_min_dists[min_s1], &row_min_indices[min_s1]);
       }
       for (int s = min_s1 + 1; s < min_s2; ++s) {
         if (!shape_dists[s].empty()) {
-          shape_dists[s][min_s2 - s - 1].distance = kInfiniteDist;
-        }
-      }
-    }
-    min_dist = kInfiniteDist;
-    for (int s1 = 0; s1 < num_shapes; ++s1) {
-      for (int i = 0; i < shape_dists[s1].size(); ++i) {
-        if (shape_dists[s1][i].distance < min_dist) {
-          min_dist = shape_dists[s1][i].distance;
-          min_s1 = s1;
-          min_s2 = s1 + 1 + i;
+          SetRowDist(min_s2 - s - 1, kInfiniteDist, &shape_dists[s],
+                     &row_min_dists[s], &row_min_indices[s]);
         }
       }
     }
+    min_dist = FindMinShapeDist(row_min_dists, row_min_indices,
+                                &min_s1, &min_s2);
   }
   tprintf("Stopped with %d merged, min dist %f\n", num_merged, min_dist);
   delete [] shape_dists;
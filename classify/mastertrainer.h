@@ -36,6 +36,7 @@
 #include "intfeaturemap.h"
 #include "intmatcher.h"
 #include "params.h"
+#include "samplestore.h"
 #include "shapetable.h"
 #include "trainingsample.h"
 #include "trainingsampleset.h"
@@ -89,9 +90,17 @@ class MasterTrainer {
   // Reads the samples and their features from the given file,
   // adding them to the trainer with the font_id from the content of the file.
   // If verification, then these are verification samples, not training.
+  // If writer is not NULL, each sample is also written to it, to convert the
+  // text file to a binary SampleStore for later runs.
   void ReadTrainingSamples(FILE  *fp,
                            const FEATURE_DEFS_STRUCT& feature_defs,
-                           bool verification);
+                           bool verification,
+                           SampleStoreWriter* writer = NULL);
+  // Memory-maps the given binary SampleStore file written by
+  // ReadTrainingSamples, and adds its samples to the trainer as
+  // ReadTrainingSamples would. The samples point into the mapped file, which
+  // is kept open for the life of the trainer. Returns false in case of error.
+  bool ReadSampleStore(const char* filename, bool verification);
 
   // Adds the given single sample to the trainer, setting the classid
   // appropriately from the given unichar_str.
@@ -213,6 +222,11 @@ class MasterTrainer {
                                bool replicate_samples,
                                ShapeClassifier* test_classifier,
                                STRING* report_string);
+  // As above, but runs in parallel with one of test_classifiers per thread.
+  void TestClassifierOnSamples(
+      int report_level, bool replicate_samples,
+      const GenericVector<ShapeClassifier*>& test_classifiers,
+      STRING* report_string);
   // Tests the given test_classifier on the given samples
   // report_levels:
   // 0 = no output.
@@ -230,6 +244,13 @@ class MasterTrainer {
                         TrainingSampleSet* samples,
                         ShapeClassifier* test_classifier,
                         STRING* report_string);
+  // As above, but runs in parallel with one of test_classifiers per thread.
+  // The classifiers must not share any mutable state.
+  double TestClassifier(int report_level,
+                        bool replicate_samples,
+                        TrainingSampleSet* samples,
+                        const GenericVector<ShapeClassifier*>& test_classifiers,
+                        STRING* report_string);
 
   // Returns the average (in some sense) distance between the two given
   // shapes, which may contain multiple fonts and/or unichars.
@@ -255,6 +276,8 @@ class MasterTrainer {
   UNICHARSET unicharset_;
   // Original feature space. Subspace mapping is contained in feature_map_.
   IntFeatureSpace feature_space_;
+  // Mapped sample files that samples may point into. Owned by the trainer.
+  GenericVector<SampleStore*> sample_stores_;
   TrainingSampleSet samples_;
   TrainingSampleSet junk_samples_;
   TrainingSampleSet verify_samples_;
@@ -33,11 +33,13 @@
               Private Code
 ----------------------------------------------------------------------------**/
 /*---------------------------------------------------------------------------*/
-FEATURE_SET ExtractMicros(TBLOB *Blob, const DENORM& denorm) {
+FEATURE_SET ExtractMicros(TBLOB *Blob, const DENORM& denorm,
+                          const FEATURE_EXT_PARAMS& fx_params) {
 /*
  **	Parameters:
  **		Blob		blob to extract micro-features from
  **		denorm  control parameter to feature extractor.
+ **		fx_params  engine params for the feature extractors
  **	Globals: none
  **	Operation: Call the old micro-feature extractor and then copy
  **		the features into the new format.  Then deallocate the
@@ -52,7 +54,7 @@ FEATURE_SET ExtractMicros(TBLOB *Blob, const DENORM& denorm) {
   FEATURE Feature;
   MICROFEATURE OldFeature;
 
-  OldFeatures = (MICROFEATURES)BlobMicroFeatures(Blob, denorm);
+  OldFeatures = (MICROFEATURES)BlobMicroFeatures(Blob, denorm, fx_params);
   if (OldFeatures == NULL)
     return NULL;
   NumFeatures = count (OldFeatures);
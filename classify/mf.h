@@ -34,6 +34,7 @@ typedef float MicroFeature[MFCount];
 /*----------------------------------------------------------------------------
           Private Function Prototypes
 -----------------------------------------------------------------------------*/
-FEATURE_SET ExtractMicros(TBLOB *Blob, const DENORM& denorm);
+FEATURE_SET ExtractMicros(TBLOB *Blob, const DENORM& denorm,
+                          const FEATURE_EXT_PARAMS& fx_params);
 
 #endif
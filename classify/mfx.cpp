@@ -28,16 +28,6 @@
 
 #include <math.h>
 
-/**----------------------------------------------------------------------------
-          Variables
-----------------------------------------------------------------------------**/
-
-/* old numbers corresponded to 10.0 degrees and 80.0 degrees */
-double_VAR(classify_min_slope, 0.414213562,
-           "Slope below which lines are called horizontal");
-double_VAR(classify_max_slope, 2.414213562,
-           "Slope above which lines are called vertical");
-
 /**----------------------------------------------------------------------------
           Macros
 ----------------------------------------------------------------------------**/
@@ -59,11 +49,13 @@ MICROFEATURE ExtractMicroFeature(MFOUTLINE Start, MFOUTLINE End);
 ----------------------------------------------------------------------------**/
 
 /*---------------------------------------------------------------------------*/
-CHAR_FEATURES BlobMicroFeatures(TBLOB *Blob, const DENORM& denorm) {
+CHAR_FEATURES BlobMicroFeatures(TBLOB *Blob, const DENORM& denorm,
+                                const FEATURE_EXT_PARAMS& fx_params) {
 /*
  **      Parameters:
  **              Blob            blob to extract micro-features from
  **              denorm          control parameter to feature extractor
+ **              fx_params       engine params for the feature extractors
  **      Operation:
  **              This routine extracts micro-features from the specified
  **              blob and returns a list of the micro-features.  All
@@ -84,7 +76,8 @@ CHAR_FEATURES BlobMicroFeatures(TBLOB *Blob, const DENORM& denorm) {
 
   if (Blob != NULL) {
     Outlines = ConvertBlob (Blob);
-    if (!ExtractIntFeat(Blob, denorm, blfeatures, cnfeatures, &results))
+    if (!ExtractIntFeat(Blob, denorm, blfeatures, cnfeatures, &results,
+                        fx_params.RadiusLimits))
       return NULL;
     XScale = 0.2f / results.Ry;
     YScale = 0.2f / results.Rx;
@@ -100,7 +93,7 @@ CHAR_FEATURES BlobMicroFeatures(TBLOB *Blob, const DENORM& denorm) {
     RemainingOutlines = Outlines;
     iterate(RemainingOutlines) {
       Outline = (MFOUTLINE) first_node (RemainingOutlines);
-      FindDirectionChanges(Outline, classify_min_slope, classify_max_slope);
+      FindDirectionChanges(Outline, fx_params.MinSlope, fx_params.MaxSlope);
       MarkDirectionChanges(Outline);
       MicroFeatures = ConvertToMicroFeatures (Outline, MicroFeatures);
     }
@@ -22,19 +22,10 @@
           Include Files and Type Defines
 ----------------------------------------------------------------------------**/
 #include "params.h"
-/**----------------------------------------------------------------------------
-          Variables
-----------------------------------------------------------------------------**/
-
-/* old numbers corresponded to 10.0 degrees and 80.0 degrees */
-extern double_VAR_H(classify_min_slope, 0.414213562,
-                    "Slope below which lines are called horizontal");
-extern double_VAR_H(classify_max_slope, 2.414213562,
-                    "Slope above which lines are called vertical");
-
 /**----------------------------------------------------------------------------
           Public Function Prototypes
 ----------------------------------------------------------------------------**/
-CHAR_FEATURES BlobMicroFeatures(TBLOB *Blob, const DENORM& denorm);
+CHAR_FEATURES BlobMicroFeatures(TBLOB *Blob, const DENORM& denorm,
+                                const FEATURE_EXT_PARAMS& fx_params);
 
 #endif
@@ -59,7 +59,8 @@ FLOAT32 ActualOutlineLength(FEATURE Feature) {
 //     the x center of the grapheme's bounding box.
 //     English: [0.011, 0.31]
 //
-FEATURE_SET ExtractCharNormFeatures(TBLOB *blob, const DENORM& denorm) {
+FEATURE_SET ExtractCharNormFeatures(TBLOB *blob, const DENORM& denorm,
+                                    const FEATURE_EXT_PARAMS& fx_params) {
   FEATURE_SET feature_set = NewFeatureSet(1);
   FEATURE feature = NewFeature(&CharNormDesc);
 
@@ -67,7 +68,8 @@ FEATURE_SET ExtractCharNormFeatures(TBLOB *blob, const DENORM& denorm) {
   INT_FEATURE_ARRAY cnfeatures;
   INT_FX_RESULT_STRUCT FXInfo;
 
-  ExtractIntFeat(blob, denorm, blfeatures, cnfeatures, &FXInfo);
+  ExtractIntFeat(blob, denorm, blfeatures, cnfeatures, &FXInfo,
+                 fx_params.RadiusLimits);
 
   feature->Params[CharNormY] =
       MF_SCALE_FACTOR * (FXInfo.Ymean - BASELINE_OFFSET);
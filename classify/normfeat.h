@@ -34,6 +34,7 @@ typedef enum {
 ----------------------------------------------------------------------------**/
 FLOAT32 ActualOutlineLength(FEATURE Feature);
 
-FEATURE_SET ExtractCharNormFeatures(TBLOB *Blob, const DENORM& denorm);
+FEATURE_SET ExtractCharNormFeatures(TBLOB *Blob, const DENORM& denorm,
+                                    const FEATURE_EXT_PARAMS& fx_params);
 
 #endif
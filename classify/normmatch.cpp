@@ -46,22 +46,12 @@ struct NORM_PROTOS
 /**----------------------------------------------------------------------------
           Private Function Prototypes
 ----------------------------------------------------------------------------**/
-double NormEvidenceOf(register double NormAdj);
-
-void PrintNormMatch(FILE *File,
-                    int NumParams,
-                    PROTOTYPE *Proto,
-                    FEATURE Feature);
-
 NORM_PROTOS *ReadNormProtos(FILE *File);
 
 /**----------------------------------------------------------------------------
         Variables
 ----------------------------------------------------------------------------**/
 
-/* control knobs used to control the normalization adjustment process */
-double_VAR(classify_norm_adj_midpoint, 32.0, "Norm adjust midpoint ...");
-double_VAR(classify_norm_adj_curl, 2.0, "Norm adjust curl ...");
 // Weight of width variance against height and vertical position.
 const double kWidthErrorWeighting = 0.125;
 
@@ -176,7 +166,8 @@ void Classify::FreeNormProtos() {
  * normalization adjustment.  The equation that represents the transform is:
  *       1 / (1 + (NormAdj / midpoint) ^ curl)
  **********************************************************************/
-double NormEvidenceOf(register double NormAdj) {
+namespace tesseract {
+double Classify::NormEvidenceOf(register double NormAdj) const {
   NormAdj /= classify_norm_adj_midpoint;
 
   if (classify_norm_adj_curl == 3)
@@ -190,10 +181,10 @@ double NormEvidenceOf(register double NormAdj) {
 
 
 /*---------------------------------------------------------------------------*/
-void PrintNormMatch(FILE *File,
-                    int NumParams,
-                    PROTOTYPE *Proto,
-                    FEATURE Feature) {
+void Classify::PrintNormMatch(FILE *File,
+                              int NumParams,
+                              PROTOTYPE *Proto,
+                              FEATURE Feature) const {
 /*
  **	Parameters:
  **		File		open text file to dump match debug info to
@@ -226,7 +217,6 @@ void PrintNormMatch(FILE *File,
 
 
 /*---------------------------------------------------------------------------*/
-namespace tesseract {
 NORM_PROTOS *Classify::ReadNormProtos(FILE *File, inT64 end_offset) {
 /*
  **	Parameters:
@@ -25,13 +25,4 @@
 #include "ocrfeatures.h"
 #include "params.h"
 
-/**----------------------------------------------------------------------------
-        Variables
-----------------------------------------------------------------------------**/
-
-/* control knobs used to control the normalization adjustment process */
-extern double_VAR_H(classify_norm_adj_midpoint, 32.0,
-                    "Norm adjust midpoint ...");
-extern double_VAR_H(classify_norm_adj_curl, 2.0, "Norm adjust curl ...");
-
 #endif
@@ -36,16 +36,16 @@
           Variables
 ----------------------------------------------------------------------------*/
 
-double_VAR(classify_pico_feature_length, 0.05, "Pico Feature Length");
-
 /*---------------------------------------------------------------------------
           Private Function Prototypes
 ----------------------------------------------------------------------------*/
 void ConvertSegmentToPicoFeat(FPOINT *Start,
                               FPOINT *End,
+                              double FeatureLength,
                               FEATURE_SET FeatureSet);
 
-void ConvertToPicoFeatures2(MFOUTLINE Outline, FEATURE_SET FeatureSet);
+void ConvertToPicoFeatures2(MFOUTLINE Outline, double FeatureLength,
+                            FEATURE_SET FeatureSet);
 
 void NormalizePicoX(FEATURE_SET FeatureSet);
 
@@ -78,7 +78,7 @@ FEATURE_SET Classify::ExtractPicoFeatures(TBLOB *Blob) {
   RemainingOutlines = Outlines;
   iterate(RemainingOutlines) {
     Outline = (MFOUTLINE) first_node (RemainingOutlines);
-    ConvertToPicoFeatures2(Outline, FeatureSet);
+    ConvertToPicoFeatures2(Outline, classify_pico_feature_length, FeatureSet);
   }
   if (classify_norm_method == baseline)
     NormalizePicoX(FeatureSet);
@@ -94,14 +94,15 @@ FEATURE_SET Classify::ExtractPicoFeatures(TBLOB *Blob) {
 /*---------------------------------------------------------------------------*/
 void ConvertSegmentToPicoFeat(FPOINT *Start,
                               FPOINT *End,
+                              double FeatureLength,
                               FEATURE_SET FeatureSet) {
 /*
  **	Parameters:
  **		Start		starting point of pico-feature
  **		End		ending point of pico-feature
+ **		FeatureLength	length of a single pico-feature
  **		FeatureSet	set to add pico-feature to
- **	Globals:
- **		classify_pico_feature_length	length of a single pico-feature
+ **	Globals: none
  **	Operation: This routine converts an entire segment of an outline
  **		into a set of pico features which are added to
  **		FeatureSet.  The length of the segment is rounded to the
@@ -121,7 +122,7 @@ void ConvertSegmentToPicoFeat(FPOINT *Start,
 
   Angle = NormalizedAngleFrom (Start, End, 1.0);
   Length = DistanceBetween (*Start, *End);
-  NumFeatures = (int) floor (Length / classify_pico_feature_length + 0.5);
+  NumFeatures = (int) floor (Length / FeatureLength + 0.5);
   if (NumFeatures < 1)
     NumFeatures = 1;
 
@@ -148,14 +149,14 @@ void ConvertSegmentToPicoFeat(FPOINT *Start,
 
 
 /*---------------------------------------------------------------------------*/
-void ConvertToPicoFeatures2(MFOUTLINE Outline, FEATURE_SET FeatureSet) {
+void ConvertToPicoFeatures2(MFOUTLINE Outline, double FeatureLength,
+                            FEATURE_SET FeatureSet) {
 /*
  **	Parameters:
  **		Outline		outline to extract micro-features from
+ **		FeatureLength	length of features to be extracted
  **		FeatureSet	set of features to add pico-features to
- **	Globals:
- **		classify_pico_feature_length
- **                             length of features to be extracted
+ **	Globals: none
  **	Operation:
  **		This routine steps thru the specified outline and cuts it
  **		up into pieces of equal length.  These pieces become the
@@ -183,7 +184,7 @@ void ConvertToPicoFeatures2(MFOUTLINE Outline, FEATURE_SET FeatureSet) {
        starting point for that edge. */
     if (!(PointAt(Next)->Hidden))
       ConvertSegmentToPicoFeat (&(PointAt(Current)->Point),
-        &(PointAt(Next)->Point), FeatureSet);
+        &(PointAt(Next)->Point), FeatureLength, FeatureSet);
 
     Current = Next;
     Next = NextPointAfter(Current);
@@ -224,17 +225,19 @@ void NormalizePicoX(FEATURE_SET FeatureSet) {
 }                                /* NormalizePicoX */
 
 /*---------------------------------------------------------------------------*/
-FEATURE_SET ExtractIntCNFeatures(TBLOB *blob, const DENORM& denorm) {
+FEATURE_SET ExtractIntCNFeatures(TBLOB *blob, const DENORM& denorm,
+                                 const FEATURE_EXT_PARAMS& fx_params) {
 /*
  ** Parameters:
  **   blob    blob to extract features from
  **   denorm  normalization/denormalization parameters.
+ **   fx_params  engine params for the feature extractors.
  ** Return: Integer character-normalized features for blob.
  ** Exceptions: none
  ** History: 8/8/2011, rays, Created.
  */
   tesseract::TrainingSample* sample = GetIntFeatures(
-      tesseract::NM_CHAR_ANISOTROPIC, blob, denorm);
+      tesseract::NM_CHAR_ANISOTROPIC, blob, denorm, fx_params.RadiusLimits);
   if (sample == NULL) return NULL;
 
   int num_features = sample->num_features();
@@ -254,17 +257,19 @@ FEATURE_SET ExtractIntCNFeatures(TBLOB *blob, const DENORM& denorm) {
 }                                /* ExtractIntCNFeatures */
 
 /*---------------------------------------------------------------------------*/
-FEATURE_SET ExtractIntGeoFeatures(TBLOB *blob, const DENORM& denorm) {
+FEATURE_SET ExtractIntGeoFeatures(TBLOB *blob, const DENORM& denorm,
+                                  const FEATURE_EXT_PARAMS& fx_params) {
 /*
  ** Parameters:
  **   blob    blob to extract features from
  **   denorm  normalization/denormalization parameters.
+ **   fx_params  engine params for the feature extractors.
  ** Return: Geometric (top/bottom/width) features for blob.
  ** Exceptions: none
  ** History: 8/8/2011, rays, Created.
  */
   tesseract::TrainingSample* sample = GetIntFeatures(
-      tesseract::NM_CHAR_ANISOTROPIC, blob, denorm);
+      tesseract::NM_CHAR_ANISOTROPIC, blob, denorm, fx_params.RadiusLimits);
   if (sample == NULL) return NULL;
 
   FEATURE_SET feature_set = NewFeatureSet(1);
@@ -46,20 +46,15 @@ PICO_FEAT_PARAM_NAME;
 
 #define MAX_PICO_FEATURES (1000)
 
-/*---------------------------------------------------------------------------
-          Variables
-----------------------------------------------------------------------------*/
-
-extern double_VAR_H(classify_pico_feature_length, 0.05, "Pico Feature Length");
-
-
 /**----------------------------------------------------------------------------
           Public Function Prototypes
 ----------------------------------------------------------------------------**/
 #define GetPicoFeatureLength()  (PicoFeatureLength)
 
-FEATURE_SET ExtractIntCNFeatures(TBLOB *Blob, const DENORM& denorm);
-FEATURE_SET ExtractIntGeoFeatures(TBLOB *Blob, const DENORM& denorm);
+FEATURE_SET ExtractIntCNFeatures(TBLOB *Blob, const DENORM& denorm,
+                                 const FEATURE_EXT_PARAMS& fx_params);
+FEATURE_SET ExtractIntGeoFeatures(TBLOB *Blob, const DENORM& denorm,
+                                  const FEATURE_EXT_PARAMS& fx_params);
 
 /**----------------------------------------------------------------------------
         Global Data Definitions and Declarations
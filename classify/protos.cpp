@@ -47,8 +47,6 @@
 ----------------------------------------------------------------------*/
 CLASS_STRUCT TrainingData[NUMBER_OF_CLASSES];
 
-STRING_VAR(classify_training_file, "MicroFeatures", "Training file");
-
 /*----------------------------------------------------------------------
               F u n c t i o n s
 ----------------------------------------------------------------------*/
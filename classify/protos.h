@@ -79,8 +79,6 @@ typedef CLASS_STRUCT *CLASSES;
 ----------------------------------------------------------------------*/
 extern CLASS_STRUCT TrainingData[];
 
-extern STRING_VAR_H(classify_training_file, "MicroFeatures", "Training file");
-
 /*----------------------------------------------------------------------
               M a c r o s
 ----------------------------------------------------------------------*/
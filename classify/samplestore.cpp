@@ -0,0 +1,339 @@
+///////////////////////////////////////////////////////////////////////
+// File:        samplestore.cpp
+// Description: Binary, memory-mapped file of training samples.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+///////////////////////////////////////////////////////////////////////
+
+#ifdef HAVE_CONFIG_H
+#include "config_auto.h"
+#endif
+
+#include "samplestore.h"
+
+#include <stddef.h>
+#include <string.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "tprintf.h"
+
+namespace tesseract {
+
+// Identifies a SampleStore file.
+static const char kSampleStoreMagic[8] = {'t', 'e', 's', 's', 'm', 'p', 'l',
+                                          '\0'};
+// Written in native byte order to detect a file from the wrong endianness.
+static const inT32 kSampleStoreByteOrder = 0x01020304;
+// Changes whenever SampleStoreRecord changes.
+static const inT32 kSampleStoreVersion = 1;
+
+struct SampleStoreHeader {
+  char magic[8];
+  inT32 byte_order;
+  inT32 version;
+  inT32 num_samples;
+  inT32 record_offset;
+};
+
+// Rounds size up to a multiple of 4, to keep the records float-aligned.
+static int Pad4(int size) {
+  return (size + 3) & ~3;
+}
+
+// Size of the strings at the end of a record, including padding.
+static int StringSize(const SampleStoreRecord* record) {
+  return Pad4(record->font_name_length + record->unichar_length);
+}
+
+// Returns true if the record fits in the given number of bytes and its
+// record_size matches its string lengths and feature counts, and the
+// strings are null-terminated, so its parts can be used without further
+// checks.
+static bool IsValidRecord(const SampleStoreRecord* record, size_t space) {
+  if (record->record_size < static_cast<int>(sizeof(*record)) ||
+      (record->record_size & 3) != 0 ||
+      static_cast<size_t>(record->record_size) > space)
+    return false;
+  if (record->font_name_length < 1 || record->unichar_length < 1 ||
+      record->num_features < 0 || record->num_micro_features < 0)
+    return false;
+  // All in 64 bits, so that huge counts can't wrap around to a valid size.
+  inT64 feature_size =
+      static_cast<inT64>(record->num_features) * sizeof(INT_FEATURE_STRUCT);
+  inT64 micro_size =
+      static_cast<inT64>(record->num_micro_features) * sizeof(MicroFeature);
+  inT64 expected_size = sizeof(*record) + StringSize(record) +
+      ((feature_size + 3) & ~3) + micro_size;
+  if (expected_size != record->record_size)
+    return false;
+  const char* font_name = reinterpret_cast<const char*>(record + 1);
+  return font_name[record->font_name_length - 1] == '\0' &&
+      font_name[record->font_name_length + record->unichar_length - 1] == '\0';
+}
+
+SampleStore::SampleStore()
+  : data_(NULL), size_(0), num_samples_(0), mapped_(false) {
+}
+
+SampleStore::~SampleStore() {
+  Close();
+}
+
+// Maps the given file. Returns false in case of error.
+bool SampleStore::Open(const char* filename) {
+  Close();
+#ifdef _WIN32
+  FILE* fp = fopen(filename, "rb");
+  if (fp == NULL) {
+    tprintf("Can't open sample file %s\n", filename);
+    return false;
+  }
+  fseek(fp, 0, SEEK_END);
+  size_ = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  char* buffer = new char[size_];
+  bool read_ok = fread(buffer, 1, size_, fp) == size_;
+  fclose(fp);
+  data_ = buffer;
+  if (!read_ok) {
+    tprintf("Can't read sample file %s\n", filename);
+    Close();
+    return false;
+  }
+#else
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0) {
+    tprintf("Can't open sample file %s\n", filename);
+    return false;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+    tprintf("Can't stat sample file %s\n", filename);
+    close(fd);
+    return false;
+  }
+  size_ = file_stat.st_size;
+  void* map = mmap(NULL, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    tprintf("Can't map sample file %s\n", filename);
+    size_ = 0;
+    return false;
+  }
+  data_ = static_cast<const char*>(map);
+  mapped_ = true;
+#endif
+  const SampleStoreHeader* header =
+      reinterpret_cast<const SampleStoreHeader*>(data_);
+  if (size_ < sizeof(*header) ||
+      memcmp(header->magic, kSampleStoreMagic, sizeof(kSampleStoreMagic)) != 0) {
+    tprintf("%s is not a sample file\n", filename);
+    Close();
+    return false;
+  }
+  if (header->byte_order != kSampleStoreByteOrder ||
+      header->version != kSampleStoreVersion) {
+    tprintf("Sample file %s was written by an incompatible machine or version,"
+            " convert it again from the tr file\n", filename);
+    Close();
+    return false;
+  }
+  if (header->record_offset < static_cast<int>(sizeof(*header)) ||
+      (header->record_offset & 3) != 0 ||
+      static_cast<size_t>(header->record_offset) > size_) {
+    tprintf("Sample file %s is corrupt\n", filename);
+    Close();
+    return false;
+  }
+  // Check every record and that they exactly fill the file, so that they
+  // can be trusted afterwards.
+  size_t offset = header->record_offset;
+  int count = 0;
+  while (offset + sizeof(SampleStoreRecord) <= size_) {
+    const SampleStoreRecord* record =
+        reinterpret_cast<const SampleStoreRecord*>(data_ + offset);
+    if (!IsValidRecord(record, size_ - offset))
+      break;
+    offset += record->record_size;
+    ++count;
+  }
+  if (offset != size_ || count != header->num_samples) {
+    tprintf("Sample file %s is corrupt or truncated\n", filename);
+    Close();
+    return false;
+  }
+  num_samples_ = count;
+  return true;
+}
+
+// Releases the mapping. Any samples made from it become invalid.
+void SampleStore::Close() {
+  if (data_ != NULL) {
+#ifdef _WIN32
+    delete [] data_;
+#else
+    if (mapped_)
+      munmap(const_cast<char*>(data_), size_);
+#endif
+  }
+  data_ = NULL;
+  size_ = 0;
+  num_samples_ = 0;
+  mapped_ = false;
+}
+
+// Returns the first record, or NULL if there are none.
+const SampleStoreRecord* SampleStore::First() const {
+  if (num_samples_ == 0)
+    return NULL;
+  const SampleStoreHeader* header =
+      reinterpret_cast<const SampleStoreHeader*>(data_);
+  return reinterpret_cast<const SampleStoreRecord*>(data_ +
+                                                    header->record_offset);
+}
+
+// Returns the record after the given one, or NULL at the end.
+const SampleStoreRecord* SampleStore::Next(
+    const SampleStoreRecord* record) const {
+  const char* next = reinterpret_cast<const char*>(record) +
+      record->record_size;
+  if (next >= data_ + size_)
+    return NULL;
+  return reinterpret_cast<const SampleStoreRecord*>(next);
+}
+
+const char* SampleStore::FontName(const SampleStoreRecord* record) {
+  return reinterpret_cast<const char*>(record + 1);
+}
+
+const char* SampleStore::Unichar(const SampleStoreRecord* record) {
+  return FontName(record) + record->font_name_length;
+}
+
+const INT_FEATURE_STRUCT* SampleStore::Features(
+    const SampleStoreRecord* record) {
+  return reinterpret_cast<const INT_FEATURE_STRUCT*>(
+      FontName(record) + StringSize(record));
+}
+
+const MicroFeature* SampleStore::MicroFeatures(
+    const SampleStoreRecord* record) {
+  const char* features = reinterpret_cast<const char*>(Features(record));
+  return reinterpret_cast<const MicroFeature*>(
+      features + Pad4(record->num_features * sizeof(INT_FEATURE_STRUCT)));
+}
+
+// Returns a new TrainingSample for the record that refers to the mapped
+// features instead of copying them.
+TrainingSample* SampleStore::MakeSample(const SampleStoreRecord* record) {
+  TrainingSample* sample = new TrainingSample;
+  sample->set_page_num(record->page_num);
+  sample->set_bounding_box(TBOX(record->left, record->bottom,
+                                record->right, record->top));
+  sample->SetUnownedFeatures(record->num_features, Features(record),
+                             record->num_micro_features, MicroFeatures(record),
+                             record->cn_feature, record->geo_feature);
+  return sample;
+}
+
+SampleStoreWriter::SampleStoreWriter() : fp_(NULL), num_samples_(0) {
+}
+
+SampleStoreWriter::~SampleStoreWriter() {
+  if (fp_ != NULL)
+    Close();
+}
+
+// Creates the given file. Returns false in case of error.
+bool SampleStoreWriter::Open(const char* filename) {
+  fp_ = fopen(filename, "wb");
+  if (fp_ == NULL) {
+    tprintf("Can't create sample file %s\n", filename);
+    return false;
+  }
+  num_samples_ = 0;
+  SampleStoreHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, kSampleStoreMagic, sizeof(kSampleStoreMagic));
+  header.byte_order = kSampleStoreByteOrder;
+  header.version = kSampleStoreVersion;
+  header.record_offset = sizeof(header);
+  return fwrite(&header, sizeof(header), 1, fp_) == 1;
+}
+
+// Appends the sample with the given font name and unichar.
+bool SampleStoreWriter::Write(const char* font_name, const char* unichar,
+                              const TrainingSample& sample) {
+  SampleStoreRecord record;
+  memset(&record, 0, sizeof(record));
+  const TBOX& box = sample.bounding_box();
+  record.page_num = sample.page_num();
+  record.left = box.left();
+  record.bottom = box.bottom();
+  record.right = box.right();
+  record.top = box.top();
+  record.num_features = sample.num_features();
+  record.num_micro_features = sample.num_micro_features();
+  for (int i = 0; i < kNumCNParams; ++i)
+    record.cn_feature[i] = sample.cn_feature(i);
+  for (int i = 0; i < GeoCount; ++i)
+    record.geo_feature[i] = sample.geo_feature(i);
+  record.font_name_length = strlen(font_name) + 1;
+  record.unichar_length = strlen(unichar) + 1;
+  int string_size = StringSize(&record);
+  int feature_size = record.num_features * sizeof(INT_FEATURE_STRUCT);
+  int micro_size = record.num_micro_features * sizeof(MicroFeature);
+  record.record_size = sizeof(record) + string_size + Pad4(feature_size) +
+      micro_size;
+
+  static const char kPadding[4] = {0, 0, 0, 0};
+  if (fwrite(&record, sizeof(record), 1, fp_) != 1 ||
+      fwrite(font_name, 1, record.font_name_length, fp_) !=
+          static_cast<size_t>(record.font_name_length) ||
+      fwrite(unichar, 1, record.unichar_length, fp_) !=
+          static_cast<size_t>(record.unichar_length) ||
+      fwrite(kPadding, 1, string_size - record.font_name_length -
+             record.unichar_length, fp_) !=
+          static_cast<size_t>(string_size - record.font_name_length -
+                              record.unichar_length))
+    return false;
+  if (feature_size > 0 &&
+      (fwrite(sample.features(), 1, feature_size, fp_) !=
+           static_cast<size_t>(feature_size) ||
+       fwrite(kPadding, 1, Pad4(feature_size) - feature_size, fp_) !=
+           static_cast<size_t>(Pad4(feature_size) - feature_size)))
+    return false;
+  if (micro_size > 0 &&
+      fwrite(sample.micro_features(), 1, micro_size, fp_) !=
+          static_cast<size_t>(micro_size))
+    return false;
+  ++num_samples_;
+  return true;
+}
+
+// Finishes the file by writing the sample count into the header.
+bool SampleStoreWriter::Close() {
+  bool success = true;
+  if (fseek(fp_, offsetof(SampleStoreHeader, num_samples), SEEK_SET) != 0 ||
+      fwrite(&num_samples_, sizeof(num_samples_), 1, fp_) != 1)
+    success = false;
+  if (fclose(fp_) != 0)
+    success = false;
+  fp_ = NULL;
+  return success;
+}
+
+}  // namespace tesseract
@@ -0,0 +1,116 @@
+///////////////////////////////////////////////////////////////////////
+// File:        samplestore.h
+// Description: Binary, memory-mapped file of training samples.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+///////////////////////////////////////////////////////////////////////
+
+#ifndef TESSERACT_TRAINING_SAMPLESTORE_H__
+#define TESSERACT_TRAINING_SAMPLESTORE_H__
+
+#include <stdio.h>
+#include "host.h"
+#include "intproto.h"
+#include "mf.h"
+#include "picofeat.h"
+#include "trainingsample.h"
+
+namespace tesseract {
+
+// Fixed part of each sample in a SampleStore file. It is followed in the
+// file by the null-terminated font name and unichar, padded to a multiple of
+// 4 bytes, then num_features INT_FEATURE_STRUCTs and num_micro_features
+// MicroFeatures, again padded to a multiple of 4 bytes. record_size covers
+// the whole lot, so the next record starts record_size bytes further on.
+struct SampleStoreRecord {
+  inT32 record_size;
+  inT32 page_num;
+  inT16 left, bottom, right, top;
+  inT32 num_features;
+  inT32 num_micro_features;
+  float cn_feature[kNumCNParams];
+  inT32 geo_feature[GeoCount];
+  inT16 font_name_length;  // Including the terminating null.
+  inT16 unichar_length;    // Including the terminating null.
+};
+
+// Binary container of training samples, written once from the text .tr
+// files by SampleStoreWriter and read back by memory-mapping the whole file.
+// The samples are used in place: TrainingSamples made by MakeSample point
+// straight at the mapped feature arrays, so there is no parsing and no
+// per-feature allocation, but the SampleStore must outlive them.
+// The file is written in native byte order, and a file of the wrong byte
+// order is rejected rather than swapped, as swapping would mean a copy.
+class SampleStore {
+ public:
+  SampleStore();
+  ~SampleStore();
+
+  // Maps the given file. Returns false in case of error.
+  bool Open(const char* filename);
+  // Releases the mapping. Any samples made from it become invalid.
+  void Close();
+
+  int num_samples() const {
+    return num_samples_;
+  }
+  // Returns the first record, or NULL if there are none.
+  const SampleStoreRecord* First() const;
+  // Returns the record after the given one, or NULL at the end.
+  const SampleStoreRecord* Next(const SampleStoreRecord* record) const;
+
+  // Accessors for the variable-length parts of a record.
+  static const char* FontName(const SampleStoreRecord* record);
+  static const char* Unichar(const SampleStoreRecord* record);
+  static const INT_FEATURE_STRUCT* Features(const SampleStoreRecord* record);
+  static const MicroFeature* MicroFeatures(const SampleStoreRecord* record);
+
+  // Returns a new TrainingSample for the record that refers to the mapped
+  // features instead of copying them. The font_id and class_id are left
+  // for the caller to set. Delete the return value after use.
+  static TrainingSample* MakeSample(const SampleStoreRecord* record);
+
+ private:
+  // Start of the file contents, either mapped or read into memory.
+  const char* data_;
+  // Size of the file in bytes.
+  size_t size_;
+  // Number of samples in the file.
+  int num_samples_;
+  // True if data_ was mapped rather than allocated.
+  bool mapped_;
+};
+
+// Writes TrainingSamples into the file format read by SampleStore.
+class SampleStoreWriter {
+ public:
+  SampleStoreWriter();
+  ~SampleStoreWriter();
+
+  // Creates the given file. Returns false in case of error.
+  bool Open(const char* filename);
+  // Appends the sample with the given font name and unichar.
+  // Returns false in case of error.
+  bool Write(const char* font_name, const char* unichar,
+             const TrainingSample& sample);
+  // Finishes the file by writing the sample count into the header.
+  // Returns false in case of error.
+  bool Close();
+
+ private:
+  FILE* fp_;
+  int num_samples_;
+};
+
+}  // namespace tesseract
+
+#endif  // TESSERACT_TRAINING_SAMPLESTORE_H__
@@ -24,18 +24,6 @@
 #include "ratngs.h"
 #include "params.h"
 
-/*-----------------------------------------------------------------------------
-        Global Data Definitions and Declarations
------------------------------------------------------------------------------*/
-/** define control knobs for adjusting definition of speckle*/
-double_VAR(speckle_large_max_size, 0.30, "Max large speckle size");
-
-double_VAR(speckle_small_penalty, 10.0, "Small speckle penalty");
-
-double_VAR(speckle_large_penalty, 10.0, "Large speckle penalty");
-
-double_VAR(speckle_small_certainty, -1.0, "Small speckle certainty");
-
 /*-----------------------------------------------------------------------------
               Public Code
 -----------------------------------------------------------------------------*/
@@ -47,19 +35,17 @@ double_VAR(speckle_small_certainty, -1.0, "Small speckle certainty");
  * certainty of the worst choice in Choices.  The new choice
  * is added to the end of Choices.
  *
- * Globals:
- * - #speckle_small_penalty rating for a small speckle
- * - #speckle_large_penalty rating penalty for a large speckle
- * - #speckle_small_certainty certainty for a small speckle
- *
  * @param Choices choices to add a speckle choice to
+ * @param small_certainty certainty for a small speckle
+ * @param large_penalty rating penalty for a large speckle
  *
  * @return New Choices list with null choice added to end.
  *
  * Exceptions: none
  * History: Mon Mar 11 11:08:11 1991, DSJ, Created.
  */
-void AddLargeSpeckleTo(BLOB_CHOICE_LIST *Choices) {
+void AddLargeSpeckleTo(BLOB_CHOICE_LIST *Choices, double small_certainty,
+                       double large_penalty) {
   assert(Choices != NULL);
   BLOB_CHOICE *blob_choice;
   BLOB_CHOICE_IT temp_it;
@@ -69,8 +55,8 @@ void AddLargeSpeckleTo(BLOB_CHOICE_LIST *Choices) {
   // the large speckle penalty.
   if (Choices->length() == 0) {
     blob_choice =
-      new BLOB_CHOICE(0, speckle_small_certainty + speckle_large_penalty,
-                      speckle_small_certainty, -1, -1, NULL, 0, 0, false);
+      new BLOB_CHOICE(0, small_certainty + large_penalty,
+                      small_certainty, -1, -1, NULL, 0, 0, false);
     temp_it.add_to_end(blob_choice);
     return;
   }
@@ -80,7 +66,7 @@ void AddLargeSpeckleTo(BLOB_CHOICE_LIST *Choices) {
   temp_it.move_to_last();
   blob_choice = temp_it.data();  // pick the worst choice
   temp_it.add_to_end(
-      new BLOB_CHOICE(0, blob_choice->rating() + speckle_large_penalty,
+      new BLOB_CHOICE(0, blob_choice->rating() + large_penalty,
                       blob_choice->certainty(), -1, -1, NULL, 0, 0, false));
 }                                /* AddLargeSpeckleTo */
 
@@ -90,18 +76,16 @@ void AddLargeSpeckleTo(BLOB_CHOICE_LIST *Choices) {
  * This routine returns TRUE if both the width of height
  * of Blob are less than the MaxLargeSpeckleSize.
  *
- * Globals:
- * - #speckle_large_max_size largest allowed speckle
- *
  * Exceptions: none
  * History: Mon Mar 11 10:06:49 1991, DSJ, Created.
  *
  * @param blob blob to test against speckle criteria
+ * @param large_max_size largest allowed speckle
  *
  * @return TRUE if blob is speckle, FALSE otherwise.
  */
-BOOL8 LargeSpeckle(TBLOB *blob) {
-  double speckle_size = BASELINE_SCALE * speckle_large_max_size;
+BOOL8 LargeSpeckle(TBLOB *blob, double large_max_size) {
+  double speckle_size = BASELINE_SCALE * large_max_size;
   TBOX bbox = blob->bounding_box();
   return (bbox.width() < speckle_size && bbox.height() < speckle_size);
 }                                /* LargeSpeckle */
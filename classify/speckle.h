@@ -28,8 +28,9 @@
 /*-----------------------------------------------------------------------------
           Public Function Prototypes
 -----------------------------------------------------------------------------*/
-void AddLargeSpeckleTo(BLOB_CHOICE_LIST *Choices);
+void AddLargeSpeckleTo(BLOB_CHOICE_LIST *Choices, double small_certainty,
+                       double large_penalty);
 
-BOOL8 LargeSpeckle(TBLOB *Blob);
+BOOL8 LargeSpeckle(TBLOB *Blob, double large_max_size);
 
 #endif
@@ -43,8 +43,7 @@ const double TrainingSample::kScaleValues[kSampleScaleSize] = {
 };
 
 TrainingSample::~TrainingSample() {
-  delete [] features_;
-  delete [] micro_features_;
+  DeleteFeatures();
 }
 
 // WARNING! Serialize/DeSerialize do not save/restore the "cache" data
@@ -95,11 +94,10 @@ bool TrainingSample::DeSerialize(bool swap, FILE* fp) {
     ReverseN(&num_features_, sizeof(num_features_));
     ReverseN(&num_micro_features_, sizeof(num_micro_features_));
   }
-  delete [] features_;
+  DeleteFeatures();
   features_ = new INT_FEATURE_STRUCT[num_features_];
   if (fread(features_, sizeof(*features_), num_features_, fp) != num_features_)
     return false;
-  delete [] micro_features_;
   micro_features_ = new MicroFeature[num_micro_features_];
   if (fread(micro_features_, sizeof(*micro_features_), num_micro_features_,
             fp) != num_micro_features_)
@@ -111,6 +109,37 @@ bool TrainingSample::DeSerialize(bool swap, FILE* fp) {
   return true;
 }
 
+// Sets the features to refer to the given arrays, without copying them.
+void TrainingSample::SetUnownedFeatures(int num_features,
+                                        const INT_FEATURE_STRUCT* features,
+                                        int num_micro_features,
+                                        const MicroFeature* micro_features,
+                                        const float* cn_feature,
+                                        const inT32* geo_feature) {
+  DeleteFeatures();
+  owns_features_ = false;
+  num_features_ = num_features;
+  features_ = const_cast<INT_FEATURE_STRUCT*>(features);
+  num_micro_features_ = num_micro_features;
+  micro_features_ = const_cast<MicroFeature*>(micro_features);
+  memcpy(cn_feature_, cn_feature, sizeof(*cn_feature_) * kNumCNParams);
+  for (int g = 0; g < GeoCount; ++g)
+    geo_feature_[g] = geo_feature[g];
+  features_are_indexed_ = false;
+  features_are_mapped_ = false;
+}
+
+// Deletes the feature arrays if they are owned, and resets them to NULL.
+void TrainingSample::DeleteFeatures() {
+  if (owns_features_) {
+    delete [] features_;
+    delete [] micro_features_;
+  }
+  features_ = NULL;
+  micro_features_ = NULL;
+  owns_features_ = true;
+}
+
 // Saves the given features into a TrainingSample.
 TrainingSample* TrainingSample::CopyFromFeatures(
     const INT_FX_RESULT_STRUCT& fx_info, const INT_FEATURE_STRUCT* features,
@@ -180,7 +209,7 @@ void TrainingSample::ExtractCharDesc(int int_feature_type,
                                      int geo_type,
                                      CHAR_DESC_STRUCT* char_desc) {
   // Extract the INT features.
-  if (features_ != NULL) delete [] features_;
+  DeleteFeatures();
   FEATURE_SET_STRUCT* char_features = char_desc->FeatureSets[int_feature_type];
   if (char_features == NULL) {
     tprintf("Error: no features to train on of type %s\n",
@@ -201,7 +230,6 @@ void TrainingSample::ExtractCharDesc(int int_feature_type,
     }
   }
   // Extract the Micro features.
-  if (micro_features_ != NULL) delete [] micro_features_;
   char_features = char_desc->FeatureSets[micro_type];
   if (char_features == NULL) {
     tprintf("Error: no features to train on of type %s\n",
@@ -58,7 +58,7 @@ class TrainingSample : public ELIST_LINK {
       features_(NULL), micro_features_(NULL), weight_(1.0),
       max_dist_(0.0), sample_index_(0),
       features_are_indexed_(false), features_are_mapped_(false),
-      is_error_(false) {
+      is_error_(false), owns_features_(true) {
   }
   ~TrainingSample();
 
@@ -86,6 +86,14 @@ class TrainingSample : public ELIST_LINK {
   // If swap is true, assumes a big/little-endian swap is needed.
   bool DeSerialize(bool swap, FILE* fp);
 
+  // Sets the features to refer to the given arrays, without copying them.
+  // The arrays must outlive the sample, and are not deleted by it. Used to
+  // make samples directly from a memory-mapped SampleStore.
+  void SetUnownedFeatures(int num_features, const INT_FEATURE_STRUCT* features,
+                          int num_micro_features,
+                          const MicroFeature* micro_features,
+                          const float* cn_feature, const inT32* geo_feature);
+
   // Extracts the needed information from the CHAR_DESC_STRUCT.
   void ExtractCharDesc(int feature_type, int micro_type,
                        int cn_type, int geo_type,
@@ -189,6 +197,9 @@ class TrainingSample : public ELIST_LINK {
   }
 
  private:
+  // Deletes the feature arrays if they are owned, and resets them to NULL.
+  void DeleteFeatures();
+
   // Unichar id that this sample represents. There obviously must be a
   // reference UNICHARSET somewhere. Usually in TrainingSampleSet.
   UNICHAR_ID class_id_;
@@ -227,6 +238,9 @@ class TrainingSample : public ELIST_LINK {
   bool features_are_mapped_;
   // True if the last classification was an error by the current definition.
   bool is_error_;
+  // False if features_ and micro_features_ belong to someone else, such as
+  // a SampleStore, and must not be deleted.
+  bool owns_features_;
 
   // Randomizing factors.
   static const int kYShiftValues[kSampleYShiftSize];
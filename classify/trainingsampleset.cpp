@@ -294,6 +294,10 @@ float TrainingSampleSet::UnicharDistance(const UnicharAndFonts& uf1,
 // Returns the distance between the given pair of font/class pairs.
 // Finds in cache or computes and caches.
 // OrganizeByFontAndClass must have been already called.
+// May be called from multiple threads at once: the caches are only accessed
+// inside a critical section, while the expensive ComputeClusterDistance is
+// run outside of it. As the distance is a pure function of its arguments,
+// the result does not depend on which thread gets to compute it first.
 float TrainingSampleSet::ClusterDistance(int font_id1, int class_id1,
                                          int font_id2, int class_id2,
                                          const IntFeatureMap& feature_map) {
@@ -302,66 +306,90 @@ float TrainingSampleSet::ClusterDistance(int font_id1, int class_id1,
   int font_index2 = font_id_map_.SparseToCompact(font_id2);
   if (font_index1 < 0 || font_index2 < 0)
     return 0.0f;
-  FontClassInfo& fc_info = (*font_class_array_)(font_index1, class_id1);
-  if (font_id1 == font_id2) {
+  float result;
+  bool found;
+#ifdef _OPENMP
+#pragma omp critical(cluster_distance_cache)
+#endif  // _OPENMP
+  found = LookupClusterDistance(font_index1, class_id1, font_index2, class_id2,
+                                &result);
+  if (found)
+    return result;
+  // Distance has to be calculated.
+  result = ComputeClusterDistance(font_id1, class_id1, font_id2, class_id2,
+                                  feature_map);
+#ifdef _OPENMP
+#pragma omp critical(cluster_distance_cache)
+#endif  // _OPENMP
+  {
+    StoreClusterDistance(font_index1, class_id1, font_index2, class_id2,
+                         result);
+    // Copy to the symmetric cache entry.
+    StoreClusterDistance(font_index2, class_id2, font_index1, class_id1,
+                         result);
+  }
+  return result;
+}
+
+// Looks up the distance between the given pair of (compact) font index/class
+// pairs in the ClusterDistance caches. Returns false if not cached.
+bool TrainingSampleSet::LookupClusterDistance(int font_index1, int class_id1,
+                                              int font_index2, int class_id2,
+                                              float* distance) const {
+  const FontClassInfo& fc_info = (*font_class_array_)(font_index1, class_id1);
+  if (font_index1 == font_index2) {
     // Special case cache for speed.
+    if (fc_info.unichar_distance_cache.size() == 0 ||
+        fc_info.unichar_distance_cache[class_id2] < 0)
+      return false;
+    *distance = fc_info.unichar_distance_cache[class_id2];
+    return true;
+  } else if (class_id1 == class_id2) {
+    // Another special-case cache for equal class-id.
+    if (fc_info.font_distance_cache.size() == 0 ||
+        fc_info.font_distance_cache[font_index2] < 0)
+      return false;
+    *distance = fc_info.font_distance_cache[font_index2];
+    return true;
+  }
+  // Both font and class are different. Linear search for class_id2/font_id2
+  // in what is a hopefully short list of distances.
+  int font_id2 = font_id_map_.CompactToSparse(font_index2);
+  for (int i = 0; i < fc_info.distance_cache.size(); ++i) {
+    if (fc_info.distance_cache[i].unichar_id == class_id2 &&
+        fc_info.distance_cache[i].font_id == font_id2) {
+      *distance = fc_info.distance_cache[i].distance;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Records the distance between the given pair of (compact) font index/class
+// pairs in the ClusterDistance caches, unless it is there already.
+void TrainingSampleSet::StoreClusterDistance(int font_index1, int class_id1,
+                                             int font_index2, int class_id2,
+                                             float distance) {
+  float cached_distance;
+  if (LookupClusterDistance(font_index1, class_id1, font_index2, class_id2,
+                            &cached_distance))
+    return;
+  FontClassInfo& fc_info = (*font_class_array_)(font_index1, class_id1);
+  if (font_index1 == font_index2) {
     if (fc_info.unichar_distance_cache.size() == 0)
       fc_info.unichar_distance_cache.init_to_size(unicharset_size_, -1.0f);
-    if (fc_info.unichar_distance_cache[class_id2] < 0) {
-      // Distance has to be calculated.
-      float result = ComputeClusterDistance(font_id1, class_id1,
-                                            font_id2, class_id2,
-                                            feature_map);
-      fc_info.unichar_distance_cache[class_id2] = result;
-      // Copy to the symmetric cache entry.
-      FontClassInfo& fc_info2 = (*font_class_array_)(font_index2, class_id2);
-      if (fc_info2.unichar_distance_cache.size() == 0)
-        fc_info2.unichar_distance_cache.init_to_size(unicharset_size_, -1.0f);
-      fc_info2.unichar_distance_cache[class_id1] = result;
-    }
-    return fc_info.unichar_distance_cache[class_id2];
+    fc_info.unichar_distance_cache[class_id2] = distance;
   } else if (class_id1 == class_id2) {
-    // Another special-case cache for equal class-id.
     if (fc_info.font_distance_cache.size() == 0)
       fc_info.font_distance_cache.init_to_size(font_id_map_.CompactSize(),
                                                -1.0f);
-    if (fc_info.font_distance_cache[font_index2] < 0) {
-      // Distance has to be calculated.
-      float result = ComputeClusterDistance(font_id1, class_id1,
-                                            font_id2, class_id2,
-                                            feature_map);
-      fc_info.font_distance_cache[font_index2] = result;
-      // Copy to the symmetric cache entry.
-      FontClassInfo& fc_info2 = (*font_class_array_)(font_index2, class_id2);
-      if (fc_info2.font_distance_cache.size() == 0)
-        fc_info2.font_distance_cache.init_to_size(font_id_map_.CompactSize(),
-                                                  -1.0f);
-      fc_info2.font_distance_cache[font_index1] = result;
-    }
-    return fc_info.font_distance_cache[font_index2];
-  }
-  // Both font and class are different. Linear search for class_id2/font_id2
-  // in what is a hopefully short list of distances.
-  int cache_index = 0;
-  while (cache_index < fc_info.distance_cache.size() &&
-         (fc_info.distance_cache[cache_index].unichar_id != class_id2 ||
-          fc_info.distance_cache[cache_index].font_id != font_id2))
-    ++cache_index;
-  if (cache_index == fc_info.distance_cache.size()) {
-    // Distance has to be calculated.
-    float result = ComputeClusterDistance(font_id1, class_id1,
-                                          font_id2, class_id2,
-                                          feature_map);
-    FontClassDistance fc_dist = { class_id2, font_id2, result };
+    fc_info.font_distance_cache[font_index2] = distance;
+  } else {
+    FontClassDistance fc_dist = {
+      class_id2, font_id_map_.CompactToSparse(font_index2), distance
+    };
     fc_info.distance_cache.push_back(fc_dist);
-    // Copy to the symmetric cache entry. We know it isn't there already, as
-    // we always copy to the symmetric entry.
-    FontClassInfo& fc_info2 = (*font_class_array_)(font_index2, class_id2);
-    fc_dist.unichar_id = class_id1;
-    fc_dist.font_id = font_id1;
-    fc_info2.distance_cache.push_back(fc_dist);
   }
-  return fc_info.distance_cache[cache_index].distance;
 }
 
 // Computes the distance between the given pair of font/class pairs.
@@ -658,27 +686,45 @@ void TrainingSampleSet::SetupFontIdMap() {
 // Finds the sample for each font, class pair that has least maximum
 // distance to all the other samples of the same font, class.
 // OrganizeByFontAndClass must have been already called.
+// The font, class pairs are independent, so they are shared out between
+// threads, each with its own IntFeatureDist. The per-pair results are
+// reported afterwards in the original order to keep the output stable.
 void TrainingSampleSet::ComputeCanonicalSamples(const IntFeatureMap& map,
                                                 bool debug) {
   ASSERT_HOST(font_class_array_ != NULL);
-  IntFeatureDist f_table;
   if (debug) tprintf("feature table size %d\n", map.sparse_size());
-  f_table.Init(&map);
-  int worst_s1 = 0;
-  int worst_s2 = 0;
-  double global_worst_dist = 0.0;
-  // Compute distances independently for each font and char index.
   int font_size = font_id_map_.CompactSize();
-  for (int font_index = 0; font_index < font_size; ++font_index) {
-    int font_id = font_id_map_.CompactToSparse(font_index);
-    for (int c = 0; c < unicharset_size_; ++c) {
-      int samples_found = 0;
+  int num_pairs = font_size * unicharset_size_;
+  // Range of max distances and the farthest apart pair for each font, class.
+  GenericVector<double> min_max_dists;
+  min_max_dists.init_to_size(num_pairs, 2.0);
+  GenericVector<double> max_max_dists;
+  max_max_dists.init_to_size(num_pairs, 0.0);
+  GenericVector<int> max_s1s;
+  max_s1s.init_to_size(num_pairs, 0);
+  GenericVector<int> max_s2s;
+  max_s2s.init_to_size(num_pairs, 0);
+  GenericVector<int> samples_founds;
+  samples_founds.init_to_size(num_pairs, 0);
+  // Compute distances independently for each font and char index.
+#ifdef _OPENMP
+#pragma omp parallel
+#endif  // _OPENMP
+  {
+    IntFeatureDist f_table;
+    f_table.Init(&map);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif  // _OPENMP
+    for (int pair = 0; pair < num_pairs; ++pair) {
+      int font_index = pair / unicharset_size_;
+      int c = pair % unicharset_size_;
+      int font_id = font_id_map_.CompactToSparse(font_index);
       FontClassInfo& fcinfo = (*font_class_array_)(font_index, c);
       if (fcinfo.samples.size() == 0 ||
           (kTestChar >= 0 && c != kTestChar)) {
         fcinfo.canonical_sample = -1;
         fcinfo.canonical_dist = 0.0f;
-        if (debug) tprintf("Skipping class %d\n", c);
         continue;
       }
       // The canonical sample will be the one with the min_max_dist, which
@@ -689,6 +735,7 @@ void TrainingSampleSet::ComputeCanonicalSamples(const IntFeatureMap& map,
       double max_max_dist = 0.0;
       int max_s1 = 0;
       int max_s2 = 0;
+      int samples_found = 0;
       fcinfo.canonical_sample = fcinfo.samples[0];
       fcinfo.canonical_dist = 0.0f;
       for (int i = 0; i < fcinfo.samples.size(); ++i) {
@@ -735,20 +782,36 @@ void TrainingSampleSet::ComputeCanonicalSamples(const IntFeatureMap& map,
         }
         UpdateRange(max_dist, &min_max_dist, &max_max_dist);
       }
-      if (max_max_dist > global_worst_dist) {
-        // Keep a record of the worst pair over all characters/fonts too.
-        global_worst_dist = max_max_dist;
-        worst_s1 = max_s1;
-        worst_s2 = max_s2;
-      }
-      if (debug) {
-        tprintf("Found %d samples of class %d=%s, font %d, "
-                "dist range [%g, %g], worst pair= %s, %s\n",
-                samples_found, c, unicharset_.debug_str(c).string(),
-                font_index, min_max_dist, max_max_dist,
-                SampleToString(*samples_[max_s1]).string(),
-                SampleToString(*samples_[max_s2]).string());
-      }
+      min_max_dists[pair] = min_max_dist;
+      max_max_dists[pair] = max_max_dist;
+      max_s1s[pair] = max_s1;
+      max_s2s[pair] = max_s2;
+      samples_founds[pair] = samples_found;
+    }
+  }
+  int worst_s1 = 0;
+  int worst_s2 = 0;
+  double global_worst_dist = 0.0;
+  for (int pair = 0; pair < num_pairs; ++pair) {
+    int font_index = pair / unicharset_size_;
+    int c = pair % unicharset_size_;
+    if (samples_founds[pair] == 0) {
+      if (debug) tprintf("Skipping class %d\n", c);
+      continue;
+    }
+    if (max_max_dists[pair] > global_worst_dist) {
+      // Keep a record of the worst pair over all characters/fonts too.
+      global_worst_dist = max_max_dists[pair];
+      worst_s1 = max_s1s[pair];
+      worst_s2 = max_s2s[pair];
+    }
+    if (debug) {
+      tprintf("Found %d samples of class %d=%s, font %d, "
+              "dist range [%g, %g], worst pair= %s, %s\n",
+              samples_founds[pair], c, unicharset_.debug_str(c).string(),
+              font_index, min_max_dists[pair], max_max_dists[pair],
+              SampleToString(*samples_[max_s1s[pair]]).string(),
+              SampleToString(*samples_[max_s2s[pair]]).string());
     }
   }
   if (debug) {
@@ -815,23 +878,28 @@ void TrainingSampleSet::ComputeCanonicalFeatures() {
 
 // Computes the combined set of features used by all the samples of each
 // font/class combination. Use after ReplicateAndRandomizeSamples.
+// The font/class pairs are independent, so they are computed in parallel.
 void TrainingSampleSet::ComputeCloudFeatures(int feature_space_size) {
   ASSERT_HOST(font_class_array_ != NULL);
   int font_size = font_id_map_.CompactSize();
-  for (int font_index = 0; font_index < font_size; ++font_index) {
+  int num_pairs = font_size * unicharset_size_;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif  // _OPENMP
+  for (int pair = 0; pair < num_pairs; ++pair) {
+    int font_index = pair / unicharset_size_;
+    int c = pair % unicharset_size_;
     int font_id = font_id_map_.CompactToSparse(font_index);
-    for (int c = 0; c < unicharset_size_; ++c) {
-      int num_samples = NumClassSamples(font_id, c, false);
-      if (num_samples == 0)
-        continue;
-      FontClassInfo& fcinfo = (*font_class_array_)(font_index, c);
-      fcinfo.cloud_features.Init(feature_space_size);
-      for (int s = 0; s < num_samples; ++s) {
-        const TrainingSample* sample = GetSample(font_id, c, s);
-        const GenericVector<int>& sample_features = sample->indexed_features();
-        for (int i = 0; i < sample_features.size(); ++i)
-          fcinfo.cloud_features.SetBit(sample_features[i]);
-      }
+    int num_samples = NumClassSamples(font_id, c, false);
+    if (num_samples == 0)
+      continue;
+    FontClassInfo& fcinfo = (*font_class_array_)(font_index, c);
+    fcinfo.cloud_features.Init(feature_space_size);
+    for (int s = 0; s < num_samples; ++s) {
+      const TrainingSample* sample = GetSample(font_id, c, s);
+      const GenericVector<int>& sample_features = sample->indexed_features();
+      for (int i = 0; i < sample_features.size(); ++i)
+        fcinfo.cloud_features.SetBit(sample_features[i]);
     }
   }
 }
@@ -122,6 +122,16 @@ class TrainingSampleSet {
                         int font_id2, int class_id2,
                         const IntFeatureMap& feature_map);
 
+  // Looks up the distance between the given pair of (compact) font
+  // index/class pairs in the ClusterDistance caches.
+  // Returns false if the distance has not been cached yet.
+  bool LookupClusterDistance(int font_index1, int class_id1,
+                             int font_index2, int class_id2,
+                             float* distance) const;
+  // Records the given distance in the ClusterDistance caches.
+  void StoreClusterDistance(int font_index1, int class_id1,
+                            int font_index2, int class_id2, float distance);
+
   // Computes the distance between the given pair of font/class pairs.
   float ComputeClusterDistance(int font_id1, int class_id1,
                                int font_id2, int class_id2,
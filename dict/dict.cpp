@@ -315,9 +315,15 @@ void Dict::Load() {
                          &dawgs_, &max_fixed_length_dawgs_wdlen_);
   }
 
-  // Construct a list of corresponding successors for each dawg. Each entry i
-  // in the successors_ vector is a vector of integers that represent the
-  // indices into the dawgs_ vector of the successors for dawg i.
+  ComputeSuccessors();
+}
+
+// Construct a list of corresponding successors for each dawg. Each entry i
+// in the successors_ vector is a vector of integers that represent the
+// indices into the dawgs_ vector of the successors for dawg i.
+void Dict::ComputeSuccessors() {
+  successors_.delete_data_pointers();
+  successors_.clear();
   successors_.reserve(dawgs_.length());
   for (int i = 0; i < dawgs_.length(); ++i) {
     const Dawg *dawg = dawgs_[i];
@@ -335,6 +341,10 @@ void Dict::Load() {
 void Dict::End() {
   if (dawgs_.length() == 0)
     return;  // Not safe to call twice.
+  // The overlays are owned by the caller, so take them out of dawgs_
+  // before the rest is deleted.
+  dawgs_.truncate(dawgs_.length() - user_dawgs_.length());
+  user_dawgs_.clear();
   dawgs_.delete_data_pointers();
   successors_.delete_data_pointers();
   dawgs_.clear();
@@ -348,6 +358,72 @@ void Dict::End() {
   }
 }
 
+bool Dict::AttachUserDawg(Dawg *dawg) {
+  if (dawg == NULL) return false;
+  for (int i = 0; i < dawgs_.length(); ++i) {
+    if (dawgs_[i] == dawg) return false;
+  }
+  dawgs_ += dawg;
+  user_dawgs_ += dawg;
+  UserDawgsChanged();
+  return true;
+}
+
+bool Dict::DetachUserDawg(Dawg *dawg) {
+  for (int i = 0; i < user_dawgs_.length(); ++i) {
+    if (user_dawgs_[i] != dawg) continue;
+    user_dawgs_.remove(i);
+    // The overlays occupy the tail of dawgs_ in the order of attachment.
+    dawgs_.remove(dawgs_.length() - user_dawgs_.length() - 1 + i);
+    UserDawgsChanged();
+    return true;
+  }
+  return false;
+}
+
+void Dict::DetachAllUserDawgs() {
+  if (user_dawgs_.empty()) return;
+  dawgs_.truncate(dawgs_.length() - user_dawgs_.length());
+  user_dawgs_.clear();
+  UserDawgsChanged();
+}
+
+// Dawg indices saved in the hyphen state refer to the old layout of dawgs_,
+// so the state is dropped along with the stale successor lists.
+void Dict::UserDawgsChanged() {
+  if (hyphen_word_ != NULL) {
+    delete hyphen_word_;
+    hyphen_word_ = NULL;
+  }
+  hyphen_active_dawgs_.clear();
+  hyphen_constraints_.clear();
+  ComputeSuccessors();
+}
+
+SquishedDawg *Dict::BuildUserDawg(const char *filename,
+                                  const UNICHARSET &unicharset,
+                                  const STRING &lang, int debug_level) {
+  // The number of edges of the trie is bounded by the number of unichars
+  // in the list, which in turn is bounded by the size of the file.
+  FILE *fp = fopen(filename, "rb");
+  if (fp == NULL) {
+    tprintf("Error: failed to open %s\n", filename);
+    return NULL;
+  }
+  fseek(fp, 0, SEEK_END);
+  long file_size = ftell(fp);
+  fclose(fp);
+  Trie trie(DAWG_TYPE_WORD, lang, USER_DAWG_PERM,
+            MAX(file_size, kMaxUserDawgEdges), unicharset.size(),
+            debug_level);
+  if (!trie.read_word_list(filename, unicharset,
+                           Trie::RRP_REVERSE_IF_HAS_RTL)) {
+    tprintf("Error: failed to load %s\n", filename);
+    return NULL;
+  }
+  return trie.trie_to_dawg();
+}
+
 // Create unicharset adaptations of known, short lists of UTF-8 equivalent
 // characters (think all hyphen-like symbols).  The first version of the
 // list is taken as equivalent for matching against the dictionary.
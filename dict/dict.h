@@ -474,6 +474,31 @@ class Dict {
   void Load();
   void End();
 
+  // Attaches the given dawg as a user dictionary overlay. The overlay is
+  // searched by letter_is_okay_ (and hence by the language model and
+  // valid_word) alongside the dawgs loaded by Load() until it is detached.
+  // Dict does not take ownership: the dawg must outlive the attachment and
+  // must not be modified while attached. Since lookups only use the const
+  // interface of Dawg, a single SquishedDawg may be attached to several
+  // Dicts (e.g. in different threads) at the same time.
+  // Returns false if the dawg is NULL or already attached.
+  bool AttachUserDawg(Dawg *dawg);
+  // Detaches an overlay previously attached by AttachUserDawg().
+  // Returns false if the dawg was not attached.
+  bool DetachUserDawg(Dawg *dawg);
+  // Detaches all the user dictionary overlays.
+  void DetachAllUserDawgs();
+  // Returns the number of currently attached user dictionary overlays.
+  int NumUserDawgs() const { return user_dawgs_.size(); }
+  // Builds a compact dawg from the given word list file (one word per line,
+  // UTF-8) for use as an overlay with AttachUserDawg(). The result does not
+  // depend on the state of any Dict, so it can be cached and shared between
+  // all the Dicts that use the given unicharset. Returns NULL on failure.
+  // The caller is responsible for deleting the returned dawg.
+  static SquishedDawg *BuildUserDawg(const char *filename,
+                                     const UNICHARSET &unicharset,
+                                     const STRING &lang, int debug_level);
+
   // Resets the document dictionary analogous to ResetAdaptiveClassifier.
   void ResetDocumentDictionary() {
     if (pending_words_ != NULL)
@@ -730,6 +755,12 @@ class Dict {
   const LIST &getBestChoices() { return best_choices_; }
 
  private:
+  // Fills successors_ with the indices of the successor dawgs of each entry
+  // in dawgs_.
+  void ComputeSuccessors();
+  // Updates the derived state after the set of user dawgs has changed.
+  void UserDawgsChanged();
+
   /** Private member variables. */
   Image* image_ptr_;
   /**
@@ -783,6 +814,9 @@ class Dict {
   Dawg *unambig_dawg_;
   Dawg *punc_dawg_;
   Trie *document_words_;
+  /// User dictionary overlays attached with AttachUserDawg(). They are
+  /// appended at the end of dawgs_, but are not owned by Dict.
+  DawgVector user_dawgs_;
   /// Maximum word length of fixed-length word dawgs.
   /// A value < 1 indicates that no fixed-length dawgs are loaded.
   int max_fixed_length_dawgs_wdlen_;
@@ -594,40 +594,22 @@ bool Dict::NoDangerousAmbig(WERD_CHOICE *best_choice,
   int i;
   bool modified_best_choice = false;
   bool ambigs_found = false;
-  // For each position in best_choice:
+  // First, if fix_replaceable, look through the ambigs to be replaced and
+  // replace all the ambiguities found. For each position in best_choice:
   // -- choose AMBIG_SPEC_LIST that corresponds to unichar_id at best_choice[i]
   // -- initialize wrong_ngram with a single unichar_id at best_choice[i]
   // -- look for ambiguities corresponding to wrong_ngram in the list while
   //    adding the following unichar_ids from best_choice to wrong_ngram
+  // As replacements change best_choice while it is being searched, this is
+  // only done if the replace_matcher finds that there is something to
+  // replace, which is rare.
   //
-  // Repeat the above procedure twice: first time look through
-  // ambigs to be replaced and replace all the ambiguities found;
-  // second time look through dangerous ambiguities and construct
-  // ambig_blob_choices with fake a blob choice for each ambiguity
-  // and pass them to dawg_permute_and_select() to search for
-  // ambiguous words in the dictionaries.
-  //
-  // Note that during the execution of the for loop (on the first pass)
+  // Note that during the execution of the for loop
   // if replacements are made the length of best_choice might change.
-  for (int pass = 0; pass < (fix_replaceable ? 2 : 1); ++pass) {
-    bool replace = (fix_replaceable && pass == 0);
-    const UnicharAmbigsVector &table = replace ?
-      getUnicharAmbigs().replace_ambigs() : getUnicharAmbigs().dang_ambigs();
-    if (!replace) {
-      // Initialize ambig_blob_choices with lists containing a single
-      // unichar id for the correspoding position in best_choice.
-      // best_choice consisting from only the original letters will
-      // have a rating of 0.0.
-      for (i = 0; i < best_choice->length(); ++i) {
-        BLOB_CHOICE_LIST *lst = new BLOB_CHOICE_LIST();
-        BLOB_CHOICE_IT lst_it(lst);
-        // TODO(rays/antonova) Should these BLOB_CHOICEs use real xheights
-        // or are these fake ones good enough?
-        lst_it.add_to_end(new BLOB_CHOICE(best_choice->unichar_id(i),
-                                          0.0, 0.0, -1, -1, -1, 0, 1, false));
-        ambig_blob_choices.push_back(lst);
-      }
-    }
+  if (fix_replaceable &&
+      getUnicharAmbigs().replace_matcher().AnyMatch(best_choice->unichar_ids(),
+                                                    best_choice->length())) {
+    const UnicharAmbigsVector &table = getUnicharAmbigs().replace_ambigs();
     UNICHAR_ID wrong_ngram[MAX_AMBIG_SIZE + 1];
     int wrong_ngram_index;
     int next_index;
@@ -636,8 +618,7 @@ bool Dict::NoDangerousAmbig(WERD_CHOICE *best_choice,
       if (i > 0) blob_index += best_choice->fragment_length(i-1);
       UNICHAR_ID curr_unichar_id = best_choice->unichar_id(i);
       if (stopper_debug_level > 2) {
-        tprintf("Looking for %s ngrams starting with %s:\n",
-                replace ? "replaceable" : "ambiguous",
+        tprintf("Looking for replaceable ngrams starting with %s:\n",
                 getUnicharset().debug_str(curr_unichar_id).string());
       }
       wrong_ngram_index = 0;
@@ -664,7 +645,7 @@ bool Dict::NoDangerousAmbig(WERD_CHOICE *best_choice,
           // Record the place where we found an ambiguity.
           if (fixpt != NULL) {
             fixpt->push_back(DANGERR_INFO(
-                blob_index, blob_index+wrong_ngram_index, replace,
+                blob_index, blob_index+wrong_ngram_index, true,
                 getUnicharset().get_isngram(ambig_spec->correct_ngram_id)));
             if (stopper_debug_level > 1) {
               tprintf("fixpt+=(%d %d %d %d)\n", blob_index,
@@ -673,40 +654,15 @@ bool Dict::NoDangerousAmbig(WERD_CHOICE *best_choice,
                           ambig_spec->correct_ngram_id));
             }
           }
-
-          if (replace) {
-            if (stopper_debug_level > 2) {
-              tprintf("replace ambiguity with: ");
-              UnicharIdArrayUtils::print(
-                  ambig_spec->correct_fragments, getUnicharset());
-            }
-            ReplaceAmbig(i, ambig_spec->wrong_ngram_size,
-                         ambig_spec->correct_ngram_id,
-                         best_choice, blob_choices, modified_blobs);
-            modified_best_choice = true;
-          } else if (i > 0 || ambig_spec->type != CASE_AMBIG) {
-            // We found dang ambig - update ambig_blob_choices.
-            if (stopper_debug_level > 2) {
-              tprintf("found ambiguity: ");
-              UnicharIdArrayUtils::print(
-                  ambig_spec->correct_fragments, getUnicharset());
-            }
-            ambigs_found = true;
-            for (int tmp_index = 0; tmp_index <= wrong_ngram_index;
-                 ++tmp_index) {
-              // Add a blob choice for the corresponding fragment of the
-              // ambiguity. These fake blob choices are initialized with
-              // negative ratings (which are not possible for real blob
-              // choices), so that dawg_permute_and_select() considers any
-              // word not consisting of only the original letters a better
-              // choice and stops searching for alternatives once such a
-              // choice is found.
-              BLOB_CHOICE_IT bc_it(ambig_blob_choices[i+tmp_index]);
-              bc_it.add_to_end(new BLOB_CHOICE(
-                  ambig_spec->correct_fragments[tmp_index], -1.0, 0.0,
-                  -1, -1, -1, 0, 1, false));
-            }
+          if (stopper_debug_level > 2) {
+            tprintf("replace ambiguity with: ");
+            UnicharIdArrayUtils::print(
+                ambig_spec->correct_fragments, getUnicharset());
           }
+          ReplaceAmbig(i, ambig_spec->wrong_ngram_size,
+                       ambig_spec->correct_ngram_id,
+                       best_choice, blob_choices, modified_blobs);
+          modified_best_choice = true;
           spec_it.forward();
         } else if (compare == -1) {
           if (wrong_ngram_index+1 < ambig_spec->wrong_ngram_size &&
@@ -723,7 +679,74 @@ bool Dict::NoDangerousAmbig(WERD_CHOICE *best_choice,
         }
       }  // end searching AmbigSpec_LIST
     }  // end searching best_choice
-  }  // end searching replace and dangerous ambigs
+  }
+
+  // Then look through dangerous ambiguities and construct
+  // ambig_blob_choices with fake a blob choice for each ambiguity
+  // and pass them to dawg_permute_and_select() to search for
+  // ambiguous words in the dictionaries. The dang_matcher finds all the
+  // ambiguities in one pass, in the same order as a walk of the
+  // AMBIG_SPEC_LISTs at each position would.
+  //
+  // Initialize ambig_blob_choices with lists containing a single
+  // unichar id for the correspoding position in best_choice.
+  // best_choice consisting from only the original letters will
+  // have a rating of 0.0.
+  GenericVector<int> blob_indices;
+  int blob_index = 0;
+  for (i = 0; i < best_choice->length(); ++i) {
+    if (i > 0) blob_index += best_choice->fragment_length(i-1);
+    blob_indices.push_back(blob_index);
+    BLOB_CHOICE_LIST *lst = new BLOB_CHOICE_LIST();
+    BLOB_CHOICE_IT lst_it(lst);
+    // TODO(rays/antonova) Should these BLOB_CHOICEs use real xheights
+    // or are these fake ones good enough?
+    lst_it.add_to_end(new BLOB_CHOICE(best_choice->unichar_id(i),
+                                      0.0, 0.0, -1, -1, -1, 0, 1, false));
+    ambig_blob_choices.push_back(lst);
+  }
+  GenericVector<AmbigMatch> matches;
+  getUnicharAmbigs().dang_matcher().FindMatches(best_choice->unichar_ids(),
+                                                best_choice->length(),
+                                                &matches);
+  for (int m = 0; m < matches.size(); ++m) {
+    i = matches[m].start;
+    const AmbigSpec *ambig_spec = matches[m].spec;
+    int wrong_ngram_index = ambig_spec->wrong_ngram_size - 1;
+    // Record the place where we found an ambiguity.
+    if (fixpt != NULL) {
+      fixpt->push_back(DANGERR_INFO(
+          blob_indices[i], blob_indices[i]+wrong_ngram_index, false,
+          getUnicharset().get_isngram(ambig_spec->correct_ngram_id)));
+      if (stopper_debug_level > 1) {
+        tprintf("fixpt+=(%d %d %d %d)\n", blob_indices[i],
+                blob_indices[i]+wrong_ngram_index, false,
+                getUnicharset().get_isngram(ambig_spec->correct_ngram_id));
+      }
+    }
+    if (i > 0 || ambig_spec->type != CASE_AMBIG) {
+      // We found dang ambig - update ambig_blob_choices.
+      if (stopper_debug_level > 2) {
+        tprintf("found ambiguity: ");
+        UnicharIdArrayUtils::print(
+            ambig_spec->correct_fragments, getUnicharset());
+      }
+      ambigs_found = true;
+      for (int tmp_index = 0; tmp_index <= wrong_ngram_index; ++tmp_index) {
+        // Add a blob choice for the corresponding fragment of the
+        // ambiguity. These fake blob choices are initialized with
+        // negative ratings (which are not possible for real blob
+        // choices), so that dawg_permute_and_select() considers any
+        // word not consisting of only the original letters a better
+        // choice and stops searching for alternatives once such a
+        // choice is found.
+        BLOB_CHOICE_IT bc_it(ambig_blob_choices[i+tmp_index]);
+        bc_it.add_to_end(new BLOB_CHOICE(
+            ambig_spec->correct_fragments[tmp_index], -1.0, 0.0,
+            -1, -1, -1, 0, 1, false));
+      }
+    }
+  }
 
   // If any ambiguities were found permute the constructed ambig_blob_choices
   // to see if an alternative dictionary word can be found.
@@ -15,9 +15,9 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
-if [ $# -ne 1 ]
+if [ $# -ne 1 -a $# -ne 2 ]
 then
-  echo "Usage:$0 pagesfile"
+  echo "Usage:$0 pagesfile [-zoning]"
   exit 1
 fi
 if [ ! -d api ]
@@ -34,7 +34,12 @@ pages=$1
 
 imdir=${pages%/pages}
 setname=${imdir##*/}
-resdir=testing/results/$setname
+if [ "$2" = "-zoning" ]
+then
+  resdir=testing/results/zoning.$setname
+else
+  resdir=testing/results/$setname
+fi
 mkdir -p testing/reports
 echo "Counting on set $setname in directory $imdir to $resdir"
 accfiles=""
@@ -15,9 +15,9 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
-if [ $# -ne 2 ]
+if [ $# -lt 2 ]
 then
-   echo "Usage:$0 unlv-data-dir version-id"
+   echo "Usage:$0 unlv-data-dir version-id [-zoning] [configfile...]"
    exit 1
 fi
 if [ ! -d api ]
@@ -58,6 +58,7 @@ END {
 
 imdir="$1"
 vid="$2"
+shift 2
 bindir=${0%/*}
 if [ "$bindir" = "$0" ]
 then
@@ -77,9 +78,14 @@ do
     if [ -r $imdir/$set/pages ]
     then
 	# Run tesseract on all the pages.
-	$bindir/runtestset.sh $imdir/$set/pages
+	$bindir/runtestset.sh $imdir/$set/pages "$@"
 	# Count the errors on all the pages.
-	$bindir/counttestset.sh $imdir/$set/pages
+	if [ "$1" = "-zoning" ]
+	then
+	    $bindir/counttestset.sh $imdir/$set/pages -zoning
+	else
+	    $bindir/counttestset.sh $imdir/$set/pages
+	fi
 	# Get the old character word and nonstop word errors.
 	olderrs=`cat testing/reports/1995.$set.sum | cut -f3`
 	oldwerrs=`cat testing/reports/1995.$set.sum | cut -f6`
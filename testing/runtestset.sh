@@ -15,9 +15,9 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
-if [ $# -ne 1 -a $# -ne 2 ]
+if [ $# -lt 1 ]
 then
-  echo "Usage:$0 pagesfile [-zoning]"
+  echo "Usage:$0 pagesfile [-zoning] [configfile...]"
   exit 1
 fi
 if [ ! -d api ]
@@ -40,16 +40,21 @@ else
 fi
 
 pages=$1
+shift
 imdir=${pages%/pages}
 setname=${imdir##*/}
-if [ $# -eq 2 -a "$2" = "-zoning" ]
+if [ "$1" = "-zoning" ]
 then
-  config=unlv.auto
+  # Zoning runs the full layout analysis instead of a single block.
+  shift
+  psm=3
   resdir=testing/results/zoning.$setname
 else
-  config=unlv
+  psm=6
   resdir=testing/results/$setname
 fi
+# Any remaining arguments are extra config files, eg layoutreduced.
+config="unlv $*"
 echo -e "Testing on set $setname in directory $imdir to $resdir\n"
 mkdir -p $resdir
 rm -f testing/reports/$setname.times
@@ -64,7 +69,7 @@ do
      srcdir="$imdir"
   fi
 #  echo "$srcdir/$page.tif"
-  $tess $srcdir/$page.tif $resdir/$page -psm 6 $config 2>&1 |grep -v "OCR Engine"
+  $tess $srcdir/$page.tif $resdir/$page -psm $psm $config 2>&1 |grep -v "OCR Engine"
   if [ -r times.txt ]
   then
     read t <times.txt
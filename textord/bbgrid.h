@@ -23,6 +23,7 @@
 
 #include "clst.h"
 #include "coutln.h"
+#include "genericvector.h"
 #include "rect.h"
 #include "scrollview.h"
 
@@ -146,12 +147,15 @@ class IntGrid : public GridBase {
   int* grid_;  // 2-d array of ints.
 };
 
-// The BBGrid class holds C_LISTs of template classes BBC (bounding box class)
-// in a grid for fast neighbour access.
+// The BBGrid class holds arrays of pointers to template classes BBC
+// (bounding box class) in a grid for fast neighbour access.
 // The BBC class must have a member const TBOX& bounding_box() const.
 // The BBC class must have been CLISTIZEH'ed elsewhere to make the
-// list class BBC_CLIST and the iterator BBC_C_IT.
-// Use of C_LISTs enables BBCs to exist in multiple cells simultaneously.
+// list class BBC_CLIST and the iterator BBC_C_IT, which name the grid type.
+// The cells used to be BBC_CLISTs, but the searches that run over them are
+// the inner loops of layout analysis, so they are now contiguous arrays,
+// sorted by left edge, to save chasing a list link for every element.
+// Use of pointers enables BBCs to exist in multiple cells simultaneously.
 // As a consequence, ownership of BBCs is assumed to be elsewhere and
 // persistent for at least the life of the BBGrid, or at least until Clear is
 // called which removes all references to inserted objects without actually
@@ -223,7 +227,8 @@ template<class BBC, class BBC_CLIST, class BBC_C_IT> class BBGrid
   virtual void HandleClick(int x, int y);
 
  protected:
-  BBC_CLIST* grid_;  // 2-d array of CLISTS of BBC elements.
+  // 2-d array of cells, each sorted with SortByBoxLeft.
+  GenericVector<BBC*>* grid_;
 
  private:
 };
@@ -233,7 +238,8 @@ template<class BBC, class BBC_CLIST, class BBC_C_IT> class GridSearch {
  public:
   GridSearch(BBGrid<BBC, BBC_CLIST, BBC_C_IT>* grid)
       : grid_(grid), unique_mode_(false),
-        previous_return_(NULL), next_return_(NULL) {
+        previous_return_(NULL), next_return_(NULL), cell_(NULL),
+        cell_index_(0) {
   }
 
   // Get the grid x, y coords of the most recently returned BBC.
@@ -340,6 +346,10 @@ template<class BBC, class BBC_CLIST, class BBC_C_IT> class GridSearch {
   // Factored out function to set the iterator to the current x_, y_
   // grid coords and mark the cycle pt.
   void SetIterator();
+  // Returns true if all of the current cell has been returned.
+  bool CellExhausted() const {
+    return cell_index_ >= cell_->size();
+  }
 
  private:
   // The grid we are searching.
@@ -357,11 +367,13 @@ template<class BBC, class BBC_CLIST, class BBC_C_IT> class GridSearch {
   int y_;
   bool unique_mode_;
   BBC* previous_return_;  // Previous return from Next*.
-  BBC* next_return_;  // Current value of it_.data() used for repositioning.
-  // An iterator over the list at (x_, y_) in the grid_.
-  BBC_C_IT it_;
-  // List of unique returned elements used when unique_mode_ is true.
-  BBC_CLIST returns_;
+  BBC* next_return_;  // Element at cell_index_ used for repositioning.
+  // The cell at (x_, y_) in the grid_, and the index in it of the next
+  // element to return.
+  GenericVector<BBC*>* cell_;
+  int cell_index_;
+  // Sorted unique returned elements used when unique_mode_ is true.
+  GenericVector<BBC*> returns_;
 };
 
 // Sort function to sort a BBC by bounding_box().left().
@@ -447,14 +459,14 @@ void BBGrid<BBC, BBC_CLIST, BBC_C_IT>::Init(int gridsize,
   GridBase::Init(gridsize, bleft, tright);
   if (grid_ != NULL)
     delete [] grid_;
-  grid_ = new BBC_CLIST[gridbuckets_];
+  grid_ = new GenericVector<BBC*>[gridbuckets_];
 }
 
 // Clear all lists, but leave the array of lists present.
 template<class BBC, class BBC_CLIST, class BBC_C_IT>
 void BBGrid<BBC, BBC_CLIST, BBC_C_IT>::Clear() {
   for (int i = 0; i < gridbuckets_; ++i) {
-    grid_[i].shallow_clear();
+    grid_[i].truncate(0);
   }
 }
 
@@ -467,13 +479,12 @@ void BBGrid<BBC, BBC_CLIST, BBC_C_IT>::ClearGridData(
   GridSearch<BBC, BBC_CLIST, BBC_C_IT> search(this);
   search.StartFullSearch();
   BBC* bb;
-  BBC_CLIST bb_list;
-  BBC_C_IT it(&bb_list);
+  GenericVector<BBC*> bb_list;
   while ((bb = search.NextFullSearch()) != NULL) {
-    it.add_after_then_move(bb);
+    bb_list.push_back(bb);
   }
-  for (it.mark_cycle_pt(); !it.cycled_list(); it.forward()) {
-    free_method(it.data());
+  for (int i = 0; i < bb_list.size(); ++i) {
+    free_method(bb_list[i]);
   }
 }
 
@@ -538,10 +549,10 @@ void BBGrid<BBC, BBC_CLIST, BBC_C_IT>::RemoveBBox(BBC* bbox) {
   int grid_index = start_y * gridwidth_;
   for (int y = start_y; y <= end_y; ++y, grid_index += gridwidth_) {
     for (int x = start_x; x <= end_x; ++x) {
-      BBC_C_IT it(&grid_[grid_index + x]);
-      for (it.mark_cycle_pt(); !it.cycled_list(); it.forward()) {
-        if (it.data() == bbox)
-          it.extract();
+      GenericVector<BBC*>* cell = &grid_[grid_index + x];
+      for (int i = cell->size() - 1; i >= 0; --i) {
+        if ((*cell)[i] == bbox)
+          cell->remove(i);
       }
     }
   }
@@ -562,7 +573,7 @@ IntGrid* BBGrid<BBC, BBC_CLIST, BBC_C_IT>::CountCellElements() {
   IntGrid* intgrid = new IntGrid(gridsize(), bleft(), tright());
   for (int y = 0; y < gridheight(); ++y) {
     for (int x = 0; x < gridwidth(); ++x) {
-      int cell_count = grid_[y * gridwidth() + x].length();
+      int cell_count = grid_[y * gridwidth() + x].size();
       intgrid->SetGridCell(x, y, cell_count);
     }
   }
@@ -638,13 +649,13 @@ template<class BBC, class BBC_CLIST, class BBC_C_IT>
 void BBGrid<BBC, BBC_CLIST, BBC_C_IT>::AssertNoDuplicates() {
   // Process all grid cells.
   for (int i = gridwidth_ * gridheight_ - 1; i >= 0; --i) {
+    const GenericVector<BBC*>& cell = grid_[i];
     // Iterate over all elements excent the last.
-    for (BBC_C_IT it(&grid_[i]); !it.at_last(); it.forward()) {
-      BBC* ptr = it.data();
-      BBC_C_IT it2(it);
-      // None of the rest of the elements in the list should equal ptr.
-      for (it2.forward(); !it2.at_first(); it2.forward()) {
-        ASSERT_HOST(it2.data() != ptr);
+    for (int j = 0; j + 1 < cell.size(); ++j) {
+      BBC* ptr = cell[j];
+      // None of the rest of the elements in the cell should equal ptr.
+      for (int k = j + 1; k < cell.size(); ++k) {
+        ASSERT_HOST(cell[k] != ptr);
       }
     }
   }
@@ -676,7 +687,7 @@ BBC* GridSearch<BBC, BBC_CLIST, BBC_C_IT>::NextFullSearch() {
   int x;
   int y;
   do {
-    while (it_.cycled_list()) {
+    while (CellExhausted()) {
       ++x_;
       if (x_ >= grid_->gridwidth_) {
         --y_;
@@ -712,7 +723,7 @@ void GridSearch<BBC, BBC_CLIST, BBC_C_IT>::StartRadSearch(int x, int y,
 template<class BBC, class BBC_CLIST, class BBC_C_IT>
 BBC* GridSearch<BBC, BBC_CLIST, BBC_C_IT>::NextRadSearch() {
   do {
-    while (it_.cycled_list()) {
+    while (CellExhausted()) {
       ++rad_index_;
       if (rad_index_ >= radius_) {
         ++rad_dir_;
@@ -759,7 +770,7 @@ void GridSearch<BBC, BBC_CLIST, BBC_C_IT>::StartSideSearch(int x,
 template<class BBC, class BBC_CLIST, class BBC_C_IT>
 BBC* GridSearch<BBC, BBC_CLIST, BBC_C_IT>::NextSideSearch(bool right_to_left) {
   do {
-    while (it_.cycled_list()) {
+    while (CellExhausted()) {
       ++rad_index_;
       if (rad_index_ > radius_) {
         if (right_to_left)
@@ -800,7 +811,7 @@ template<class BBC, class BBC_CLIST, class BBC_C_IT>
 BBC* GridSearch<BBC, BBC_CLIST, BBC_C_IT>::NextVerticalSearch(
     bool top_to_bottom) {
   do {
-    while (it_.cycled_list()) {
+    while (CellExhausted()) {
       ++rad_index_;
       if (rad_index_ > radius_) {
         if (top_to_bottom)
@@ -838,7 +849,7 @@ void GridSearch<BBC, BBC_CLIST, BBC_C_IT>::StartRectSearch(const TBOX& rect) {
 template<class BBC, class BBC_CLIST, class BBC_C_IT>
 BBC* GridSearch<BBC, BBC_CLIST, BBC_C_IT>::NextRectSearch() {
   do {
-    while (it_.cycled_list()) {
+    while (CellExhausted()) {
       ++x_;
       if (x_ > max_radius_) {
         --y_;
@@ -861,21 +872,21 @@ BBC* GridSearch<BBC, BBC_CLIST, BBC_C_IT>::NextRectSearch() {
 template<class BBC, class BBC_CLIST, class BBC_C_IT>
 void GridSearch<BBC, BBC_CLIST, BBC_C_IT>::RemoveBBox() {
   if (previous_return_ != NULL) {
-    // Remove all instances of previous_return_ from the list, so the iterator
-    // remains valid after removal from the rest of the grid cells.
-    // if previous_return_ is not on the list, then it has been removed already.
+    // Find the neighbours of previous_return_ in the current cell, so the
+    // search can be repositioned after removal from all the grid cells.
+    // if previous_return_ is not in the cell, then it has been removed already.
+    const GenericVector<BBC*>& cell = *cell_;
     BBC* prev_data = NULL;
     BBC* new_previous_return = NULL;
-    it_.move_to_first();
-    for (it_.mark_cycle_pt(); !it_.cycled_list();) {
-      if (it_.data() ==  previous_return_) {
+    for (int i = 0; i < cell.size(); ++i) {
+      if (cell[i] == previous_return_) {
         new_previous_return = prev_data;
-        it_.extract();
-        it_.forward();
-        next_return_ = it_.cycled_list() ? NULL : it_.data();
+        int next = i + 1;
+        while (next < cell.size() && cell[next] == previous_return_)
+          ++next;
+        next_return_ = next < cell.size() ? cell[next] : NULL;
       } else {
-        prev_data = it_.data();
-        it_.forward();
+        prev_data = cell[i];
       }
     }
     grid_->RemoveBBox(previous_return_);
@@ -888,26 +899,29 @@ template<class BBC, class BBC_CLIST, class BBC_C_IT>
 void GridSearch<BBC, BBC_CLIST, BBC_C_IT>::RepositionIterator() {
   // Something was deleted, so we have little choice but to clear the
   // returns list.
-  returns_.shallow_clear();
-  // Reset the iterator back to one past the previous return.
-  // If the previous_return_ is no longer in the list, then
+  returns_.truncate(0);
+  if (cell_ == NULL)
+    return;
+  // Reset the index back to one past the previous return.
+  // If the previous_return_ is no longer in the cell, then
   // next_return_ serves as a backup.
-  it_.move_to_first();
+  const GenericVector<BBC*>& cell = *cell_;
   // Special case, the first element was removed and reposition
-  // iterator was called. In this case, the data is fine, but the
-  // cycle point is not. Detect it and return.
-  if (!it_.empty() && it_.data() == next_return_) {
-    it_.mark_cycle_pt();
+  // iterator was called. Detect it and start from the beginning.
+  if (!cell.empty() && cell[0] == next_return_) {
+    cell_index_ = 0;
     return;
   }
-  for (it_.mark_cycle_pt(); !it_.cycled_list(); it_.forward()) {
-    if (it_.data() == previous_return_ ||
-        it_.data_relative(1) == next_return_) {
+  for (int i = 0; i < cell.size(); ++i) {
+    if (cell[i] == previous_return_ ||
+        (i + 1 < cell.size() && cell[i + 1] == next_return_)) {
+      cell_index_ = i;
       CommonNext();
       return;
     }
   }
-  // We ran off the end of the list. Move to a new cell next time.
+  // We ran off the end of the cell. Move to a new cell next time.
+  cell_index_ = cell.size();
   previous_return_ = NULL;
   next_return_ = NULL;
 }
@@ -920,16 +934,15 @@ void GridSearch<BBC, BBC_CLIST, BBC_C_IT>::CommonStart(int x, int y) {
   y_ = y_origin_;
   SetIterator();
   previous_return_ = NULL;
-  next_return_ = it_.empty() ? NULL : it_.data();
-  returns_.shallow_clear();
+  next_return_ = cell_->empty() ? NULL : (*cell_)[0];
+  returns_.truncate(0);
 }
 
 // Factored out helper to complete a next search.
 template<class BBC, class BBC_CLIST, class BBC_C_IT>
 BBC* GridSearch<BBC, BBC_CLIST, BBC_C_IT>::CommonNext() {
-  previous_return_ = it_.data();
-  it_.forward();
-  next_return_ = it_.cycled_list() ? NULL : it_.data();
+  previous_return_ = (*cell_)[cell_index_++];
+  next_return_ = CellExhausted() ? NULL : (*cell_)[cell_index_];
   return previous_return_;
 }
 
@@ -945,8 +958,8 @@ BBC* GridSearch<BBC, BBC_CLIST, BBC_C_IT>::CommonEnd() {
 // grid coords and mark the cycle pt.
 template<class BBC, class BBC_CLIST, class BBC_C_IT>
 void GridSearch<BBC, BBC_CLIST, BBC_C_IT>::SetIterator() {
-  it_= &(grid_->grid_[y_ * grid_->gridwidth_ + x_]);
-  it_.mark_cycle_pt();
+  cell_ = &grid_->grid_[y_ * grid_->gridwidth_ + x_];
+  cell_index_ = 0;
 }
 
 }  // namespace tesseract.
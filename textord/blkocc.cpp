@@ -36,8 +36,8 @@
 #include "blkocc.h"
 #include "helpers.h"
 #include "notdll.h"
+#include "textord.h"
 
-double_VAR(textord_underline_threshold, 0.5, "Fraction of width occupied");
 
 // Forward declarations of static functions
 static void horizontal_cblob_projection(C_BLOB *blob,   // blob to project
@@ -52,7 +52,8 @@ static void horizontal_coutline_projection(C_OUTLINE *outline,
  * Return TRUE if it is.
  */
 
-BOOL8 test_underline(                   //look for underlines
+namespace tesseract {
+BOOL8 Textord::test_underline(                   //look for underlines
                      BOOL8 testing_on,  //< drawing blob
                      C_BLOB *blob,      //< blob to test
                      inT16 baseline,    //< coords of baseline
@@ -114,6 +115,7 @@ BOOL8 test_underline(                   //look for underlines
     return TRUE;                 //overline
   return FALSE;                  //neither
 }
+}  // namespace tesseract.
 
 
 /**
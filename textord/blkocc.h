@@ -246,20 +246,5 @@ class BAND
 
 #define END_OF_WERD_CODE 255
 
-extern BOOL_VAR_H (blockocc_show_result, FALSE, "Show intermediate results");
-extern INT_VAR_H (blockocc_desc_height, 0,
-"Descender height after normalisation");
-extern INT_VAR_H (blockocc_asc_height, 255,
-"Ascender height after normalisation");
-extern INT_VAR_H (blockocc_band_count, 4, "Number of bands used");
-extern double_VAR_H (textord_underline_threshold, 0.9,
-"Fraction of width occupied");
-
-BOOL8 test_underline(                   //look for underlines
-                     BOOL8 testing_on,  //drawing blob
-                     C_BLOB *blob,      //blob to test
-                     inT16 baseline,    //coords of baseline
-                     inT16 xheight      //height of line
-                    );
 
 #endif
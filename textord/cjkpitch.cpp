@@ -22,10 +22,8 @@
 #include "ndminx.h"
 #include "topitch.h"
 #include "tovars.h"
+#include "textord.h"
 
-BOOL_VAR(textord_space_size_is_variable, FALSE,
-         "If true, word delimiter spaces are assumed to have "
-         "variable width, even though characters have fixed pitch.");
 
 namespace {
 
@@ -270,13 +268,15 @@ class FPRow {
  public:
   FPRow() : pitch_(0.0f), estimated_pitch_(0.0f),
             all_pitches_(), all_gaps_(), good_pitches_(), good_gaps_(),
-            heights_(), characters_(), real_row_(NULL) {
+            heights_(), characters_(), real_row_(NULL),
+            space_size_is_variable_(false) {
   }
 
   ~FPRow() { }
 
-  // Initialize from TD_ROW.
-  void Init(TO_ROW *row);
+  // Initialize from TD_ROW. space_size_is_variable is the value of
+  // Textord::textord_space_size_is_variable.
+  void Init(TO_ROW *row, bool space_size_is_variable);
 
   // Estimate character pitch of this row, based on current alignment
   // status of underlying FPChar's.  The argument pass1 can be set to
@@ -418,7 +418,7 @@ class FPRow {
   }
 
   // Check if two neighboring characters satisfy the fixed pitch model.
-  static bool is_good_pitch(float pitch, const TBOX& box1, const TBOX& box2) {
+  bool is_good_pitch(float pitch, const TBOX& box1, const TBOX& box2) const {
     // Character box shouldn't exceed pitch.
     if (box1.width() >= pitch * (1.0 + kFPTolerance) ||
         box2.width() >= pitch * (1.0 + kFPTolerance) ||
@@ -428,7 +428,7 @@ class FPRow {
     const float real_pitch = box_pitch(box1, box2);
     if (abs(real_pitch - pitch) < pitch * kFPTolerance) return true;
 
-    if (textord_space_size_is_variable) {
+    if (space_size_is_variable_) {
       // Hangul characters usually have fixed pitch, but words are
       // delimited by space which can be narrower than characters.
       if (real_pitch > pitch && real_pitch < pitch * 2.0 &&
@@ -476,12 +476,14 @@ class FPRow {
 
   GenericVector<FPChar> characters_;
   TO_ROW *real_row_;  // Underlying TD_ROW for this row.
+  bool space_size_is_variable_;  // Words may be delimited by narrow spaces.
 };
 
-void FPRow::Init(TO_ROW *row) {
+void FPRow::Init(TO_ROW *row, bool space_size_is_variable) {
   ASSERT_HOST(row != NULL);
   ASSERT_HOST(row->xheight > 0);
   real_row_ = row;
+  space_size_is_variable_ = space_size_is_variable;
   real_row_->pitch_decision = PITCH_CORR_PROP;  // Default decision.
 
   BLOBNBOX_IT blob_it = row->blob_list();
@@ -915,7 +917,8 @@ class FPAnalyzer {
   FPAnalyzer(): page_tr_(), rows_() { }
   ~FPAnalyzer() { }
 
-  void Init(ICOORD page_tr, TO_BLOCK_LIST *port_blocks);
+  void Init(ICOORD page_tr, TO_BLOCK_LIST *port_blocks,
+            bool space_size_is_variable);
 
   void Pass1Analyze() {
     for (int i = 0; i < rows_.size(); i++) rows_[i].Pass1Analyze();
@@ -980,7 +983,8 @@ class FPAnalyzer {
   int max_chars_per_row_;
 };
 
-void FPAnalyzer::Init(ICOORD page_tr, TO_BLOCK_LIST *port_blocks) {
+void FPAnalyzer::Init(ICOORD page_tr, TO_BLOCK_LIST *port_blocks,
+                      bool space_size_is_variable) {
   page_tr_ = page_tr;
 
   TO_BLOCK_IT block_it;
@@ -1002,7 +1006,7 @@ void FPAnalyzer::Init(ICOORD page_tr, TO_BLOCK_LIST *port_blocks) {
     TO_ROW_IT row_it = block_it.data()->get_rows();
     for (row_it.mark_cycle_pt(); !row_it.cycled_list(); row_it.forward()) {
       FPRow row;
-      row.Init(row_it.data());
+      row.Init(row_it.data(), space_size_is_variable);
       rows_.push_back(row);
       int num_chars = rows_.back().num_chars();
       if (num_chars <= 1) num_empty_rows_++;
@@ -1054,10 +1058,11 @@ void FPAnalyzer::EstimatePitch(bool pass1) {
 
 }  // namespace
 
-void compute_fixed_pitch_cjk(ICOORD page_tr,
+namespace tesseract {
+void Textord::compute_fixed_pitch_cjk(ICOORD page_tr,
                              TO_BLOCK_LIST *port_blocks) {
   FPAnalyzer analyzer;
-  analyzer.Init(page_tr, port_blocks);
+  analyzer.Init(page_tr, port_blocks, textord_space_size_is_variable);
   if (analyzer.num_rows() == 0) return;
 
   analyzer.Pass1Analyze();
@@ -1092,3 +1097,4 @@ void compute_fixed_pitch_cjk(ICOORD page_tr,
   analyzer.OutputEstimations();
   if (textord_debug_pitch_test) analyzer.DebugOutputResult();
 }
+}  // namespace tesseract.
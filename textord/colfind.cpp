@@ -62,6 +62,9 @@ const double kMinGutterWidthGrid = 0.5;
 // Max multiple of a partition's median size as a distance threshold for
 // adding noise blobs.
 const double kMaxDistToPartSizeRatio = 1.5;
+// Min number of cost comparisons in RangeModalColumnSet to make it worth
+// starting threads.
+const int kMinParallelModalWork = 10000;
 
 BOOL_VAR(textord_tabfind_show_initial_partitions,
          false, "Show partition bounds");
@@ -71,7 +74,6 @@ INT_VAR(textord_tabfind_show_partitions, 0,
         "Show partition bounds, waiting if >1");
 BOOL_VAR(textord_tabfind_show_columns, false, "Show column bounds");
 BOOL_VAR(textord_tabfind_show_blocks, false, "Show final block bounds");
-BOOL_VAR(textord_tabfind_find_tables, true, "run table detection");
 
 ScrollView* ColumnFinder::blocks_win_ = NULL;
 
@@ -83,18 +85,20 @@ ScrollView* ColumnFinder::blocks_win_ = NULL;
 // the sum logical vertical vector produced by LineFinder::FindVerticalLines.
 ColumnFinder::ColumnFinder(int gridsize,
                            const ICOORD& bleft, const ICOORD& tright,
-                           int resolution,
+                           int resolution, double aligned_gap_fraction,
                            TabVector_LIST* vlines, TabVector_LIST* hlines,
                            int vertical_x, int vertical_y)
   : TabFind(gridsize, bleft, tright, vlines, vertical_x, vertical_y,
-            resolution),
+            resolution, aligned_gap_fraction),
     min_gutter_width_(static_cast<int>(kMinGutterWidthGrid * gridsize)),
     mean_column_gap_(tright.x() - bleft.x()),
     reskew_(1.0f, 0.0f), rotation_(1.0f, 0.0f), rerotate_(1.0f, 0.0f),
     best_columns_(NULL), stroke_width_(NULL),
     part_grid_(gridsize, bleft, tright), nontext_map_(NULL),
     projection_(resolution),
-    denorm_(NULL), input_blobs_win_(NULL), equation_detect_(NULL) {
+    denorm_(NULL), input_blobs_win_(NULL), equation_detect_(NULL),
+    table_detection_skipped_(false), find_tables_(true),
+    recognize_tables_(false), only_strokewidths_(false) {
   TabVector_IT h_it(&horizontal_lines_);
   h_it.add_list_after(hlines);
 }
@@ -153,6 +157,7 @@ void ColumnFinder::SetupAndFilterNoise(Pix* photo_mask_pix,
   if (stroke_width_ != NULL)
     delete stroke_width_;
   stroke_width_ = new StrokeWidth(gridsize(), bleft(), tright());
+  stroke_width_->set_only_strokewidths(only_strokewidths_);
   min_gutter_width_ = static_cast<int>(kMinGutterWidthGrid * gridsize());
   input_block->ReSetAndReFilterBlobs();
   #ifndef GRAPHICS_DISABLED
@@ -186,9 +191,11 @@ void ColumnFinder::SetupAndFilterNoise(Pix* photo_mask_pix,
 // is vertical, like say Japanese, or due to text whose writing direction is
 // horizontal but whose text appears vertically aligned because the image is
 // not the right way up.
-bool ColumnFinder::IsVerticallyAlignedText(TO_BLOCK* block,
+bool ColumnFinder::IsVerticallyAlignedText(double find_vertical_text_ratio,
+                                           TO_BLOCK* block,
                                            BLOBNBOX_CLIST* osd_blobs) {
-  return stroke_width_->TestVerticalTextDirection(block, osd_blobs);
+  return stroke_width_->TestVerticalTextDirection(find_vertical_text_ratio,
+                                                  block, osd_blobs);
 }
 
 // Rotates the blobs and the TabVectors so that the gross writing direction
@@ -394,17 +401,26 @@ int ColumnFinder::FindBlocks(bool single_column,
   if (equation_detect_) {
     equation_detect_->FindEquationParts(&part_grid_, best_columns_);
   }
-  if (textord_tabfind_find_tables) {
+  if (find_tables_) {
     TableFinder table_finder;
     table_finder.Init(gridsize(), bleft(), tright());
     table_finder.set_resolution(resolution_);
+    table_finder.set_recognize_tables(recognize_tables_);
     table_finder.set_left_to_right_language(
         !input_block->block->right_to_left());
-    // Copy cleaned partitions from part_grid_ to clean_part_grid_ and
-    // insert dot-like noise into period_grid_
-    table_finder.InsertCleanPartitions(&part_grid_, input_block);
-    // Get Table Regions
-    table_finder.LocateTables(&part_grid_, best_columns_, WidthCB(), reskew_);
+    table_detection_skipped_ =
+        !table_finder.PageMayContainTables(&part_grid_, best_columns_);
+    if (table_detection_skipped_) {
+      if (textord_debug_tabfind)
+        tprintf("No table evidence, skipping table detection\n");
+    } else {
+      // Copy cleaned partitions from part_grid_ to clean_part_grid_ and
+      // insert dot-like noise into period_grid_
+      table_finder.InsertCleanPartitions(&part_grid_, input_block);
+      // Get Table Regions
+      table_finder.LocateTables(&part_grid_, best_columns_, WidthCB(),
+                                reskew_);
+    }
   }
   GridRemoveUnderlinePartitions();
   part_grid_.DeleteUnknownParts(input_block);
@@ -665,6 +681,11 @@ void ColumnFinder::AssignColumns(const PartSetVector& part_sets) {
   int** column_set_costs = new int*[set_count];
   // Set possible column_sets to indicate whether each set is compatible
   // with each column.
+  // Each part_i only reads the column and partition sets and writes its own
+  // row, so the rows can be computed in parallel.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif  // _OPENMP
   for (int part_i = 0; part_i < set_count; ++part_i) {
     ColPartitionSet* line_set = part_sets.get(part_i);
     bool debug = line_set != NULL &&
@@ -780,15 +801,33 @@ int ColumnFinder::RangeModalColumnSet(int** column_set_costs,
                                       const int* assigned_costs,
                                       int start, int end) {
   int column_count = column_sets_.size();
-  STATS column_stats(0, column_count);
-  for (int part_i = start; part_i < end; ++part_i) {
-    for (int col_j = 0; col_j < column_count; ++col_j) {
+  // Count each column set independently, so the counts can be made in
+  // parallel over the column sets.
+  int* column_counts = new int[column_count];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+    if (column_count * (end - start) >= kMinParallelModalWork)
+#endif  // _OPENMP
+  for (int col_j = 0; col_j < column_count; ++col_j) {
+    int count = 0;
+    for (int part_i = start; part_i < end; ++part_i) {
       if (column_set_costs[part_i][col_j] < assigned_costs[part_i])
-        column_stats.add(col_j, 1);
+        ++count;
     }
+    column_counts[col_j] = count;
+  }
+  // Pick the mode with the same tie-breaking as STATS::mode: index 0 wins
+  // ties, otherwise the highest index does.
+  int total = column_counts[0];
+  int mode = 0;
+  for (int col_j = column_count - 1; col_j > 0; --col_j) {
+    total += column_counts[col_j];
+    if (column_counts[col_j] > column_counts[mode])
+      mode = col_j;
   }
-  ASSERT_HOST(column_stats.get_total() > 0);
-  return column_stats.mode();
+  delete [] column_counts;
+  ASSERT_HOST(total > 0);
+  return mode;
 }
 
 // Given that there are many column_set_id compatible columns in the range,
@@ -37,8 +37,6 @@ class TO_BLOCK;
 
 namespace tesseract {
 
-extern BOOL_VAR_H(textord_tabfind_find_tables, false, "run table detection");
-
 class ColPartitionSet;
 class ColPartitionSet_LIST;
 class ColSegment_LIST;
@@ -57,8 +55,11 @@ class ColumnFinder : public TabFind {
   // bleft and tright are the bounds of the image (rectangle) being processed.
   // vlines is a (possibly empty) list of TabVector and vertical_x and y are
   // the sum logical vertical vector produced by LineFinder::FindVerticalLines.
+  // aligned_gap_fraction is the fraction of the blob height used as the
+  // minimum gutter beside an aligned tab stop.
   ColumnFinder(int gridsize, const ICOORD& bleft, const ICOORD& tright,
-               int resolution, TabVector_LIST* vlines, TabVector_LIST* hlines,
+               int resolution, double aligned_gap_fraction,
+               TabVector_LIST* vlines, TabVector_LIST* hlines,
                int vertical_x, int vertical_y);
   virtual ~ColumnFinder();
 
@@ -112,7 +113,10 @@ class ColumnFinder : public TabFind {
   // is vertical, like say Japanese, or due to text whose writing direction is
   // horizontal but whose text appears vertically aligned because the image is
   // not the right way up.
-  bool IsVerticallyAlignedText(TO_BLOCK* block, BLOBNBOX_CLIST* osd_blobs);
+  // The text is taken to be vertical if at least find_vertical_text_ratio of
+  // the textline blobs are vertical.
+  bool IsVerticallyAlignedText(double find_vertical_text_ratio,
+                               TO_BLOCK* block, BLOBNBOX_CLIST* osd_blobs);
 
   // Rotates the blobs and the TabVectors so that the gross writing direction
   // (text lines) are horizontal and lines are read down the page.
@@ -154,6 +158,25 @@ class ColumnFinder : public TabFind {
   // Set the equation detection pointer.
   void SetEquationDetect(EquationDetectBase* detect);
 
+  // Sets whether FindBlocks runs table detection, and whether the table
+  // recognizer is used to filter the tables it finds.
+  void SetTableDetection(bool find_tables, bool recognize_tables) {
+    find_tables_ = find_tables;
+    recognize_tables_ = recognize_tables;
+  }
+
+  // Sets whether to exit the program once the stroke widths window shown by
+  // SetupAndFilterNoise is closed. Call before SetupAndFilterNoise.
+  void set_only_strokewidths(bool only_strokewidths) {
+    only_strokewidths_ = only_strokewidths;
+  }
+
+  // Returns true if FindBlocks skipped table detection because
+  // TableFinder::PageMayContainTables found no sign of a table.
+  bool table_detection_skipped() const {
+    return table_detection_skipped_;
+  }
+
  private:
   // Displays the blob and block bounding boxes in a window called Blocks.
   void DisplayBlocks(BLOCK_LIST* blocks);
@@ -333,6 +356,14 @@ class ColumnFinder : public TabFind {
   // class.
   EquationDetectBase* equation_detect_;
 
+  // True if table detection was skipped by its prefilter.
+  bool table_detection_skipped_;
+  // Table detection settings. See SetTableDetection.
+  bool find_tables_;
+  bool recognize_tables_;
+  // See set_only_strokewidths.
+  bool only_strokewidths_;
+
   // Allow a subsequent instance to reuse the blocks window.
   // Not thread-safe, but multiple threads shouldn't be using windows anyway.
   static ScrollView* blocks_win_;
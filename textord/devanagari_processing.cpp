@@ -24,14 +24,6 @@
 #include "img.h"
 #include "statistc.h"
 
-// Flags controlling the debugging information for shiro-rekha splitting
-// strategies.
-INT_VAR(devanagari_split_debuglevel, 0,
-        "Debug level for split shiro-rekha process.");
-
-BOOL_VAR(devanagari_split_debugimage, 0,
-         "Whether to create a debug image for split shiro-rekha process.");
-
 namespace tesseract {
 
 ShiroRekhaSplitter::ShiroRekhaSplitter() {
@@ -41,6 +33,8 @@ ShiroRekhaSplitter::ShiroRekhaSplitter() {
   global_xheight_ = kUnspecifiedXheight;
   perform_close_ = false;
   debug_image_ = NULL;
+  debug_level_ = 0;
+  make_debug_image_ = false;
   pageseg_split_strategy_ = NO_SPLIT;
   ocr_split_strategy_ = NO_SPLIT;
 }
@@ -87,7 +81,7 @@ bool ShiroRekhaSplitter::Split(bool split_for_pageseg) {
   ASSERT_HOST(split_strategy == MINIMAL_SPLIT ||
               split_strategy == MAXIMAL_SPLIT);
   ASSERT_HOST(orig_pix_);
-  if (devanagari_split_debuglevel > 0) {
+  if (debug_level_ > 0) {
     tprintf("Splitting shiro-rekha ...\n");
     tprintf("Split strategy = %s\n",
             split_strategy == MINIMAL_SPLIT ? "Minimal" : "Maximal");
@@ -99,7 +93,7 @@ bool ShiroRekhaSplitter::Split(bool split_for_pageseg) {
   splitted_image_ = pixCopy(NULL, orig_pix_);
 
   // Initialize debug image if required.
-  if (devanagari_split_debugimage) {
+  if (make_debug_image_) {
     pixDestroy(&debug_image_);
     debug_image_ = pixConvertTo32(orig_pix_);
   }
@@ -109,7 +103,7 @@ bool ShiroRekhaSplitter::Split(bool split_for_pageseg) {
   Pix* pix_for_ccs = pixClone(orig_pix_);
   if (perform_close_ && global_xheight_ != kUnspecifiedXheight &&
       !segmentation_block_list_) {
-    if (devanagari_split_debuglevel > 0) {
+    if (debug_level_ > 0) {
       tprintf("Performing a global close operation..\n");
     }
     // A global measure is available for xheight, but no local information
@@ -133,7 +127,7 @@ bool ShiroRekhaSplitter::Split(bool split_for_pageseg) {
     ASSERT_HOST(word_pix);
     int xheight = GetXheightForCC(box);
     if (xheight == kUnspecifiedXheight && segmentation_block_list_ &&
-        devanagari_split_debugimage) {
+        make_debug_image_) {
       pixRenderBoxArb(debug_image_, box, 1, 255, 0, 0);
     }
     // If some xheight measure is available, attempt to pre-eliminate small
@@ -144,7 +138,7 @@ bool ShiroRekhaSplitter::Split(bool split_for_pageseg) {
         (box->w > xheight / 3 && box->h > xheight / 2)) {
       SplitWordShiroRekha(split_strategy, word_pix, xheight,
                           box->x, box->y, regions_to_clear);
-    } else if (devanagari_split_debuglevel > 0) {
+    } else if (debug_level_ > 0) {
       tprintf("CC dropped from splitting: %d,%d (%d, %d)\n",
               box->x, box->y, box->w, box->h);
     }
@@ -158,7 +152,7 @@ bool ShiroRekhaSplitter::Split(bool split_for_pageseg) {
   }
   boxaDestroy(&regions_to_clear);
   pixaDestroy(&ccs);
-  if (devanagari_split_debugimage) {
+  if (make_debug_image_) {
     DumpDebugImage(split_for_pageseg ? "pageseg_split_debug.png" :
                    "ocr_split_debug.png");
   }
@@ -255,7 +249,7 @@ void ShiroRekhaSplitter::SplitWordShiroRekha(SplitStrategy split_strategy,
   // because xheight information was unavailable.
   if (shirorekha_ylevel > height / 2) {
     // Shirorekha shouldn't be in the bottom half of the word.
-    if (devanagari_split_debuglevel > 0) {
+    if (debug_level_ > 0) {
       tprintf("Skipping splitting CC at (%d, %d): shirorekha in lower half..\n",
               word_left, word_top);
     }
@@ -263,7 +257,7 @@ void ShiroRekhaSplitter::SplitWordShiroRekha(SplitStrategy split_strategy,
   }
   if (stroke_width > height / 3) {
     // Even the boldest of fonts shouldn't do this.
-    if (devanagari_split_debuglevel > 0) {
+    if (debug_level_ > 0) {
       tprintf("Skipping splitting CC at (%d, %d): stroke width too huge..\n",
               word_left, word_top);
     }
@@ -333,7 +327,7 @@ void ShiroRekhaSplitter::SplitWordShiroRekha(SplitStrategy split_strategy,
           if (box_to_clear) {
             boxaAddBox(regions_to_clear, box_to_clear, L_CLONE);
             // Mark this in the debug image if needed.
-            if (devanagari_split_debugimage) {
+            if (make_debug_image_) {
               pixRenderBoxArb(debug_image_, box_to_clear, 1, 128, 255, 128);
             }
             boxDestroy(&box_to_clear);
@@ -356,7 +350,7 @@ void ShiroRekhaSplitter::RefreshSegmentationWithNewBlobs(
     C_BLOB_LIST* new_blobs) {
   // The segmentation block list must have been specified.
   ASSERT_HOST(segmentation_block_list_);
-  if (devanagari_split_debuglevel > 0) {
+  if (debug_level_ > 0) {
     tprintf("Before refreshing blobs:\n");
     PrintSegmentationStats(segmentation_block_list_);
     tprintf("New Blobs found: %d\n", new_blobs->length());
@@ -365,14 +359,14 @@ void ShiroRekhaSplitter::RefreshSegmentationWithNewBlobs(
   C_BLOB_LIST not_found_blobs;
   RefreshWordBlobsFromNewBlobs(segmentation_block_list_,
                                new_blobs,
-                               ((devanagari_split_debugimage && debug_image_) ?
+                               ((make_debug_image_ && debug_image_) ?
                                 &not_found_blobs : NULL));
 
-  if (devanagari_split_debuglevel > 0) {
+  if (debug_level_ > 0) {
     tprintf("After refreshing blobs:\n");
     PrintSegmentationStats(segmentation_block_list_);
   }
-  if (devanagari_split_debugimage && debug_image_) {
+  if (make_debug_image_ && debug_image_) {
     // Plot out the original blobs for which no match was found in the new
     // all_blobs list.
     C_BLOB_IT not_found_it(&not_found_blobs);
@@ -11,14 +11,6 @@ struct Pix;
 struct Box;
 struct Boxa;
 
-extern
-INT_VAR_H(devanagari_split_debuglevel, 0,
-          "Debug level for split shiro-rekha process.");
-
-extern
-BOOL_VAR_H(devanagari_split_debugimage, 0,
-           "Whether to create a debug image for split shiro-rekha process.");
-
 class TBOX;
 class IMAGE;
 
@@ -110,6 +102,16 @@ class ShiroRekhaSplitter {
     perform_close_ = perform;
   }
 
+  // Sets the debug level for the splitting process.
+  void set_debug_level(int level) {
+    debug_level_ = level;
+  }
+
+  // Sets whether a debug image is created while splitting.
+  void set_make_debug_image(bool make) {
+    make_debug_image_ = make;
+  }
+
   // Returns the image obtained from shiro-rekha splitting. The returned object
   // is owned by this class. Callers may want to clone the returned pix to keep
   // it alive beyond the life of ShiroRekhaSplitter object.
@@ -200,6 +202,10 @@ class ShiroRekhaSplitter {
   int global_xheight_;
   bool perform_close_;  // Whether a morphological close operation should be
                         // performed before CCs are run through splitting.
+  // Flags controlling the debugging information for shiro-rekha splitting
+  // strategies.
+  int debug_level_;
+  bool make_debug_image_;
 };
 
 }  // namespace tesseract.
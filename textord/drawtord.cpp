@@ -21,6 +21,7 @@
 #include          "pithsync.h"
 #include          "topitch.h"
 #include          "drawtord.h"
+#include          "textord.h"
 
 // Include automatically generated configuration file if running autoconf.
 #ifdef HAVE_CONFIG_H
@@ -34,8 +35,6 @@
 
 #define EXTERN
 
-EXTERN BOOL_VAR (textord_show_fixed_cuts, FALSE,
-"Draw fixed pitch cell boundaries");
 
 EXTERN ScrollView* to_win = NULL;
 
@@ -247,7 +246,8 @@ void draw_meanlines(                  //draw a block
  * highlighted.
  **********************************************************************/
 
-void plot_word_decisions(              //draw words
+namespace tesseract {
+void Textord::plot_word_decisions(              //draw words
                          ScrollView* win,   //window tro draw in
                          inT16 pitch,  //of block
                          TO_ROW *row   //row to draw
@@ -317,7 +317,7 @@ void plot_word_decisions(              //draw words
  * Make a list of fixed pitch cuts and draw them.
  **********************************************************************/
 
-void plot_fp_cells(                        //draw words
+void Textord::plot_fp_cells(                        //draw words
                    ScrollView* win,             //window tro draw in
                    ScrollView::Color colour,          //colour of lines
                    BLOBNBOX_IT *blob_it,   //blobs
@@ -353,6 +353,7 @@ void plot_fp_cells(                        //draw words
     win->Line(segpt->position (), word_box.bottom (),segpt->position (), word_box.top ());
   }
 }
+}  // namespace tesseract.
 
 
 /**********************************************************************
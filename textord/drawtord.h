@@ -28,10 +28,6 @@
 
 #define NO_SMD        "none"
 
-extern BOOL_VAR_H (textord_show_fixed_cuts, FALSE,
-"Draw fixed pitch cell boundaries");
-extern STRING_VAR_H (to_debugfile, DEBUG_WIN_NAME, "Name of debugfile");
-extern STRING_VAR_H (to_smdfile, NO_SMD, "Name of SMD file");
 extern ScrollView* to_win;
 extern FILE *to_debug;
 void create_to_win(                //make features win
@@ -70,21 +66,6 @@ void draw_meanlines(                  //draw a block
                     ScrollView::Color colour,    //colour to draw in
                     FCOORD rotation   //rotation for line
                    );
-void plot_word_decisions(              //draw words
-                         ScrollView* win,   //window tro draw in
-                         inT16 pitch,  //of block
-                         TO_ROW *row   //row to draw
-                        );
-void plot_fp_cells(                        //draw words
-                   ScrollView* win,             //window tro draw in
-                   ScrollView::Color colour,          //colour of lines
-                   BLOBNBOX_IT *blob_it,   //blobs
-                   inT16 pitch,            //of block
-                   inT16 blob_count,       //no of real blobs
-                   STATS *projection,      //vertical
-                   inT16 projection_left,  //edges //scale factor
-                   inT16 projection_right,
-                   float projection_scale);
 void plot_fp_cells2(                        //draw words
                     ScrollView* win,             //window tro draw in
                     ScrollView::Color colour,          //colour of lines
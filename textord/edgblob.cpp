@@ -22,44 +22,13 @@
 #include "drawedg.h"
 #include "edgloop.h"
 #include "edgblob.h"
+#include "textord.h"
 
 // Include automatically generated configuration file if running autoconf.
 #ifdef HAVE_CONFIG_H
 #include "config_auto.h"
 #endif
 
-#define EXTERN
-
-// Control parameters used in outline_complexity(), which rejects an outline
-// if any one of the 3 conditions is satisfied:
-//  - number of children exceeds edges_max_children_per_outline
-//  - number of nested layers exceeds edges_max_children_layers
-//  - joint complexity exceeds edges_children_count_limit(as in child_count())
-EXTERN BOOL_VAR(edges_use_new_outline_complexity, FALSE,
-                "Use the new outline complexity module");
-EXTERN INT_VAR(edges_max_children_per_outline, 10,
-               "Max number of children inside a character outline");
-EXTERN INT_VAR(edges_max_children_layers, 5,
-               "Max layers of nested children inside a character outline");
-EXTERN BOOL_VAR(edges_debug, FALSE,
-                "turn on debugging for this module");
-
-
-EXTERN INT_VAR(edges_children_per_grandchild, 10,
-               "Importance ratio for chucking outlines");
-EXTERN INT_VAR(edges_children_count_limit, 45,
-               "Max holes allowed in blob");
-EXTERN BOOL_VAR(edges_children_fix, FALSE,
-                "Remove boxy parents of char-like children");
-EXTERN INT_VAR(edges_min_nonhole, 12,
-               "Min pixels for potential char in box");
-EXTERN INT_VAR(edges_patharea_ratio, 40,
-               "Max lensq/area for acceptable child outline");
-EXTERN double_VAR(edges_childarea, 0.5,
-                  "Min area fraction of child outline");
-EXTERN double_VAR(edges_boxarea, 0.875,
-                  "Min area fraction of grandchild for box");
-
 /**
  * @name OL_BUCKETS::OL_BUCKETS
  *
@@ -67,8 +36,9 @@ EXTERN double_VAR(edges_boxarea, 0.875,
  */
 
 OL_BUCKETS::OL_BUCKETS(
+const tesseract::Textord* owner, // params to use
 ICOORD bleft,                    // corners
-ICOORD tright):         bl(bleft), tr(tright) {
+ICOORD tright):         textord(owner), bl(bleft), tr(tright) {
   bxdim =(tright.x() - bleft.x()) / BUCKETSIZE + 1;
   bydim =(tright.y() - bleft.y()) / BUCKETSIZE + 1;
                                  // make array
@@ -132,7 +102,8 @@ inT32 OL_BUCKETS::outline_complexity(
   ymax =(olbox.top() - bl.y()) / BUCKETSIZE;
   child_count = 0;
   grandchild_count = 0;
-  if (++depth > edges_max_children_layers)  // nested loops are too deep
+  // nested loops are too deep
+  if (++depth > textord->edges_max_children_layers)
     return max_count + depth;
 
   for (yindex = ymin; yindex <= ymax; yindex++) {
@@ -147,22 +118,24 @@ inT32 OL_BUCKETS::outline_complexity(
           continue;
         child_count++;
 
-        if (child_count > edges_max_children_per_outline) {   // too fragmented
-          if (edges_debug)
+        // too fragmented
+        if (child_count > textord->edges_max_children_per_outline) {
+          if (textord->edges_debug)
             tprintf("Discard outline on child_count=%d > "
                     "max_children_per_outline=%d\n",
                     child_count,
-                    static_cast<inT32>(edges_max_children_per_outline));
+                    static_cast<inT32>(
+                        textord->edges_max_children_per_outline));
           return max_count + child_count;
         }
 
         // Compute the "complexity" of each child recursively
         inT32 remaining_count = max_count - child_count - grandchild_count;
         if (remaining_count > 0)
-          grandchild_count += edges_children_per_grandchild *
+          grandchild_count += textord->edges_children_per_grandchild *
                               outline_complexity(child, remaining_count, depth);
         if (child_count + grandchild_count > max_count) {  // too complex
-          if (edges_debug)
+          if (textord->edges_debug)
             tprintf("Disgard outline on child_count=%d + grandchild_count=%d "
                     "> max_count=%d\n",
                     child_count, grandchild_count, max_count);
@@ -221,15 +194,15 @@ inT32 OL_BUCKETS::count_children(                     // recursive count
           child_count++;
           if (child_count <= max_count) {
             int max_grand =(max_count - child_count) /
-                            edges_children_per_grandchild;
+                            textord->edges_children_per_grandchild;
             if (max_grand > 0)
               grandchild_count += count_children(child, max_grand) *
-                                  edges_children_per_grandchild;
+                                  textord->edges_children_per_grandchild;
             else
               grandchild_count += count_children(child, 1);
           }
           if (child_count + grandchild_count > max_count) {
-            if (edges_debug)
+            if (textord->edges_debug)
               tprintf("Discarding parent with child count=%d, gc=%d\n",
                       child_count,grandchild_count);
             return child_count + grandchild_count;
@@ -238,23 +211,24 @@ inT32 OL_BUCKETS::count_children(                     // recursive count
             parent_area = outline->outer_area();
             if (parent_area < 0)
               parent_area = -parent_area;
-            max_parent_area = outline->bounding_box().area() * edges_boxarea;
+            max_parent_area = outline->bounding_box().area() *
+                              textord->edges_boxarea;
             if (parent_area < max_parent_area)
               parent_box = FALSE;
           }
           if (parent_box &&
-              (!edges_children_fix ||
-               child->bounding_box().height() > edges_min_nonhole)) {
+              (!textord->edges_children_fix ||
+               child->bounding_box().height() > textord->edges_min_nonhole)) {
             child_area = child->outer_area();
             if (child_area < 0)
               child_area = -child_area;
-            if (edges_children_fix) {
+            if (textord->edges_children_fix) {
               if (parent_area - child_area < max_parent_area) {
                 parent_box = FALSE;
                 continue;
               }
               if (grandchild_count > 0) {
-                if (edges_debug)
+                if (textord->edges_debug)
                   tprintf("Discarding parent of area %d, child area=%d, max%g "
                           "with gc=%d\n",
                           parent_area, child_area, max_parent_area,
@@ -263,8 +237,8 @@ inT32 OL_BUCKETS::count_children(                     // recursive count
               }
               child_length = child->pathlength();
               if (child_length * child_length >
-                  child_area * edges_patharea_ratio) {
-                if (edges_debug)
+                  child_area * textord->edges_patharea_ratio) {
+                if (textord->edges_debug)
                   tprintf("Discarding parent of area %d, child area=%d, max%g "
                           "with child length=%d\n",
                           parent_area, child_area, max_parent_area,
@@ -272,8 +246,9 @@ inT32 OL_BUCKETS::count_children(                     // recursive count
                 return max_count + 1;
               }
             }
-            if (child_area < child->bounding_box().area() * edges_childarea) {
-              if (edges_debug)
+            if (child_area <
+                child->bounding_box().area() * textord->edges_childarea) {
+              if (textord->edges_debug)
                 tprintf("Discarding parent of area %d, child area=%d, max%g "
                         "with child rect=%d\n",
                         parent_area, child_area, max_parent_area,
@@ -332,7 +307,8 @@ void OL_BUCKETS::extract_children(                     // recursive count
  * Run the edge detector over the block and return a list of blobs.
  */
 
-void extract_edges(Pix* pix,  // thresholded image
+void extract_edges(const tesseract::Textord* textord,  // params to use
+                   Pix* pix,  // thresholded image
                    BLOCK *block) {  // block to scan
   C_OUTLINE_LIST outlines;       // outlines in block
   C_OUTLINE_IT out_it = &outlines;
@@ -341,12 +317,12 @@ void extract_edges(Pix* pix,  // thresholded image
   IMAGE image;
   image.FromPix(pix);
 
-  block_edges(&image, block, &out_it);
+  block_edges(&image, block, textord->edges_maxedgelength, &out_it);
   ICOORD bleft;                  // block box
   ICOORD tright;
   block->bounding_box(bleft, tright);
                                  // make blobs
-  outlines_to_blobs(block, bleft, tright, &outlines);
+  outlines_to_blobs(textord, block, bleft, tright, &outlines);
 }
 
 
@@ -357,15 +333,16 @@ void extract_edges(Pix* pix,  // thresholded image
  */
 
 void outlines_to_blobs(               // find blobs
+                       const tesseract::Textord* textord,  // params to use
                        BLOCK *block,  // block to scan
                        ICOORD bleft,
                        ICOORD tright,
                        C_OUTLINE_LIST *outlines) {
                                  // make buckets
-  OL_BUCKETS buckets(bleft, tright);
+  OL_BUCKETS buckets(textord, bleft, tright);
 
   fill_buckets(outlines, &buckets);
-  empty_buckets(block, &buckets);
+  empty_buckets(textord, block, &buckets);
 }
 
 
@@ -401,6 +378,7 @@ void fill_buckets(                           // find blobs
  */
 
 void empty_buckets(                     // find blobs
+                   const tesseract::Textord* textord,  // params to use
                    BLOCK *block,        // block to scan
                    OL_BUCKETS *buckets  // output buckets
                   ) {
@@ -426,7 +404,7 @@ void empty_buckets(                     // find blobs
 
                                  // move to new list
     out_it.add_after_then_move(parent_it.extract());
-    good_blob = capture_children(buckets, &junk_blobs, &out_it);
+    good_blob = capture_children(textord, buckets, &junk_blobs, &out_it);
     blob = new C_BLOB(&outlines);
     if (good_blob)
       good_blobs.add_after_then_move(blob);
@@ -447,6 +425,7 @@ void empty_buckets(                     // find blobs
  */
 
 BOOL8 capture_children(                       // find children
+                       const tesseract::Textord* textord,  // params to use
                        OL_BUCKETS *buckets,   // bucket sort clanss
                        C_BLOB_IT *reject_it,  // dead grandchildren
                        C_OUTLINE_IT *blob_it  // output outlines
@@ -455,14 +434,13 @@ BOOL8 capture_children(                       // find children
   inT32 child_count;             // no of children
 
   outline = blob_it->data();
-  if (edges_use_new_outline_complexity)
-    child_count = buckets->outline_complexity(outline,
-                                               edges_children_count_limit,
-                                               0);
+  if (textord->edges_use_new_outline_complexity)
+    child_count = buckets->outline_complexity(
+        outline, textord->edges_children_count_limit, 0);
   else
-    child_count = buckets->count_children(outline,
-                                           edges_children_count_limit);
-  if (child_count > edges_children_count_limit)
+    child_count = buckets->count_children(
+        outline, textord->edges_children_count_limit);
+  if (child_count > textord->edges_children_count_limit)
     return FALSE;
 
   if (child_count > 0)
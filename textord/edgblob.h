@@ -30,10 +30,15 @@
 
 #define BUCKETSIZE      16
 
+namespace tesseract {
+class Textord;
+}
+
 class OL_BUCKETS
 {
   public:
     OL_BUCKETS(               //constructor
+               const tesseract::Textord* owner,  //params to use
                ICOORD bleft,  //corners
                ICOORD tright);
 
@@ -66,6 +71,7 @@ class OL_BUCKETS
                           C_OUTLINE_IT *it);   //destination iterator
 
   private:
+    const tesseract::Textord* textord;  //owner of the edges_* params
     C_OUTLINE_LIST * buckets;    //array of buckets
     inT16 bxdim;                 //size of array
     inT16 bydim;
@@ -74,9 +80,11 @@ class OL_BUCKETS
     inT32 index;                 //for extraction scan
 };
 
-void extract_edges(Pix* pix,        // thresholded image
+void extract_edges(const tesseract::Textord* textord,  // params to use
+                   Pix* pix,        // thresholded image
                    BLOCK* block);   // block to scan
 void outlines_to_blobs(               //find blobs
+                       const tesseract::Textord* textord,  //params to use
                        BLOCK *block,  //block to scan
                        ICOORD bleft,  //block box //outlines in block
                        ICOORD tright,
@@ -86,10 +94,12 @@ void fill_buckets(                           //find blobs
                   OL_BUCKETS *buckets        //output buckets
                  );
 void empty_buckets(                     //find blobs
+                   const tesseract::Textord* textord,  //params to use
                    BLOCK *block,        //block to scan
                    OL_BUCKETS *buckets  //output buckets
                   );
 BOOL8 capture_children(                       //find children
+                       const tesseract::Textord* textord,  //params to use
                        OL_BUCKETS *buckets,   //bucket sort clanss
                        C_BLOB_IT *reject_it,  //dead grandchildren
                        C_OUTLINE_IT *blob_it  //output outlines
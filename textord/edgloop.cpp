@@ -29,7 +29,6 @@
 
 #define MINEDGELENGTH   8        // min decent length
 
-INT_VAR(edges_maxedgelength, 16000, "Max steps in any outline");
 
 /**********************************************************************
  * complete_edge
@@ -38,6 +37,7 @@ INT_VAR(edges_maxedgelength, 16000, "Max steps in any outline");
  **********************************************************************/
 
 void complete_edge(CRACKEDGE *start,  //start of loop
+                   inT32 max_edge_length,  //longest legal loop
                    C_OUTLINE_IT* outline_it) {
   ScrollView::Color colour;                 //colour to draw in
   inT16 looplength;              //steps in loop
@@ -46,7 +46,7 @@ void complete_edge(CRACKEDGE *start,  //start of loop
   C_OUTLINE *outline;            //new outline
 
                                  //check length etc.
-  colour = check_path_legal (start);
+  colour = check_path_legal (start, max_edge_length);
 
   if (colour == ScrollView::RED || colour == ScrollView::BLUE) {
     looplength = loop_bounding_box (start, botleft, topright);
@@ -68,7 +68,8 @@ void complete_edge(CRACKEDGE *start,  //start of loop
  **********************************************************************/
 
 ScrollView::Color check_path_legal(                  //certify outline
-                        CRACKEDGE *start  //start of loop
+                        CRACKEDGE *start,  //start of loop
+                        inT32 max_edge_length  //longest legal loop
                        ) {
   int lastchain;              //last chain code
   int chaindiff;               //chain code diff
@@ -95,7 +96,7 @@ ScrollView::Color check_path_legal(                  //certify outline
     }
     edgept = edgept->next;
   }
-  while (edgept != start && length < edges_maxedgelength);
+  while (edgept != start && length < max_edge_length);
 
   if ((chainsum != 4 && chainsum != -4)
   || edgept != start || length < MINEDGELENGTH) {
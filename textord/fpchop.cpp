@@ -28,6 +28,7 @@
 #include          "tovars.h"
 #include          "topitch.h"
 #include          "fpchop.h"
+#include          "textord.h"
 #include          "notdll.h"
 
 // Include automatically generated configuration file if running autoconf.
@@ -35,12 +36,6 @@
 #include "config_auto.h"
 #endif
 
-#define EXTERN
-
-EXTERN INT_VAR (textord_fp_chop_error, 2,
-"Max allowed bending of chop cells");
-EXTERN double_VAR (textord_fp_chop_snap, 0.5,
-"Max distance of chop pt from vertex");
 
 ELISTIZE(C_OUTLINE_FRAG)
 //#undef ASSERT_HOST
@@ -50,7 +45,8 @@ ELISTIZE(C_OUTLINE_FRAG)
  *
  * Make a ROW from a fixed pitch TO_ROW.
  **********************************************************************/
-ROW *fixed_pitch_words(                 //find lines
+namespace tesseract {
+ROW *Textord::fixed_pitch_words(                 //find lines
                        TO_ROW *row,     //row to do
                        FCOORD rotation  //for drawing
                       ) {
@@ -202,6 +198,7 @@ ROW *fixed_pitch_words(                 //find lines
   real_row->recalc_bounding_box ();
   return real_row;
 }
+}  // namespace tesseract.
 
 
 /**********************************************************************
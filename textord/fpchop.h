@@ -60,16 +60,6 @@ class C_OUTLINE_FRAG:public ELIST_LINK
 
 ELISTIZEH(C_OUTLINE_FRAG)
 
-extern
-INT_VAR_H (textord_fp_chop_error, 2,
-"Max allowed bending of chop cells");
-extern
-double_VAR_H (textord_fp_chop_snap, 0.5,
-"Max distance of chop pt from vertex");
-ROW *fixed_pitch_words(                 //find lines
-                       TO_ROW *row,     //row to do
-                       FCOORD rotation  //for drawing
-                      );
 WERD *add_repeated_word(                         //move repeated word
                         WERD_IT *rep_it,         //repeated words
                         inT16 &rep_left,         //left edge of word
@@ -1,14 +1,7 @@
 #include "mfcpch.h"
 #include          "statistc.h"
 #include          "gap_map.h"
-
-#define EXTERN
-EXTERN BOOL_VAR (gapmap_debug, FALSE, "Say which blocks have tables");
-EXTERN BOOL_VAR (gapmap_use_ends, FALSE,
-"Use large space at start and end of rows");
-EXTERN BOOL_VAR (gapmap_no_isolated_quanta, FALSE,
-"Ensure gaps not less than 2quanta wide");
-EXTERN double_VAR (gapmap_big_gaps, 1.75, "xht multiplier");
+#include          "textord.h"
 
 /*************************************************************************
  * A block gap map is a quantised histogram of whitespace regions in the
@@ -25,6 +18,7 @@ EXTERN double_VAR (gapmap_big_gaps, 1.75, "xht multiplier");
  *************************************************************************/
 
 GAPMAP::GAPMAP(                 //Constructor
+               const tesseract::Textord *textord,  //params
                TO_BLOCK *block  //block
               ) {
   TO_ROW_IT row_it;              //row iterator
@@ -81,10 +75,10 @@ GAPMAP::GAPMAP(                 //Constructor
       blob_it.mark_cycle_pt ();
       blob_box = box_next (&blob_it);
       prev_blob_box = blob_box;
-      if (gapmap_use_ends) {
+      if (textord->gapmap_use_ends) {
         /* Leading space */
         gap_width = blob_box.left () - min_left;
-        if ((gap_width > gapmap_big_gaps * row->xheight)
+        if ((gap_width > textord->gapmap_big_gaps * row->xheight)
         && gap_width > 2) {
           max_quantum = (blob_box.left () - min_left) / bucket_size;
           for (i = 0; i <= max_quantum; i++)
@@ -94,7 +88,7 @@ GAPMAP::GAPMAP(                 //Constructor
       while (!blob_it.cycled_list ()) {
         blob_box = box_next (&blob_it);
         gap_width = blob_box.left () - prev_blob_box.right ();
-        if ((gap_width > gapmap_big_gaps * row->xheight)
+        if ((gap_width > textord->gapmap_big_gaps * row->xheight)
         && gap_width > 2) {
           min_quantum =
             (prev_blob_box.right () - min_left) / bucket_size;
@@ -104,10 +98,10 @@ GAPMAP::GAPMAP(                 //Constructor
         }
         prev_blob_box = blob_box;
       }
-      if (gapmap_use_ends) {
+      if (textord->gapmap_use_ends) {
         /* Trailing space */
         gap_width = max_right - prev_blob_box.right ();
-        if ((gap_width > gapmap_big_gaps * row->xheight)
+        if ((gap_width > textord->gapmap_big_gaps * row->xheight)
         && gap_width > 2) {
           min_quantum =
             (prev_blob_box.right () - min_left) / bucket_size;
@@ -119,7 +113,7 @@ GAPMAP::GAPMAP(                 //Constructor
   }
   for (i = 0; i <= map_max; i++) {
     if (map[i] > total_rows / 2) {
-      if (gapmap_no_isolated_quanta &&
+      if (textord->gapmap_no_isolated_quanta &&
         (((i == 0) &&
         (map[i + 1] <= total_rows / 2)) ||
         ((i == map_max) &&
@@ -134,7 +128,7 @@ GAPMAP::GAPMAP(                 //Constructor
         any_tabs = TRUE;
     }
   }
-  if (gapmap_debug && any_tabs)
+  if (textord->gapmap_debug && any_tabs)
     tprintf ("Table found\n");
 }
 
@@ -4,10 +4,15 @@
 #include          "blobbox.h"
 #include          "notdll.h"
 
+namespace tesseract {
+class Textord;
+}  // namespace tesseract.
+
 class GAPMAP
 {
   public:
     GAPMAP(  //constructor
+           const tesseract::Textord *textord,  //params
            TO_BLOCK *block);
 
     ~GAPMAP () {                 //destructor
@@ -31,10 +36,4 @@ class GAPMAP
 
 /*-----------------------------*/
 
-extern BOOL_VAR_H (gapmap_debug, FALSE, "Say which blocks have tables");
-extern BOOL_VAR_H (gapmap_use_ends, FALSE,
-"Use large space at start and end of rows");
-extern BOOL_VAR_H (gapmap_no_isolated_quanta, FALSE,
-"Ensure gaps not less than 2quanta wide");
-extern double_VAR_H (gapmap_big_gaps, 1.75, "xht multiplier");
 #endif
@@ -168,6 +168,60 @@ void ImageFind::ConnCompAndRectangularize(Pix* pix, Boxa** boxa, Pixa** pixa) {
   }
 }
 
+// Returns the number of set bits in the word.
+static int CountBitsInWord(uinT32 word) {
+  word = word - ((word >> 1) & 0x55555555);
+  word = (word & 0x33333333) + ((word >> 2) & 0x33333333);
+  return (((word + (word >> 4)) & 0x0f0f0f0f) * 0x01010101) >> 24;
+}
+
+// Returns the number of black pixels in x=[x_start,x_end) of the given
+// raster line, counting a whole word at a time.
+static int CountPixelsInRowRange(const uinT32* line, int x_start, int x_end) {
+  if (x_start >= x_end)
+    return 0;
+  int first_word = x_start >> 5;
+  int last_word = (x_end - 1) >> 5;
+  // Pixels are stored most significant bit first.
+  uinT32 first_mask = 0xffffffff >> (x_start & 31);
+  uinT32 last_mask = 0xffffffff << (31 - ((x_end - 1) & 31));
+  if (first_word == last_word)
+    return CountBitsInWord(line[first_word] & first_mask & last_mask);
+  int count = CountBitsInWord(line[first_word] & first_mask);
+  for (int w = first_word + 1; w < last_word; ++w)
+    count += CountBitsInWord(line[w]);
+  return count + CountBitsInWord(line[last_word] & last_mask);
+}
+
+// Computes the number of black pixels in y=[y_start,y_end) of each of the 32
+// columns in the given word of each raster line, in counts, which is indexed
+// by x & 31. The rows are added into bit-sliced counters, so all 32 columns
+// are counted together, a word at a time.
+static void CountPixelsInWordColumns(const uinT32* data, int wpl, int word,
+                                     int y_start, int y_end, int* counts) {
+  // Bit b of slices[k] is bit k of the count for the column of bit b.
+  uinT32 slices[32];
+  int num_slices = 0;
+  const uinT32* line = data + y_start * wpl + word;
+  for (int y = y_start; y < y_end; ++y, line += wpl) {
+    uinT32 carry = *line;
+    for (int k = 0; carry != 0; ++k) {
+      if (k == num_slices)
+        slices[num_slices++] = 0;
+      uinT32 next_carry = slices[k] & carry;
+      slices[k] ^= carry;
+      carry = next_carry;
+    }
+  }
+  for (int i = 0; i < 32; ++i) {
+    int shift = 31 - i;
+    int count = 0;
+    for (int k = 0; k < num_slices; ++k)
+      count |= ((slices[k] >> shift) & 1) << k;
+    counts[i] = count;
+  }
+}
+
 // Scans horizontally on x=[x_start,x_end), starting with y=*y_start,
 // stepping y+=y_step, until y=y_end. *ystart is input/output.
 // If the number of black pixels in a row, pix_count fits this pattern:
@@ -180,13 +234,7 @@ static bool HScanForEdge(uinT32* data, int wpl, int x_start, int x_end,
                          int y_end, int y_step, int* y_start) {
   int mid_rows = 0;
   for (int y = *y_start; y != y_end; y += y_step) {
-    // Need pixCountPixelsInRow(pix, y, &pix_count, NULL) to count in a subset.
-    int pix_count = 0;
-    uinT32* line = data + wpl * y;
-    for (int x = x_start; x < x_end; ++x) {
-      if (GET_DATA_BIT(line, x))
-        ++pix_count;
-    }
+    int pix_count = CountPixelsInRowRange(data + wpl * y, x_start, x_end);
     if (mid_rows == 0 && pix_count < min_count)
       continue;      // In the min phase.
     if (mid_rows == 0)
@@ -211,13 +259,16 @@ static bool VScanForEdge(uinT32* data, int wpl, int y_start, int y_end,
                          int min_count, int mid_width, int max_count,
                          int x_end, int x_step, int* x_start) {
   int mid_cols = 0;
+  // Counts for all the columns of the current word, computed together.
+  int word_counts[32];
+  int counted_word = -1;
   for (int x = *x_start; x != x_end; x += x_step) {
-    int pix_count = 0;
-    uinT32* line = data + y_start * wpl;
-    for (int y = y_start; y < y_end; ++y, line += wpl) {
-      if (GET_DATA_BIT(line, x))
-        ++pix_count;
+    if ((x >> 5) != counted_word) {
+      counted_word = x >> 5;
+      CountPixelsInWordColumns(data, wpl, counted_word, y_start, y_end,
+                               word_counts);
     }
+    int pix_count = word_counts[x & 31];
     if (mid_cols == 0 && pix_count < min_count)
       continue;      // In the min phase.
     if (mid_cols == 0)
@@ -412,21 +463,64 @@ void ImageFind::ComputeRectangleColors(const TBOX& rect, Pix* pix, int factor,
                               width_pad, height_pad);
   Pix* scaled = pixClipRectangle(pix, scaled_box, NULL);
 
-  // Compute stats over the whole image.
+  // Compute stats over the whole image in a single pass, with histograms of
+  // each channel, and the sums and sums of products of all the channels, so
+  // the line fits below can be made whichever channel turns out to be x.
+  int histograms[kRGBRMSColors][256];
+  memset(histograms, 0, sizeof(histograms));
+  inT64 sums[kRGBRMSColors];
+  inT64 products[kRGBRMSColors][kRGBRMSColors];
+  memset(sums, 0, sizeof(sums));
+  memset(products, 0, sizeof(products));
+  const uinT32* data = pixGetData(scaled);
+  ASSERT_HOST(pixGetWpl(scaled) == width_pad);
+  for (int y = 0; y < height_pad; ++y, data += width_pad) {
+    // A row of products fits in 32 bits, which keeps the inner loop cheap
+    // enough for the compiler to vectorize.
+    uinT32 r_sum = 0, g_sum = 0, b_sum = 0;
+    uinT32 rr_sum = 0, gg_sum = 0, bb_sum = 0;
+    uinT32 rg_sum = 0, rb_sum = 0, gb_sum = 0;
+    for (int x = 0; x < width_pad; ++x) {
+      uinT32 pixel = data[x];
+      uinT32 r = (pixel >> L_RED_SHIFT) & 0xff;
+      uinT32 g = (pixel >> L_GREEN_SHIFT) & 0xff;
+      uinT32 b = (pixel >> L_BLUE_SHIFT) & 0xff;
+      r_sum += r;
+      g_sum += g;
+      b_sum += b;
+      rr_sum += r * r;
+      gg_sum += g * g;
+      bb_sum += b * b;
+      rg_sum += r * g;
+      rb_sum += r * b;
+      gb_sum += g * b;
+    }
+    for (int x = 0; x < width_pad; ++x) {
+      uinT32 pixel = data[x];
+      ++histograms[COLOR_RED][(pixel >> L_RED_SHIFT) & 0xff];
+      ++histograms[COLOR_GREEN][(pixel >> L_GREEN_SHIFT) & 0xff];
+      ++histograms[COLOR_BLUE][(pixel >> L_BLUE_SHIFT) & 0xff];
+    }
+    sums[COLOR_RED] += r_sum;
+    sums[COLOR_GREEN] += g_sum;
+    sums[COLOR_BLUE] += b_sum;
+    products[COLOR_RED][COLOR_RED] += rr_sum;
+    products[COLOR_GREEN][COLOR_GREEN] += gg_sum;
+    products[COLOR_BLUE][COLOR_BLUE] += bb_sum;
+    products[COLOR_RED][COLOR_GREEN] += rg_sum;
+    products[COLOR_RED][COLOR_BLUE] += rb_sum;
+    products[COLOR_GREEN][COLOR_BLUE] += gb_sum;
+  }
+  products[COLOR_GREEN][COLOR_RED] = products[COLOR_RED][COLOR_GREEN];
+  products[COLOR_BLUE][COLOR_RED] = products[COLOR_RED][COLOR_BLUE];
+  products[COLOR_BLUE][COLOR_GREEN] = products[COLOR_GREEN][COLOR_BLUE];
   STATS red_stats(0, 256);
   STATS green_stats(0, 256);
   STATS blue_stats(0, 256);
-  uinT32* data = pixGetData(scaled);
-  ASSERT_HOST(pixGetWpl(scaled) == width_pad);
-  for (int y = 0; y < height_pad; ++y) {
-    for (int x = 0; x < width_pad; ++x, ++data) {
-      int r = GET_DATA_BYTE(data, COLOR_RED);
-      int g = GET_DATA_BYTE(data, COLOR_GREEN);
-      int b = GET_DATA_BYTE(data, COLOR_BLUE);
-      red_stats.add(r, 1);
-      green_stats.add(g, 1);
-      blue_stats.add(b, 1);
-    }
+  for (int value = 0; value < 256; ++value) {
+    red_stats.add(value, histograms[COLOR_RED][value]);
+    green_stats.add(value, histograms[COLOR_GREEN][value]);
+    blue_stats.add(value, histograms[COLOR_BLUE][value]);
   }
   // Find the RGB component with the greatest 8th-ile-range.
   // 8th-iles are used instead of quartiles to get closer to the true
@@ -460,16 +554,13 @@ void ImageFind::ComputeRectangleColors(const TBOX& rect, Pix* pix, int factor,
   if (best_i8r >= kMinColorDifference) {
     LLSQ line1;
     LLSQ line2;
-    uinT32* data = pixGetData(scaled);
-    for (int im_y = 0; im_y < height_pad; ++im_y) {
-      for (int im_x = 0; im_x < width_pad; ++im_x, ++data) {
-        int x = GET_DATA_BYTE(data, x_color);
-        int y1 = GET_DATA_BYTE(data, y1_color);
-        int y2 = GET_DATA_BYTE(data, y2_color);
-        line1.add(x, y1);
-        line2.add(x, y2);
-      }
-    }
+    double count = static_cast<double>(width_pad) * height_pad;
+    line1.add_sums(count, sums[x_color], sums[y1_color],
+                   products[x_color][x_color], products[x_color][y1_color],
+                   products[y1_color][y1_color]);
+    line2.add_sums(count, sums[x_color], sums[y2_color],
+                   products[x_color][x_color], products[x_color][y2_color],
+                   products[y2_color][y2_color]);
     double m1 = line1.m();
     double c1 = line1.c(m1);
     double m2 = line2.m();
@@ -0,0 +1,379 @@
+///////////////////////////////////////////////////////////////////////
+// File:        layouttemplate.cpp
+// Description: Cache of page layouts for reuse on repeated forms.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+///////////////////////////////////////////////////////////////////////
+
+#include "layouttemplate.h"
+
+#include <stdlib.h>
+#include "helpers.h"
+#include "ocrblock.h"
+#include "polyblk.h"
+#include "tprintf.h"
+
+namespace tesseract {
+
+// Min number of lines on a page for its fingerprint to identify a form.
+const int kMinDistinctiveLines = 3;
+// Max distance in inches between the ends of matching lines.
+const double kLineMatchTolerance = 0.1;
+// Identifies a layout template file, and its byte order. Files of the
+// first version, "Ltm1", had no page segmentation mode and are not read.
+const inT32 kLayoutTemplateMagic = 0x4c746d32;  // "Ltm2"
+
+// A candidate pairing of a line of one fingerprint with a line of another,
+// ordered by distance, then by the line indices, so sorting is repeatable.
+struct LinePair {
+  LinePair() : dist(0), index(0), other_index(0) {}
+  LinePair(int d, int i, int j) : dist(d), index(i), other_index(j) {}
+  bool operator<(const LinePair& other) const {
+    if (dist != other.dist) return dist < other.dist;
+    if (index != other.index) return index < other.index;
+    return other_index < other.other_index;
+  }
+
+  int dist;
+  int index;
+  int other_index;
+};
+
+// Reads a single simple value, swapping it if needed.
+template <typename T>
+static bool ReadValue(bool swap, FILE* fp, T* value) {
+  if (fread(value, sizeof(*value), 1, fp) != 1) return false;
+  if (swap) ReverseN(value, sizeof(*value));
+  return true;
+}
+
+LayoutFingerprint::LayoutFingerprint()
+  : width_(0), height_(0), resolution_(0), pageseg_mode_(0) {
+}
+
+// Sets the fingerprint from the page size and resolution, the page
+// segmentation mode, and the vertical and horizontal line vectors found on
+// the page.
+void LayoutFingerprint::Set(int width, int height, int resolution,
+                            int pageseg_mode,
+                            TabVector_LIST* v_lines,
+                            TabVector_LIST* h_lines) {
+  width_ = width;
+  height_ = height;
+  resolution_ = resolution;
+  pageseg_mode_ = pageseg_mode;
+  lines_.truncate(0);
+  AddLines(v_lines);
+  AddLines(h_lines);
+}
+
+// Adds the lines from the given list to lines_.
+void LayoutFingerprint::AddLines(TabVector_LIST* lines) {
+  TabVector_IT it(lines);
+  for (it.mark_cycle_pt(); !it.cycled_list(); it.forward()) {
+    TabVector* line = it.data();
+    AddLine(line->startpt(), line->endpt());
+  }
+}
+
+// Adds a single line from start to end.
+void LayoutFingerprint::AddLine(const ICOORD& start, const ICOORD& end) {
+  lines_.push_back(start.x());
+  lines_.push_back(start.y());
+  lines_.push_back(end.x());
+  lines_.push_back(end.y());
+}
+
+// Returns true if there are enough lines to tell forms apart.
+bool LayoutFingerprint::IsDistinctive() const {
+  return lines_.size() >= kMinDistinctiveLines * 4;
+}
+
+// Returns true if other is the same form as this.
+bool LayoutFingerprint::Matches(const LayoutFingerprint& other,
+                                ICOORD* offset) const {
+  if (!IsDistinctive() || lines_.size() != other.lines_.size() ||
+      resolution_ != other.resolution_ ||
+      pageseg_mode_ != other.pageseg_mode_)
+    return false;
+  int tolerance = static_cast<int>(resolution_ * kLineMatchTolerance);
+  if (abs(width_ - other.width_) > tolerance ||
+      abs(height_ - other.height_) > tolerance)
+    return false;
+  int dx_sum = 0;
+  int dy_sum = 0;
+  if (!PairLines(other, tolerance, &dx_sum, &dy_sum))
+    return false;
+  // Each line contributes 2 end points to the sums.
+  int count = lines_.size() / 2;
+  offset->set_x(IntCastRounded(static_cast<double>(dx_sum) / count));
+  offset->set_y(IntCastRounded(static_cast<double>(dy_sum) / count));
+  return true;
+}
+
+// Returns the sum of the end point distances between line i of this and
+// line j of other, or -1 if any of them is more than tolerance.
+int LayoutFingerprint::LineDistance(int i, const LayoutFingerprint& other,
+                                    int j, int tolerance) const {
+  int dist = 0;
+  for (int k = 0; k < 4; ++k) {
+    int diff = abs(other.lines_[j * 4 + k] - lines_[i * 4 + k]);
+    if (diff > tolerance)
+      return -1;
+    dist += diff;
+  }
+  return dist;
+}
+
+// Returns true if every line in this can be paired with a different line
+// in other. Adds the end point differences of the pairs to the sums.
+// The candidate pairs are taken closest first, so a line is only denied its
+// nearest partner by a line that is even closer to it. That may fail to pair
+// lines that are closer together than the tolerance, where some other
+// assignment would have succeeded, but those pages are rejected, never
+// matched wrongly.
+bool LayoutFingerprint::PairLines(const LayoutFingerprint& other,
+                                  int tolerance,
+                                  int* dx_sum, int* dy_sum) const {
+  int num_lines = lines_.size() / 4;
+  int num_other_lines = other.lines_.size() / 4;
+  GenericVector<LinePair> pairs;
+  for (int i = 0; i < num_lines; ++i) {
+    for (int j = 0; j < num_other_lines; ++j) {
+      int dist = LineDistance(i, other, j, tolerance);
+      if (dist >= 0)
+        pairs.push_back(LinePair(dist, i, j));
+    }
+  }
+  pairs.sort();
+  GenericVector<bool> used;
+  used.init_to_size(num_lines, false);
+  GenericVector<bool> other_used;
+  other_used.init_to_size(num_other_lines, false);
+  int num_paired = 0;
+  for (int p = 0; p < pairs.size() && num_paired < num_lines; ++p) {
+    int i = pairs[p].index;
+    int j = pairs[p].other_index;
+    if (used[i] || other_used[j])
+      continue;
+    used[i] = true;
+    other_used[j] = true;
+    ++num_paired;
+    *dx_sum += other.lines_[j * 4] - lines_[i * 4];
+    *dx_sum += other.lines_[j * 4 + 2] - lines_[i * 4 + 2];
+    *dy_sum += other.lines_[j * 4 + 1] - lines_[i * 4 + 1];
+    *dy_sum += other.lines_[j * 4 + 3] - lines_[i * 4 + 3];
+  }
+  return num_paired == num_lines;
+}
+
+// Writes to the given file. Returns false in case of error.
+bool LayoutFingerprint::Serialize(FILE* fp) const {
+  if (fwrite(&width_, sizeof(width_), 1, fp) != 1) return false;
+  if (fwrite(&height_, sizeof(height_), 1, fp) != 1) return false;
+  if (fwrite(&resolution_, sizeof(resolution_), 1, fp) != 1) return false;
+  if (fwrite(&pageseg_mode_, sizeof(pageseg_mode_), 1, fp) != 1) return false;
+  return lines_.Serialize(fp);
+}
+
+// Reads from the given file. Returns false in case of error.
+// If swap is true, assumes a big/little-endian swap is needed.
+bool LayoutFingerprint::DeSerialize(bool swap, FILE* fp) {
+  if (!ReadValue(swap, fp, &width_)) return false;
+  if (!ReadValue(swap, fp, &height_)) return false;
+  if (!ReadValue(swap, fp, &resolution_)) return false;
+  if (!ReadValue(swap, fp, &pageseg_mode_)) return false;
+  return lines_.DeSerialize(swap, fp);
+}
+
+// Writes to the given file. Returns false in case of error.
+bool LayoutTemplateBlock::Serialize(FILE* fp) const {
+  inT32 values[8] = {type, right_to_left, median_width, median_height,
+                     left, bottom, right, top};
+  if (fwrite(values, sizeof(values[0]), 8, fp) != 8) return false;
+  if (fwrite(&skew_x, sizeof(skew_x), 1, fp) != 1) return false;
+  if (fwrite(&skew_y, sizeof(skew_y), 1, fp) != 1) return false;
+  return vertices.Serialize(fp);
+}
+
+// Reads from the given file. Returns false in case of error.
+// If swap is true, assumes a big/little-endian swap is needed.
+bool LayoutTemplateBlock::DeSerialize(bool swap, FILE* fp) {
+  inT32* values[8] = {&type, &right_to_left, &median_width, &median_height,
+                      &left, &bottom, &right, &top};
+  for (int i = 0; i < 8; ++i) {
+    if (!ReadValue(swap, fp, values[i])) return false;
+  }
+  if (!ReadValue(swap, fp, &skew_x)) return false;
+  if (!ReadValue(swap, fp, &skew_y)) return false;
+  return vertices.DeSerialize(swap, fp);
+}
+
+LayoutTemplate::LayoutTemplate()
+  : deskew_x_(1.0f), deskew_y_(0.0f), reskew_x_(1.0f), reskew_y_(0.0f) {
+}
+
+// Records the geometry of the given blocks, which were made for a page
+// with the given fingerprint and skew vectors. Returns false if the layout
+// can't be stored because some of the blocks are rotated.
+bool LayoutTemplate::Set(const LayoutFingerprint& fingerprint,
+                         BLOCK_LIST* blocks,
+                         const FCOORD& deskew, const FCOORD& reskew) {
+  fingerprint_ = fingerprint;
+  deskew_x_ = deskew.x();
+  deskew_y_ = deskew.y();
+  reskew_x_ = reskew.x();
+  reskew_y_ = reskew.y();
+  blocks_.truncate(0);
+  BLOCK_IT b_it(blocks);
+  for (b_it.mark_cycle_pt(); !b_it.cycled_list(); b_it.forward()) {
+    BLOCK* block = b_it.data();
+    if (block->re_rotation().x() != 1.0f || block->re_rotation().y() != 0.0f ||
+        block->classify_rotation().x() != 1.0f ||
+        block->classify_rotation().y() != 0.0f)
+      return false;
+    LayoutTemplateBlock layout_block;
+    POLY_BLOCK* poly = block->poly_block();
+    layout_block.type = poly != NULL ? poly->isA() : PT_FLOWING_TEXT;
+    layout_block.right_to_left = block->right_to_left();
+    layout_block.skew_x = block->skew().x();
+    layout_block.skew_y = block->skew().y();
+    layout_block.median_width = block->median_size().x();
+    layout_block.median_height = block->median_size().y();
+    const TBOX& box = block->bounding_box();
+    layout_block.left = box.left();
+    layout_block.bottom = box.bottom();
+    layout_block.right = box.right();
+    layout_block.top = box.top();
+    if (poly != NULL) {
+      ICOORDELT_IT v_it(poly->points());
+      for (v_it.mark_cycle_pt(); !v_it.cycled_list(); v_it.forward()) {
+        layout_block.vertices.push_back(v_it.data()->x());
+        layout_block.vertices.push_back(v_it.data()->y());
+      }
+    }
+    blocks_.push_back(layout_block);
+  }
+  return true;
+}
+
+// Makes new blocks from the stored geometry, shifted by offset, and adds
+// them to the end of blocks.
+void LayoutTemplate::MakeBlocks(const ICOORD& offset,
+                                BLOCK_LIST* blocks) const {
+  BLOCK_IT b_it(blocks);
+  b_it.move_to_last();
+  for (int b = 0; b < blocks_.size(); ++b) {
+    const LayoutTemplateBlock& layout_block = blocks_[b];
+    BLOCK* block = new BLOCK("", true, 0, 0,
+                             layout_block.left + offset.x(),
+                             layout_block.bottom + offset.y(),
+                             layout_block.right + offset.x(),
+                             layout_block.top + offset.y());
+    PolyBlockType type = static_cast<PolyBlockType>(layout_block.type);
+    if (layout_block.vertices.empty()) {
+      block->set_poly_block(new POLY_BLOCK(block->bounding_box(), type));
+    } else {
+      ICOORDELT_LIST vertices;
+      ICOORDELT_IT v_it(&vertices);
+      for (int v = 0; v + 1 < layout_block.vertices.size(); v += 2) {
+        ICOORD pt(layout_block.vertices[v] + offset.x(),
+                  layout_block.vertices[v + 1] + offset.y());
+        v_it.add_after_then_move(new ICOORDELT(pt));
+      }
+      block->set_poly_block(new POLY_BLOCK(&vertices, type));
+    }
+    block->set_right_to_left(layout_block.right_to_left != 0);
+    block->set_skew(FCOORD(layout_block.skew_x, layout_block.skew_y));
+    block->set_median_size(layout_block.median_width,
+                           layout_block.median_height);
+    block->set_index(b + 1);
+    b_it.add_after_then_move(block);
+  }
+}
+
+// Writes to the given file. Returns false in case of error.
+bool LayoutTemplate::Serialize(FILE* fp) const {
+  if (!fingerprint_.Serialize(fp)) return false;
+  float skews[4] = {deskew_x_, deskew_y_, reskew_x_, reskew_y_};
+  if (fwrite(skews, sizeof(skews[0]), 4, fp) != 4) return false;
+  return blocks_.SerializeClasses(fp);
+}
+
+// Reads from the given file. Returns false in case of error.
+// If swap is true, assumes a big/little-endian swap is needed.
+bool LayoutTemplate::DeSerialize(bool swap, FILE* fp) {
+  if (!fingerprint_.DeSerialize(swap, fp)) return false;
+  if (!ReadValue(swap, fp, &deskew_x_)) return false;
+  if (!ReadValue(swap, fp, &deskew_y_)) return false;
+  if (!ReadValue(swap, fp, &reskew_x_)) return false;
+  if (!ReadValue(swap, fp, &reskew_y_)) return false;
+  return blocks_.DeSerializeClasses(swap, fp);
+}
+
+LayoutTemplateCache::LayoutTemplateCache() {
+}
+
+// Reads the templates from the given file, replacing any already present.
+// Returns false in case of error.
+bool LayoutTemplateCache::Load(const char* filename) {
+  templates_.clear();
+  FILE* fp = fopen(filename, "rb");
+  if (fp == NULL)
+    return false;
+  inT32 magic;
+  bool success = fread(&magic, sizeof(magic), 1, fp) == 1;
+  bool swap = false;
+  if (success && magic != kLayoutTemplateMagic) {
+    Reverse32(&magic);
+    swap = true;
+    success = magic == kLayoutTemplateMagic;
+  }
+  if (success)
+    success = templates_.DeSerialize(swap, fp);
+  fclose(fp);
+  if (!success) {
+    tprintf("Layout template file %s is invalid\n", filename);
+    templates_.clear();
+  }
+  return success;
+}
+
+// Writes all the templates to the given file. Returns false in case of
+// error.
+bool LayoutTemplateCache::Save(const char* filename) const {
+  FILE* fp = fopen(filename, "wb");
+  if (fp == NULL) {
+    tprintf("Can't write layout templates to %s\n", filename);
+    return false;
+  }
+  bool success =
+      fwrite(&kLayoutTemplateMagic, sizeof(kLayoutTemplateMagic), 1, fp) == 1 &&
+      templates_.Serialize(fp);
+  if (fclose(fp) != 0)
+    success = false;
+  return success;
+}
+
+// Returns the first template that matches the given fingerprint, with
+// offset set to the shift of the page relative to the template, or NULL
+// if there is none.
+const LayoutTemplate* LayoutTemplateCache::FindMatch(
+    const LayoutFingerprint& fingerprint, ICOORD* offset) const {
+  for (int t = 0; t < templates_.size(); ++t) {
+    if (templates_[t]->fingerprint().Matches(fingerprint, offset))
+      return templates_[t];
+  }
+  return NULL;
+}
+
+}  // namespace tesseract.
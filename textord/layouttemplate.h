@@ -0,0 +1,180 @@
+///////////////////////////////////////////////////////////////////////
+// File:        layouttemplate.h
+// Description: Cache of page layouts for reuse on repeated forms.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+///////////////////////////////////////////////////////////////////////
+
+#ifndef TESSERACT_TEXTORD_LAYOUTTEMPLATE_H_
+#define TESSERACT_TEXTORD_LAYOUTTEMPLATE_H_
+
+#include <stdio.h>
+#include "genericvector.h"
+#include "host.h"
+#include "points.h"
+#include "tabvector.h"
+
+class BLOCK_LIST;
+
+namespace tesseract {
+
+// Coarse fingerprint of a page, being its size and the ruled lines found on
+// it by LineFinder. Pages of the same printed form have the same lines in
+// nearly the same places, whatever is filled in on them, so the fingerprint
+// identifies the form.
+class LayoutFingerprint {
+ public:
+  LayoutFingerprint();
+
+  // Sets the fingerprint from the page size and resolution, the page
+  // segmentation mode that layout analysis ran with, and the vertical and
+  // horizontal line vectors found on the page. The mode is part of the key,
+  // as the same form laid out in another mode gets different blocks.
+  void Set(int width, int height, int resolution, int pageseg_mode,
+           TabVector_LIST* v_lines, TabVector_LIST* h_lines);
+  // Adds a single line from start to end.
+  void AddLine(const ICOORD& start, const ICOORD& end);
+
+  // Returns true if there are enough lines to tell forms apart. Pages
+  // without lines all look alike, so they must never match.
+  bool IsDistinctive() const;
+
+  // Returns true if other is the same form as this. Both must have the same
+  // page segmentation mode, and the lines must pair up one-to-one, each with
+  // both ends within a tolerance that allows for the small shifts of
+  // scanning. On success, offset is set to the mean shift of other relative
+  // to this.
+  bool Matches(const LayoutFingerprint& other, ICOORD* offset) const;
+
+  // Writes to the given file. Returns false in case of error.
+  bool Serialize(FILE* fp) const;
+  // Reads from the given file. Returns false in case of error.
+  // If swap is true, assumes a big/little-endian swap is needed.
+  bool DeSerialize(bool swap, FILE* fp);
+
+ private:
+  // Adds the lines from the given list to lines_.
+  void AddLines(TabVector_LIST* lines);
+  // Returns the sum of the end point distances between line i of this and
+  // line j of other, or -1 if any of them is more than tolerance.
+  int LineDistance(int i, const LayoutFingerprint& other, int j,
+                   int tolerance) const;
+  // Returns true if every line in this can be paired with a different line
+  // in other. Adds the end point differences of the pairs to the sums.
+  bool PairLines(const LayoutFingerprint& other, int tolerance,
+                 int* dx_sum, int* dy_sum) const;
+
+  inT32 width_;
+  inT32 height_;
+  inT32 resolution_;
+  inT32 pageseg_mode_;
+  // Each line as a start x, y and end x, y in sequence.
+  GenericVector<inT32> lines_;
+};
+
+// Geometry of a single block of a LayoutTemplate.
+struct LayoutTemplateBlock {
+  LayoutTemplateBlock()
+    : type(0), right_to_left(0), skew_x(1.0f), skew_y(0.0f),
+      median_width(0), median_height(0) {}
+
+  // Writes to the given file. Returns false in case of error.
+  bool Serialize(FILE* fp) const;
+  // Reads from the given file. Returns false in case of error.
+  // If swap is true, assumes a big/little-endian swap is needed.
+  bool DeSerialize(bool swap, FILE* fp);
+
+  inT32 type;  // PolyBlockType.
+  inT32 right_to_left;
+  float skew_x;
+  float skew_y;
+  inT32 median_width;
+  inT32 median_height;
+  inT32 left, bottom, right, top;
+  // Polygon as x, y pairs. Empty if the block had no polygon.
+  GenericVector<inT32> vertices;
+};
+
+// The layout of a page, as the geometry of the blocks made by layout
+// analysis, stored with the fingerprint of the page so it can be reused
+// on other pages of the same form.
+class LayoutTemplate {
+ public:
+  LayoutTemplate();
+
+  // Records the geometry of the given blocks, which were made for a page
+  // with the given fingerprint and skew vectors. Returns false if the layout
+  // can't be stored because some of the blocks are rotated, as the blobs of
+  // rotated blocks can't be found from the block polygon alone.
+  bool Set(const LayoutFingerprint& fingerprint, BLOCK_LIST* blocks,
+           const FCOORD& deskew, const FCOORD& reskew);
+
+  // Makes new blocks from the stored geometry, shifted by offset, and adds
+  // them to the end of blocks.
+  void MakeBlocks(const ICOORD& offset, BLOCK_LIST* blocks) const;
+
+  const LayoutFingerprint& fingerprint() const {
+    return fingerprint_;
+  }
+  FCOORD deskew() const {
+    return FCOORD(deskew_x_, deskew_y_);
+  }
+  FCOORD reskew() const {
+    return FCOORD(reskew_x_, reskew_y_);
+  }
+
+  // Writes to the given file. Returns false in case of error.
+  bool Serialize(FILE* fp) const;
+  // Reads from the given file. Returns false in case of error.
+  // If swap is true, assumes a big/little-endian swap is needed.
+  bool DeSerialize(bool swap, FILE* fp);
+
+ private:
+  LayoutFingerprint fingerprint_;
+  float deskew_x_, deskew_y_;
+  float reskew_x_, reskew_y_;
+  GenericVector<LayoutTemplateBlock> blocks_;
+};
+
+// A set of LayoutTemplates, with file storage and lookup by fingerprint.
+class LayoutTemplateCache {
+ public:
+  LayoutTemplateCache();
+
+  int size() const {
+    return templates_.size();
+  }
+
+  // Reads the templates from the given file, replacing any already present.
+  // Returns false in case of error.
+  bool Load(const char* filename);
+  // Writes all the templates to the given file. Returns false in case of
+  // error.
+  bool Save(const char* filename) const;
+
+  // Returns the first template that matches the given fingerprint, with
+  // offset set to the shift of the page relative to the template, or NULL
+  // if there is none.
+  const LayoutTemplate* FindMatch(const LayoutFingerprint& fingerprint,
+                                  ICOORD* offset) const;
+  // Adds a template, taking ownership of it.
+  void Add(LayoutTemplate* layout) {
+    templates_.push_back(layout);
+  }
+
+ private:
+  PointerVector<LayoutTemplate> templates_;
+};
+
+}  // namespace tesseract.
+
+#endif  // TESSERACT_TEXTORD_LAYOUTTEMPLATE_H_
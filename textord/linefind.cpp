@@ -240,7 +240,8 @@ static int FilterFalsePositives(int resolution, Pix* nonline_pix,
 // The output vectors are owned by the list and Frozen (cannot refit) by
 // having no boxes, as there is no need to refit or merge separator lines.
 // The detected lines are removed from the pix.
-void LineFinder::FindAndRemoveLines(int resolution, bool debug, Pix* pix,
+void LineFinder::FindAndRemoveLines(const Textord* textord,
+                                    int resolution, bool debug, Pix* pix,
                                     int* vertical_x, int* vertical_y,
                                     Pix** pix_music_mask,
                                     TabVector_LIST* v_lines,
@@ -259,7 +260,8 @@ void LineFinder::FindAndRemoveLines(int resolution, bool debug, Pix* pix,
                &pix_non_hline, &pix_intersections, pix_music_mask,
                pixa_display);
   // Find lines, convert to TabVector_LIST and remove those that are used.
-  FindAndRemoveVLines(resolution, pix_intersections, vertical_x, vertical_y,
+  FindAndRemoveVLines(textord, resolution, pix_intersections,
+                      vertical_x, vertical_y,
                       &pix_vline, pix_non_vline, pix, v_lines);
   if (pix_hline != NULL) {
     // Recompute intersections and re-filter false positive h-lines.
@@ -272,7 +274,8 @@ void LineFinder::FindAndRemoveLines(int resolution, bool debug, Pix* pix,
       pixDestroy(&pix_hline);
     }
   }
-  FindAndRemoveHLines(resolution, pix_intersections, *vertical_x, *vertical_y,
+  FindAndRemoveHLines(textord, resolution, pix_intersections,
+                      *vertical_x, *vertical_y,
                       &pix_hline, pix_non_hline, pix, h_lines);
   if (pixa_display != NULL && pix_vline != NULL)
     pixaAddPix(pixa_display, pix_vline, L_CLONE);
@@ -318,7 +321,8 @@ void LineFinder::FindAndRemoveLines(int resolution, bool debug, Pix* pix,
 // The output is a list of C_BLOBs that are owned by the list.
 // The C_OUTLINEs in the C_BLOBs contain no outline data - just empty
 // bounding boxes. The Boxa is consumed and destroyed.
-void LineFinder::ConvertBoxaToBlobs(int image_width, int image_height,
+void LineFinder::ConvertBoxaToBlobs(const Textord* textord,
+                                    int image_width, int image_height,
                                     Boxa** boxes, C_BLOB_LIST* blobs) {
   C_OUTLINE_LIST outlines;
   C_OUTLINE_IT ol_it = &outlines;
@@ -343,7 +347,7 @@ void LineFinder::ConvertBoxaToBlobs(int image_width, int image_height,
   BLOCK block;
   ICOORD page_tl(0, 0);
   ICOORD page_br(image_width, image_height);
-  outlines_to_blobs(&block, page_tl, page_br, &outlines);
+  outlines_to_blobs(textord, &block, page_tl, page_br, &outlines);
   // Transfer the created blobs to the output list.
   C_BLOB_IT blob_it(blobs);
   blob_it.add_list_after(block.blob_list());
@@ -361,7 +365,8 @@ void LineFinder::ConvertBoxaToBlobs(int image_width, int image_height,
 // If no good lines are found, pix_vline is destroyed.
 // None of the input pointers may be NULL, and if *pix_vline is NULL then
 // the function does nothing.
-void LineFinder::FindAndRemoveVLines(int resolution,
+void LineFinder::FindAndRemoveVLines(const Textord* textord,
+                                     int resolution,
                                      Pix* pix_intersections,
                                      int* vertical_x, int* vertical_y,
                                      Pix** pix_vline, Pix* pix_non_vline,
@@ -369,7 +374,7 @@ void LineFinder::FindAndRemoveVLines(int resolution,
   if (pix_vline == NULL || *pix_vline == NULL) return;
   C_BLOB_LIST line_cblobs;
   BLOBNBOX_LIST line_bblobs;
-  GetLineBoxes(false, *pix_vline, pix_intersections,
+  GetLineBoxes(textord, false, *pix_vline, pix_intersections,
                &line_cblobs, &line_bblobs);
   int width = pixGetWidth(src_pix);
   int height = pixGetHeight(src_pix);
@@ -397,7 +402,8 @@ void LineFinder::FindAndRemoveVLines(int resolution,
 // If no good lines are found, pix_hline is destroyed.
 // None of the input pointers may be NULL, and if *pix_hline is NULL then
 // the function does nothing.
-void LineFinder::FindAndRemoveHLines(int resolution,
+void LineFinder::FindAndRemoveHLines(const Textord* textord,
+                                     int resolution,
                                      Pix* pix_intersections,
                                      int vertical_x, int vertical_y,
                                      Pix** pix_hline, Pix* pix_non_hline,
@@ -405,7 +411,8 @@ void LineFinder::FindAndRemoveHLines(int resolution,
   if (pix_hline == NULL || *pix_hline == NULL) return;
   C_BLOB_LIST line_cblobs;
   BLOBNBOX_LIST line_bblobs;
-  GetLineBoxes(true, *pix_hline, pix_intersections, &line_cblobs, &line_bblobs);
+  GetLineBoxes(textord, true, *pix_hline, pix_intersections,
+               &line_cblobs, &line_bblobs);
   int width = pixGetWidth(src_pix);
   int height = pixGetHeight(src_pix);
   ICOORD bleft(0, 0);
@@ -557,6 +564,203 @@ static Pix* FilterMusic(int resolution, Pix* pix_closed,
   return music_mask;
 }
 
+// Returns the first x >= start on the given raster line of a binary image at
+// which the pixel is on (if on is true) or off, or width if there is none.
+// Whole words of the wrong value are skipped at once.
+static int NextPixel(const l_uint32* line, int start, int width, bool on) {
+  l_uint32 skip_word = on ? 0 : 0xffffffff;
+  int x = start;
+  while (x < width) {
+    if ((x & 31) == 0 && x + 32 <= width && line[x >> 5] == skip_word) {
+      x += 32;
+    } else if ((GET_DATA_BIT(line, x) != 0) == on) {
+      return x;
+    } else {
+      ++x;
+    }
+  }
+  return width;
+}
+
+// Returns the bounding box of all the horizontal runs in pix of at least
+// min_length ON pixels, or NULL if there are none. Erosion may treat
+// off-image pixels as ON, so runs that touch the edge of the image count as
+// up to half of min_length longer.
+static Box* HorizontalRunBounds(Pix* pix, int min_length) {
+  int width = pixGetWidth(pix);
+  int height = pixGetHeight(pix);
+  int wpl = pixGetWpl(pix);
+  l_uint32* line = pixGetData(pix);
+  int edge_allowance = min_length / 2 + 1;
+  int min_x = width, max_x = -1, min_y = height, max_y = -1;
+  for (int y = 0; y < height; ++y, line += wpl) {
+    int x = 0;
+    while (x < width) {
+      int start = NextPixel(line, x, width, true);
+      if (start >= width) break;
+      int end = NextPixel(line, start, width, false);
+      int length = end - start;
+      if (start == 0) length += edge_allowance;
+      if (end == width) length += edge_allowance;
+      if (length >= min_length) {
+        if (start < min_x) min_x = start;
+        if (end - 1 > max_x) max_x = end - 1;
+        if (y < min_y) min_y = y;
+        max_y = y;
+      }
+      x = end;
+    }
+  }
+  if (max_x < 0)
+    return NULL;
+  return boxCreate(min_x, min_y, max_x - min_x + 1, max_y - min_y + 1);
+}
+
+// Returns the bounding box of all the vertical runs in pix of at least
+// min_length ON pixels, or NULL if there are none. As with
+// HorizontalRunBounds, runs that touch the edge of the image count as longer.
+// The runs are found by ANDing rows together at doubling spacings, so the
+// cost is only log(min_length) passes over the image words.
+static Box* VerticalRunBounds(Pix* pix, int min_length) {
+  int width = pixGetWidth(pix);
+  int height = pixGetHeight(pix);
+  int wpl = pixGetWpl(pix);
+  int edge_allowance = min_length / 2 + 1;
+  // Copy the image between bands of ON rows that stand in for the edges.
+  int rows = height + 2 * edge_allowance;
+  if (rows < min_length)
+    return NULL;
+  l_uint32* buffer = new l_uint32[rows * wpl];
+  memset(buffer, 0xff, edge_allowance * wpl * sizeof(*buffer));
+  memcpy(buffer + edge_allowance * wpl, pixGetData(pix),
+         height * wpl * sizeof(*buffer));
+  memset(buffer + (edge_allowance + height) * wpl, 0xff,
+         edge_allowance * wpl * sizeof(*buffer));
+  // Each row in turn becomes the AND of the window of rows below it.
+  int window = 1;
+  int valid_rows = rows;
+  while (window < min_length) {
+    int step = MIN(window, min_length - window);
+    valid_rows -= step;
+    for (int r = 0; r < valid_rows; ++r) {
+      l_uint32* row = buffer + r * wpl;
+      const l_uint32* other_row = row + step * wpl;
+      for (int w = 0; w < wpl; ++w)
+        row[w] &= other_row[w];
+    }
+    window += step;
+  }
+  // Find the extent of the surviving pixels.
+  l_uint32 last_word_mask = (width & 31) == 0 ? 0xffffffff
+                                              : ~(0xffffffff >> (width & 31));
+  l_uint32* columns = new l_uint32[wpl];
+  memset(columns, 0, wpl * sizeof(*columns));
+  int min_r = valid_rows, max_r = -1;
+  for (int r = 0; r < valid_rows; ++r) {
+    l_uint32* row = buffer + r * wpl;
+    row[wpl - 1] &= last_word_mask;
+    l_uint32 any_set = 0;
+    for (int w = 0; w < wpl; ++w) {
+      columns[w] |= row[w];
+      any_set |= row[w];
+    }
+    if (any_set != 0) {
+      if (r < min_r) min_r = r;
+      max_r = r;
+    }
+  }
+  delete [] buffer;
+  Box* result = NULL;
+  if (max_r >= 0) {
+    int min_x = NextPixel(columns, 0, width, true);
+    int max_x = min_x;
+    for (int x = min_x; x < width; x = NextPixel(columns, x + 1, width, true))
+      max_x = x;
+    int min_y = MAX(min_r - edge_allowance, 0);
+    int max_y = MIN(max_r + min_length - 1 - edge_allowance, height - 1);
+    result = boxCreate(min_x, min_y, max_x - min_x + 1, max_y - min_y + 1);
+  }
+  delete [] columns;
+  return result;
+}
+
+// Returns a page-sized copy of the given pix of a region of the page, after
+// removing the given borders from it. The region pix is consumed. The region
+// (without borders) is placed at (x, y) on the page.
+static Pix* RegionToPage(Pix** pix_region, int left_border, int right_border,
+                         int top_border, int bottom_border, int x, int y,
+                         int page_width, int page_height) {
+  Pix* pix_clip = pixRemoveBorderGeneral(*pix_region, left_border,
+                                         right_border, top_border,
+                                         bottom_border);
+  pixDestroy(pix_region);
+  Pix* pix_page = pixCreate(page_width, page_height, 1);
+  pixRasterop(pix_page, x, y, pixGetWidth(pix_clip), pixGetHeight(pix_clip),
+              PIX_SRC, pix_clip, 0, 0);
+  pixDestroy(&pix_clip);
+  return pix_page;
+}
+
+// Computes pix_vline (if find_v) and pix_hline (if find_h) from pix_closed
+// as GetLineMasks always did, but with the morphology restricted to the
+// given box of line candidates, plus enough margin to make the result
+// exactly the same as for the whole page. The candidates box holds
+// Leptonica coords, with y increasing down the page, and exclusive
+// right/top edges.
+static void OpenLinesInRegion(Pix* pix_closed, const TBOX& candidates,
+                              int max_line_width, int min_line_length,
+                              bool find_v, bool find_h,
+                              Pix** pix_vline, Pix** pix_hline,
+                              Pixa* pixa_display) {
+  int width = pixGetWidth(pix_closed);
+  int height = pixGetHeight(pix_closed);
+  // The solid area opening depends on pixels up to max_line_width away.
+  int margin = max_line_width + 1;
+  int left = MAX(candidates.left() - margin, 0);
+  int top = MAX(candidates.bottom() - margin, 0);
+  int right = MIN(candidates.right() - 1 + margin, width - 1);
+  int bottom = MIN(candidates.top() - 1 + margin, height - 1);
+  Box* clip_box = boxCreate(left, top, right - left + 1, bottom - top + 1);
+  Pix* pix_clip = pixClipRectangle(pix_closed, clip_box, NULL);
+  boxDestroy(&clip_box);
+  // Where the clip cuts through the page, the pixels beyond must be OFF, or
+  // the openings could extend partial lines into it. At the real edges of the
+  // page, the morphology behaves as it would on the whole page.
+  int left_border = left > 0 ? min_line_length : 0;
+  int right_border = right < width - 1 ? min_line_length : 0;
+  int top_border = top > 0 ? min_line_length : 0;
+  int bottom_border = bottom < height - 1 ? min_line_length : 0;
+  Pix* pix_region = pixAddBorderGeneral(pix_clip, left_border, right_border,
+                                        top_border, bottom_border, 0);
+  pixDestroy(&pix_clip);
+  // Open up with a big box to detect solid areas, which can then be subtracted.
+  // This is very generous and will leave in even quite wide lines.
+  Pix* pix_solid = pixOpenBrick(NULL, pix_region, max_line_width,
+                                max_line_width);
+  if (pixa_display != NULL)
+    pixaAddPix(pixa_display, pix_solid, L_CLONE);
+  Pix* pix_hollow = pixSubtract(NULL, pix_region, pix_solid);
+  pixDestroy(&pix_solid);
+  pixDestroy(&pix_region);
+  // Now open up in both directions independently to find lines of at least
+  // 1 inch/kMinLineLengthFraction in length.
+  if (pixa_display != NULL)
+    pixaAddPix(pixa_display, pix_hollow, L_CLONE);
+  if (find_v) {
+    Pix* pix_lines = pixOpenBrick(NULL, pix_hollow, 1, min_line_length);
+    *pix_vline = RegionToPage(&pix_lines, left_border, right_border,
+                              top_border, bottom_border, left, top,
+                              width, height);
+  }
+  if (find_h) {
+    Pix* pix_lines = pixOpenBrick(NULL, pix_hollow, min_line_length, 1);
+    *pix_hline = RegionToPage(&pix_lines, left_border, right_border,
+                              top_border, bottom_border, left, top,
+                              width, height);
+  }
+  pixDestroy(&pix_hollow);
+}
+
 // Most of the heavy lifting of line finding. Given src_pix and its separate
 // resolution, returns image masks:
 // pix_vline           candidate vertical lines.
@@ -588,26 +792,36 @@ void LineFinder::GetLineMasks(int resolution, Pix* src_pix,
   Pix* pix_closed = pixCloseBrick(NULL, src_pix, closing_brick, closing_brick);
   if (pixa_display != NULL)
     pixaAddPix(pixa_display, pix_closed, L_CLONE);
-  // Open up with a big box to detect solid areas, which can then be subtracted.
-  // This is very generous and will leave in even quite wide lines.
-  Pix* pix_solid = pixOpenBrick(NULL, pix_closed, max_line_width,
-                                max_line_width);
-  if (pixa_display != NULL)
-    pixaAddPix(pixa_display, pix_solid, L_CLONE);
-  Pix* pix_hollow = pixSubtract(NULL, pix_closed, pix_solid);
-  pixDestroy(&pix_solid);
-  // Now open up in both directions independently to find lines of at least
-  // 1 inch/kMinLineLengthFraction in length.
-  if (pixa_display != NULL)
-    pixaAddPix(pixa_display, pix_hollow, L_CLONE);
-  *pix_vline = pixOpenBrick(NULL, pix_hollow, 1, min_line_length);
-  *pix_hline = pixOpenBrick(NULL, pix_hollow, min_line_length, 1);
-  pixDestroy(&pix_hollow);
+  // Lines can only come from long runs in pix_closed, which are cheap to
+  // find, so most pages without lines skip all the expensive morphology, and
+  // the rest only do it over the region that contains the candidates.
+  Box* v_candidates = VerticalRunBounds(pix_closed, min_line_length);
+  Box* h_candidates = HorizontalRunBounds(pix_closed, min_line_length);
+  l_int32 v_empty = v_candidates == NULL;
+  l_int32 h_empty = h_candidates == NULL;
+  *pix_vline = NULL;
+  *pix_hline = NULL;
+  if (!v_empty || !h_empty) {
+    TBOX candidates;
+    l_int32 x, y, box_width, box_height;
+    if (!v_empty) {
+      boxGetGeometry(v_candidates, &x, &y, &box_width, &box_height);
+      candidates += TBOX(x, y, x + box_width, y + box_height);
+    }
+    if (!h_empty) {
+      boxGetGeometry(h_candidates, &x, &y, &box_width, &box_height);
+      candidates += TBOX(x, y, x + box_width, y + box_height);
+    }
+    OpenLinesInRegion(pix_closed, candidates, max_line_width, min_line_length,
+                      !v_empty, !h_empty, pix_vline, pix_hline, pixa_display);
+  }
+  boxDestroy(&v_candidates);
+  boxDestroy(&h_candidates);
   // Lines are sufficiently rare, that it is worth checking for a zero image.
-  l_int32 v_empty = 0;
-  l_int32 h_empty = 0;
-  pixZero(*pix_vline, &v_empty);
-  pixZero(*pix_hline, &h_empty);
+  if (!v_empty)
+    pixZero(*pix_vline, &v_empty);
+  if (!h_empty)
+    pixZero(*pix_hline, &h_empty);
   if (pix_music_mask != NULL) {
     if (!v_empty && !h_empty) {
       *pix_music_mask = FilterMusic(resolution, pix_closed,
@@ -686,7 +900,8 @@ void LineFinder::GetLineMasks(int resolution, Pix* src_pix,
 // Returns a list of boxes corresponding to the candidate line segments. Sets
 // the line_crossings member of the boxes so we can later determin the number
 // of intersections touched by a full line.
-void LineFinder::GetLineBoxes(bool horizontal_lines,
+void LineFinder::GetLineBoxes(const Textord* textord,
+                              bool horizontal_lines,
                               Pix* pix_lines, Pix* pix_intersections,
                               C_BLOB_LIST* line_cblobs,
                               BLOBNBOX_LIST* line_bblobs) {
@@ -710,7 +925,7 @@ void LineFinder::GetLineBoxes(bool horizontal_lines,
   }
   // Get the individual connected components
   Boxa* boxa = pixConnComp(pix_lines, NULL, 8);
-  ConvertBoxaToBlobs(width, height, &boxa, line_cblobs);
+  ConvertBoxaToBlobs(textord, width, height, &boxa, line_cblobs);
   // Make the BLOBNBOXes from the C_BLOBs.
   C_BLOB_IT blob_it(line_cblobs);
   BLOBNBOX_IT bbox_it(line_bblobs);
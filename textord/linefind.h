@@ -31,6 +31,7 @@ class ICOORD;
 namespace tesseract {
 
 class TabVector_LIST;
+class Textord;
 
 /**
  * The LineFinder class is a simple static function wrapper class that mainly
@@ -57,8 +58,12 @@ class LineFinder {
    * having no boxes, as there is no need to refit or merge separator lines.
    *
    * The detected lines are removed from the pix.
+   *
+   * The textord supplies the edges_* params used to sort the line
+   * fragments into blobs.
    */
-  static void FindAndRemoveLines(int resolution,  bool debug, Pix* pix,
+  static void FindAndRemoveLines(const Textord* textord,
+                                 int resolution,  bool debug, Pix* pix,
                                  int* vertical_x, int* vertical_y,
                                  Pix** pix_music_mask,
                                  TabVector_LIST* v_lines,
@@ -73,7 +78,8 @@ class LineFinder {
    * The C_OUTLINEs in the C_BLOBs contain no outline data - just empty
    * bounding boxes. The Boxa is consumed and destroyed.
    */
-  static void ConvertBoxaToBlobs(int image_width, int image_height,
+  static void ConvertBoxaToBlobs(const Textord* textord,
+                                 int image_width, int image_height,
                                  Boxa** boxes, C_BLOB_LIST* blobs);
 
  private:
@@ -85,7 +91,7 @@ class LineFinder {
   // The output vectors are owned by the list and Frozen (cannot refit) by
   // having no boxes, as there is no need to refit or merge separator lines.
   // If no good lines are found, pix_vline is destroyed.
-  static void FindAndRemoveVLines(int resolution,
+  static void FindAndRemoveVLines(const Textord* textord, int resolution,
                                   Pix* pix_intersections,
                                   int* vertical_x, int* vertical_y,
                                   Pix** pix_vline, Pix* pix_non_vline,
@@ -100,7 +106,7 @@ class LineFinder {
   // The output vectors are owned by the list and Frozen (cannot refit) by
   // having no boxes, as there is no need to refit or merge separator lines.
   // If no good lines are found, pix_hline is destroyed.
-  static void FindAndRemoveHLines(int resolution,
+  static void FindAndRemoveHLines(const Textord* textord, int resolution,
                                   Pix* pix_intersections,
                                   int vertical_x, int vertical_y,
                                   Pix** pix_hline, Pix* pix_non_hline,
@@ -138,7 +144,7 @@ class LineFinder {
   // Returns a list of boxes corresponding to the candidate line segments. Sets
   // the line_crossings member of the boxes so we can later determin the number
   // of intersections touched by a full line.
-  static void GetLineBoxes(bool horizontal_lines,
+  static void GetLineBoxes(const Textord* textord, bool horizontal_lines,
                            Pix* pix_lines, Pix* pix_intersections,
                            C_BLOB_LIST* line_cblobs,
                            BLOBNBOX_LIST* line_bblobs);
@@ -42,65 +42,6 @@
 #include "config_auto.h"
 #endif
 
-BOOL_VAR(textord_heavy_nr, FALSE, "Vigorously remove noise");
-BOOL_VAR(textord_show_initial_rows, FALSE, "Display row accumulation");
-BOOL_VAR(textord_show_parallel_rows, FALSE, "Display page correlated rows");
-BOOL_VAR(textord_show_expanded_rows, FALSE, "Display rows after expanding");
-BOOL_VAR(textord_show_final_rows, FALSE, "Display rows after final fitting");
-BOOL_VAR(textord_show_final_blobs, FALSE, "Display blob bounds after pre-ass");
-BOOL_VAR(textord_test_landscape, FALSE, "Tests refer to land/port");
-BOOL_VAR(textord_parallel_baselines, TRUE, "Force parallel baselines");
-BOOL_VAR(textord_straight_baselines, FALSE, "Force straight baselines");
-BOOL_VAR(textord_old_baselines, TRUE, "Use old baseline algorithm");
-BOOL_VAR(textord_old_xheight, FALSE, "Use old xheight algorithm");
-BOOL_VAR(textord_fix_xheight_bug, TRUE, "Use spline baseline");
-BOOL_VAR(textord_fix_makerow_bug, TRUE, "Prevent multiple baselines");
-BOOL_VAR(textord_debug_xheights, FALSE, "Test xheight algorithms");
-BOOL_VAR(textord_biased_skewcalc, TRUE, "Bias skew estimates with line length");
-BOOL_VAR(textord_interpolating_skew, TRUE, "Interpolate across gaps");
-INT_VAR(textord_skewsmooth_offset, 2, "For smooth factor");
-INT_VAR(textord_skewsmooth_offset2, 1, "For smooth factor");
-INT_VAR(textord_test_x, -1, "coord of test pt");
-INT_VAR(textord_test_y, -1, "coord of test pt");
-INT_VAR(textord_min_blobs_in_row, 4, "Min blobs before gradient counted");
-INT_VAR(textord_spline_minblobs, 8, "Min blobs in each spline segment");
-INT_VAR(textord_spline_medianwin, 6, "Size of window for spline segmentation");
-INT_VAR(textord_max_blob_overlaps, 4,
-        "Max number of blobs a big blob can overlap");
-INT_VAR(textord_min_xheight, 10, "Min credible pixel xheight");
-double_VAR(textord_spline_shift_fraction, 0.02,
-           "Fraction of line spacing for quad");
-double_VAR(textord_spline_outlier_fraction, 0.1,
-           "Fraction of line spacing for outlier");
-double_VAR(textord_skew_ile, 0.5, "Ile of gradients for page skew");
-double_VAR(textord_skew_lag, 0.01, "Lag for skew on row accumulation");
-double_VAR(textord_linespace_iqrlimit, 0.2, "Max iqr/median for linespace");
-double_VAR(textord_width_limit, 8, "Max width of blobs to make rows");
-double_VAR(textord_chop_width, 1.5, "Max width before chopping");
-double_VAR(textord_expansion_factor, 1.0,
-           "Factor to expand rows by in expand_rows");
-double_VAR(textord_overlap_x, 0.5, "Fraction of linespace for good overlap");
-double_VAR(textord_minxh, 0.25, "fraction of linesize for min xheight");
-double_VAR(textord_min_linesize, 1.25, "* blob height for initial linesize");
-double_VAR(textord_excess_blobsize, 1.3,
-           "New row made if blob makes row this big");
-double_VAR(textord_occupancy_threshold, 0.4, "Fraction of neighbourhood");
-double_VAR(textord_underline_width, 2.0, "Multiple of line_size for underline");
-double_VAR(textord_min_blob_height_fraction, 0.75,
-           "Min blob height/top to include blob top into xheight stats");
-double_VAR(textord_xheight_mode_fraction, 0.4,
-           "Min pile height to make xheight");
-double_VAR(textord_ascheight_mode_fraction, 0.08,
-           "Min pile height to make ascheight");
-double_VAR(textord_descheight_mode_fraction, 0.08,
-           "Min pile height to make descheight");
-double_VAR(textord_ascx_ratio_min, 1.25, "Min cap/xheight");
-double_VAR(textord_ascx_ratio_max, 1.8, "Max cap/xheight");
-double_VAR(textord_descx_ratio_min, 0.25, "Min desc/xheight");
-double_VAR(textord_descx_ratio_max, 0.6, "Max desc/xheight");
-double_VAR(textord_xheight_error_margin, 0.1, "Accepted variation");
-INT_VAR(textord_lms_line_trials, 12, "Number of linew fits to do");
-BOOL_VAR(textord_new_initial_xheight, TRUE, "Use test xheight mechanism");
 
 #define MAX_HEIGHT_MODES  12
 
@@ -164,7 +105,8 @@ float MakeRowFromSubBlobs(TO_BLOCK* block, C_BLOB* blob, TO_ROW_IT* row_it) {
  * only a single blob, it makes 2 rows, in case the top-level blob
  * is a container of the real blobs to recognize.
  */
-float make_single_row(ICOORD page_tr, TO_BLOCK* block, TO_BLOCK_LIST* blocks) {
+namespace tesseract {
+float Textord::make_single_row(ICOORD page_tr, TO_BLOCK* block, TO_BLOCK_LIST* blocks) {
   BLOBNBOX_IT blob_it = &block->blobs;
   TO_ROW_IT row_it = block->get_rows();
 
@@ -189,51 +131,98 @@ float make_single_row(ICOORD page_tr, TO_BLOCK* block, TO_BLOCK_LIST* blocks) {
   return gradient;
 }
 
+/**
+ * @name textord_blocks_in_parallel
+ *
+ * Return true if the per-block stages may run in parallel over the blocks.
+ * The debug displays all draw in to_win, so they force serial running.
+ */
+BOOL8 Textord::textord_blocks_in_parallel() {
+  if (!textord_parallel_blocks)
+    return FALSE;
+#ifndef GRAPHICS_DISABLED
+  if (to_win != NULL || textord_show_initial_rows ||
+      textord_show_parallel_rows || textord_show_expanded_rows ||
+      textord_show_final_rows || textord_show_final_blobs ||
+      textord_show_initial_words)
+    return FALSE;
+#endif
+  return TRUE;
+}
+}  // namespace tesseract.
+
+/**
+ * @name blocks_to_vector
+ *
+ * Copy the blocks to a vector so a parallel loop can index them.
+ */
+void blocks_to_vector(TO_BLOCK_LIST *blocks, GenericVector<TO_BLOCK*> *vector) {
+  TO_BLOCK_IT block_it(blocks);
+  vector->truncate(0);
+  for (block_it.mark_cycle_pt(); !block_it.cycled_list(); block_it.forward())
+    vector->push_back(block_it.data());
+}
+
 /**
  * @name make_rows
  *
  * Arrange the blobs into rows.
+ * The initial rows and the cleanup are independent in each block, so they
+ * run in parallel over the blocks, but the page skew needs them all.
  */
-float make_rows(ICOORD page_tr, TO_BLOCK_LIST *port_blocks) {
+namespace tesseract {
+float Textord::make_rows(ICOORD page_tr, TO_BLOCK_LIST *port_blocks) {
   float port_m;                  // global skew
   float port_err;                // global noise
-  TO_BLOCK_IT block_it;          // iterator
-
-  block_it.set_to_list(port_blocks);
-  for (block_it.mark_cycle_pt(); !block_it.cycled_list();
-       block_it.forward())
-  make_initial_textrows(page_tr, block_it.data(), FCOORD(1.0f, 0.0f),
-      !(BOOL8) textord_test_landscape);
+  GenericVector<TO_BLOCK*> blocks;
+  blocks_to_vector(port_blocks, &blocks);
+  int block_count = blocks.size();
+  bool parallel = textord_blocks_in_parallel();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (parallel)
+#endif  // _OPENMP
+  for (int b = 0; b < block_count; ++b) {
+    make_initial_textrows(page_tr, blocks[b], FCOORD(1.0f, 0.0f),
+                          !(BOOL8) textord_test_landscape);
+  }
                                  // compute globally
   compute_page_skew(port_blocks, port_m, port_err);
-  block_it.set_to_list(port_blocks);
-  for (block_it.mark_cycle_pt(); !block_it.cycled_list(); block_it.forward()) {
-    cleanup_rows_making(page_tr, block_it.data(), port_m, FCOORD(1.0f, 0.0f),
-                 block_it.data()->block->bounding_box().left(),
-                 !(BOOL8)textord_test_landscape);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (parallel)
+#endif  // _OPENMP
+  for (int b = 0; b < block_count; ++b) {
+    cleanup_rows_making(page_tr, blocks[b], port_m, FCOORD(1.0f, 0.0f),
+                        blocks[b]->block->bounding_box().left(),
+                        !(BOOL8)textord_test_landscape);
   }
   return port_m;                 // global skew
 }
 
-namespace tesseract {
 
 void Textord::fit_rows(float gradient, ICOORD page_tr, TO_BLOCK_LIST *blocks) {
-  TO_BLOCK_IT block_it(blocks);          // iterator
-  for (block_it.mark_cycle_pt(); !block_it.cycled_list(); block_it.forward()) {
-    cleanup_rows_fitting(page_tr, block_it.data(), gradient, FCOORD(1.0f, 0.0f),
-                 block_it.data()->block->bounding_box().left(),
-                 !(BOOL8)textord_test_landscape);
+  GenericVector<TO_BLOCK*> block_vector;
+  blocks_to_vector(blocks, &block_vector);
+  int block_count = block_vector.size();
+  bool parallel = textord_blocks_in_parallel();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (parallel)
+#endif  // _OPENMP
+  for (int b = 0; b < block_count; ++b) {
+    TO_BLOCK* block = block_vector[b];
+    cleanup_rows_fitting(page_tr, block, gradient, FCOORD(1.0f, 0.0f),
+                         block->block->bounding_box().left(),
+                         !(BOOL8)textord_test_landscape);
   }
 }
 
-}  // namespace tesseract.
 
 /**
  * @name make_initial_textrows
  *
  * Arrange the good blobs into rows of text.
  */
-void make_initial_textrows(                  //find lines
+void Textord::make_initial_textrows(                  //find lines
                            ICOORD page_tr,
                            TO_BLOCK *block,  //block to do
                            FCOORD rotation,  //for drawing
@@ -266,6 +255,7 @@ void make_initial_textrows(                  //find lines
   }
 #endif
 }
+}  // namespace tesseract.
 
 
 /**
@@ -293,7 +283,8 @@ void fit_lms_line(TO_ROW *row) {
  * Compute the skew over a full page by averaging the gradients over
  * all the lines. Get the error of the same row.
  */
-void compute_page_skew(                        //get average gradient
+namespace tesseract {
+void Textord::compute_page_skew(                        //get average gradient
                        TO_BLOCK_LIST *blocks,  //list of blocks
                        float &page_m,          //average gradient
                        float &page_err         //average error
@@ -388,6 +379,7 @@ void compute_page_skew(                        //get average gradient
   free_mem(gradients);
   free_mem(errors);
 }
+}  // namespace tesseract.
 
 const double kNoiseSize = 0.5;  // Fraction of xheight.
 const int kMinSize = 8;  // Min pixels to be xheight.
@@ -531,7 +523,8 @@ static void vigorous_noise_removal(TO_BLOCK* block) {
  *
  * Remove overlapping rows and fit all the blobs to what's left.
  */
-void cleanup_rows_making(                   //find lines
+namespace tesseract {
+void Textord::cleanup_rows_making(                   //find lines
                   ICOORD page_tr,    //top right
                   TO_BLOCK *block,   //block to do
                   float gradient,    //gradient to fit
@@ -579,7 +572,6 @@ void cleanup_rows_making(                   //find lines
   assign_blobs_to_rows (block, &gradient, 3, FALSE, FALSE, FALSE);
 }
 
-namespace tesseract {
 
 void Textord::cleanup_rows_fitting(ICOORD page_tr,    // top right
                                    TO_BLOCK *block,   // block to do
@@ -657,14 +649,13 @@ void Textord::cleanup_rows_fitting(ICOORD page_tr,    // top right
 #endif
 }
 
-}  // namespace tesseract.
 
 /**
  * delete_non_dropout_rows
  *
  * Compute the linespacing and offset.
  */
-void delete_non_dropout_rows(                   //find lines
+void Textord::delete_non_dropout_rows(                   //find lines
                              TO_BLOCK *block,   //block to do
                              float gradient,    //global skew
                              FCOORD rotation,   //deskew vector
@@ -744,6 +735,7 @@ void delete_non_dropout_rows(                   //find lines
   free_mem(deltas);
   free_mem(occupation);
 }
+}  // namespace tesseract.
 
 
 /**
@@ -934,7 +926,8 @@ void compute_line_occupation(                    //project blobs
  *
  * Compute thresholds for textline or not for the occupation array.
  */
-void compute_occupation_threshold(                    //project blobs
+namespace tesseract {
+void Textord::compute_occupation_threshold(                    //project blobs
                                   inT32 low_window,   //below result point
                                   inT32 high_window,  //above result point
                                   inT32 line_count,   //array sizes
@@ -1008,6 +1001,7 @@ void compute_occupation_threshold(                    //project blobs
     thresholds[line_index] = (sum - min_occ) / divisor + min_occ;
   //same out to end
 }
+}  // namespace tesseract.
 
 
 /**
@@ -1062,7 +1056,8 @@ void compute_dropout_distances(                    //project blobs
  * neighbours. If the expansion would entirely swallow a neighbouring row
  * then do so.
  */
-void expand_rows(                   //find lines
+namespace tesseract {
+void Textord::expand_rows(                   //find lines
                  ICOORD page_tr,    //top right
                  TO_BLOCK *block,   //block to do
                  float gradient,    //gradient to fit
@@ -1220,7 +1215,7 @@ void expand_rows(                   //find lines
  *
  * Change the limits of rows to suit the default fractions.
  */
-void adjust_row_limits(                 //tidy limits
+void Textord::adjust_row_limits(                 //tidy limits
                        TO_BLOCK *block  //block to do
                       ) {
   TO_ROW *row;                   //current row
@@ -1256,7 +1251,7 @@ void adjust_row_limits(                 //tidy limits
  *
  * Compute the linespacing and offset.
  */
-void compute_row_stats(                  //find lines
+void Textord::compute_row_stats(                  //find lines
                        TO_BLOCK *block,  //block to do
                        BOOL8 testing_on  //correct orientation
                       ) {
@@ -1341,6 +1336,13 @@ void compute_row_stats(                  //find lines
 }
 
 
+void Textord::get_min_max_xheight(int block_linesize,
+                                  int *min_height, int *max_height) const {
+  *min_height = static_cast<inT32>(floor(block_linesize * textord_minxh));
+  if (*min_height < textord_min_xheight) *min_height = textord_min_xheight;
+  *max_height = static_cast<inT32>(ceil(block_linesize * 3.0));
+}
+
 /**
  * @name compute_block_xheight
  *
@@ -1370,7 +1372,6 @@ void compute_row_stats(                  //find lines
  * ROW_UNKNOWN and ROW_INVALID categories.
  *
  */
-namespace tesseract {
 void Textord::compute_block_xheight(TO_BLOCK *block, float gradient) {
   TO_ROW *row;                          // current row
   float asc_frac_xheight = CCStruct::kAscenderFraction /
@@ -1515,7 +1516,6 @@ void Textord::compute_row_xheight(TO_ROW *row,          // row to do
   }
 }
 
-}  // namespace tesseract.
 
 /**
  * @name fill_heights
@@ -1523,7 +1523,7 @@ void Textord::compute_row_xheight(TO_ROW *row,          // row to do
  * Fill the given heights with heights of the blobs that are legal
  * candidates for estimating xheight.
  */
-void fill_heights(TO_ROW *row, float gradient, int min_height,
+void Textord::fill_heights(TO_ROW *row, float gradient, int min_height,
                   int max_height, STATS *heights, STATS *floating_heights) {
   float xcentre;                 // centre of blob
   float top;                     // top y coord of blob
@@ -1584,7 +1584,7 @@ void fill_heights(TO_ROW *row, float gradient, int min_height,
  * (e.g.  -, ', =, ^, `, ", ', etc)
  * If cap_only, then force finding of only the top mode.
  */
-int compute_xheight_from_modes(
+int Textord::compute_xheight_from_modes(
     STATS *heights, STATS *floating_heights, bool cap_only, int min_height,
     int max_height, float *xheight, float *ascrise) {
   int blob_index = heights->mode();  // find mode
@@ -1680,7 +1680,7 @@ int compute_xheight_from_modes(
  * number of blobs in the row, the function returns the descender
  * height, returns 0 otherwise.
  */
-inT32 compute_row_descdrop(TO_ROW *row, float gradient,
+inT32 Textord::compute_row_descdrop(TO_ROW *row, float gradient,
                            int xheight_blob_count, STATS *asc_heights) {
   // Count how many potential ascenders are in this row.
   int i_min = asc_heights->min_bucket();
@@ -1732,6 +1732,7 @@ inT32 compute_row_descdrop(TO_ROW *row, float gradient,
   }
   return descdrop;
 }
+}  // namespace tesseract.
 
 
 /**
@@ -1802,7 +1803,8 @@ inT32 compute_height_modes(STATS *heights,    // stats to search
  * Adjust the xheight etc of this row if not within reasonable limits
  * of the average for the block.
  */
-void correct_row_xheight(TO_ROW *row, float xheight,
+namespace tesseract {
+void Textord::correct_row_xheight(TO_ROW *row, float xheight,
                          float ascrise, float descdrop) {
   ROW_CATEGORY row_category = get_row_category(row);
   if (textord_debug_xheights) {
@@ -1868,6 +1870,7 @@ void correct_row_xheight(TO_ROW *row, float xheight,
             " = %.4f\n", row->xheight, row->ascrise, row->descdrop);
   }
 }
+}  // namespace tesseract.
 
 static int CountOverlaps(const TBOX& box, int min_height,
                          BLOBNBOX_LIST* blobs) {
@@ -1889,7 +1892,8 @@ static int CountOverlaps(const TBOX& box, int min_height,
  * Test wide objects for being potential underlines. If they are then
  * put them in a separate list in the block.
  */
-void separate_underlines(TO_BLOCK *block,  // block to do
+namespace tesseract {
+void Textord::separate_underlines(TO_BLOCK *block,  // block to do
                          float gradient,   // skew angle
                          FCOORD rotation,  // inverse landscape
                          BOOL8 testing_on) {  // correct orientation
@@ -1962,7 +1966,7 @@ void separate_underlines(TO_BLOCK *block,  // block to do
  *
  * Associate overlapping blobs and fake chop wide blobs.
  */
-void pre_associate_blobs(                  //make rough chars
+void Textord::pre_associate_blobs(                  //make rough chars
                          ICOORD page_tr,   //top right
                          TO_BLOCK *block,  //block to do
                          FCOORD rotation,  //inverse landscape
@@ -2048,7 +2052,7 @@ void pre_associate_blobs(                  //make rough chars
  *
  * Re-fit the rows in the block to the given gradient.
  */
-void fit_parallel_rows(                   //find lines
+void Textord::fit_parallel_rows(                   //find lines
                        TO_BLOCK *block,   //block to do
                        float gradient,    //gradient to fit
                        FCOORD rotation,   //for drawing
@@ -2090,7 +2094,7 @@ void fit_parallel_rows(                   //find lines
  * Make the fit parallel to the given gradient and set the
  * row accordingly.
  */
-void fit_parallel_lms(float gradient, TO_ROW *row) {
+void Textord::fit_parallel_lms(float gradient, TO_ROW *row) {
   float c;                       // fitted line
   int blobcount;                 // no of blobs
    tesseract::DetLineFit lms;
@@ -2119,7 +2123,6 @@ void fit_parallel_lms(float gradient, TO_ROW *row) {
  *
  * Re-fit the rows in the block to the given gradient.
  */
-namespace tesseract {
 void Textord::make_spline_rows(TO_BLOCK *block,   // block to do
                                float gradient,    // gradient to fit
                                FCOORD rotation,   // for drawing
@@ -2165,8 +2168,6 @@ void Textord::make_spline_rows(TO_BLOCK *block,   // block to do
 #endif
 }
 
-}  // namespace tesseract.
-
 
 /**
  * @name make_baseline_spline
@@ -2175,7 +2176,7 @@ void Textord::make_spline_rows(TO_BLOCK *block,   // block to do
  * Make the fit parallel to the given gradient and set the
  * row accordingly.
  */
-void make_baseline_spline(TO_ROW *row,     //row to fit
+void Textord::make_baseline_spline(TO_ROW *row,     //row to fit
                           TO_BLOCK *block) {
   BLOBNBOX_IT blob_it = row->blob_list ();
   inT32 *xstarts;                // spline boundaries
@@ -2209,7 +2210,7 @@ void make_baseline_spline(TO_ROW *row,     //row to fit
  * Return TRUE if enough blobs were far enough away to need a quadratic.
  */
 BOOL8
-segment_baseline (               //split baseline
+Textord::segment_baseline (               //split baseline
 TO_ROW * row,                    //row to fit
 TO_BLOCK * block,                //block it came from
 inT32 & segments,                //no fo segments
@@ -2308,7 +2309,7 @@ inT32 xstarts[]                  //coords of segments
  * @return TRUE if enough blobs were far enough away to need a quadratic.
  */
 double *
-linear_spline_baseline (         //split baseline
+Textord::linear_spline_baseline (         //split baseline
 TO_ROW * row,                    //row to fit
 TO_BLOCK * block,                //block it came from
 inT32 & segments,                //no fo segments
@@ -2399,7 +2400,7 @@ inT32 xstarts[]                  //coords of segments
  * Make enough rows to allocate all the given blobs to one.
  * If a block skew is given, use that, else attempt to track it.
  */
-void assign_blobs_to_rows(                      //find lines
+void Textord::assign_blobs_to_rows(                      //find lines
                           TO_BLOCK *block,      //block to do
                           float *gradient,      //block skew
                           int pass,             //identification
@@ -2595,7 +2596,7 @@ void assign_blobs_to_rows(                      //find lines
  *
  * Return the row which most overlaps the blob.
  */
-OVERLAP_STATE most_overlapping_row(                    //find best row
+OVERLAP_STATE Textord::most_overlapping_row(                    //find best row
                                    TO_ROW_IT *row_it,  //iterator
                                    TO_ROW *&best_row,  //output row
                                    float top,          //top of blob
@@ -2684,6 +2685,7 @@ OVERLAP_STATE most_overlapping_row(                    //find best row
   best_row = row;
   return result;
 }
+}  // namespace tesseract.
 
 
 /**
@@ -33,25 +33,6 @@
 #include "config_auto.h"
 #endif
 
-#define EXTERN
-
-EXTERN BOOL_VAR (textord_really_old_xheight, FALSE,
-"Use original wiseowl xheight");
-EXTERN BOOL_VAR (textord_oldbl_debug, FALSE, "Debug old baseline generation");
-EXTERN BOOL_VAR (textord_debug_baselines, FALSE, "Debug baseline generation");
-EXTERN BOOL_VAR (textord_oldbl_paradef, TRUE, "Use para default mechanism");
-EXTERN BOOL_VAR (textord_oldbl_split_splines, TRUE, "Split stepped splines");
-EXTERN BOOL_VAR (textord_oldbl_merge_parts, TRUE, "Merge suspect partitions");
-EXTERN BOOL_VAR (oldbl_corrfix, TRUE, "Improve correlation of heights");
-EXTERN BOOL_VAR (oldbl_xhfix, FALSE,
-"Fix bug in modes threshold for xheights");
-EXTERN BOOL_VAR(textord_ocropus_mode, FALSE, "Make baselines for ocropus");
-EXTERN double_VAR (oldbl_xhfract, 0.4, "Fraction of est allowed in calc");
-EXTERN INT_VAR (oldbl_holed_losscount, 10,
-"Max lost before fallback line used");
-EXTERN double_VAR (oldbl_dot_error_size, 1.26, "Max aspect ratio of a dot");
-EXTERN double_VAR (textord_oldbl_jumplimit, 0.15,
-"X fraction for new partition");
 
 #define TURNLIMIT          1     /*min size for turning point */
 #define X_HEIGHT_FRACTION  0.7   /*x-height/caps height */
@@ -434,8 +415,6 @@ void Textord::find_textlines(TO_BLOCK *block,  // block row is in
   free_mem(ydiffs);
 }
 
-}  // namespace tesseract.
-
 
 /**********************************************************************
  * get_blob_coords
@@ -444,7 +423,7 @@ void Textord::find_textlines(TO_BLOCK *block,  // block row is in
  * in the row. The return value is the first guess at the line height.
  **********************************************************************/
 
-int get_blob_coords(                    //get boxes
+int Textord::get_blob_coords(                    //get boxes
                     TO_ROW *row,        //row to use
                     inT32 lineheight,   //block level
                     TBOX *blobcoords,    //ouput boxes
@@ -514,7 +493,7 @@ int get_blob_coords(                    //get boxes
  **********************************************************************/
 
 void
-make_first_baseline (            //initial approximation
+Textord::make_first_baseline (            //initial approximation
 TBOX blobcoords[],                /*blob bounding boxes */
 int blobcount,                   /*no of blobcoords */
 int xcoords[],                   /*coords for spline */
@@ -646,6 +625,7 @@ float jumplimit                  /*guess half descenders */
     baseline->move (shift);
   }
 }
+}  // namespace tesseract.
 
 
 /**********************************************************************
@@ -714,8 +694,9 @@ float gradient                   //of line
  * The return value is the biggest partition
  **********************************************************************/
 
+namespace tesseract {
 int
-partition_line (                 //partition blobs
+Textord::partition_line (                 //partition blobs
 TBOX blobcoords[],                //bounding boxes
 int blobcount,                   /*no of blobs on row */
 int *numparts,                   /*number of partitions */
@@ -796,7 +777,7 @@ float ydiffs[]                   /*diff from spline */
  **********************************************************************/
 
 void
-merge_oldbl_parts (              //partition blobs
+Textord::merge_oldbl_parts (              //partition blobs
 TBOX blobcoords[],                //bounding boxes
 int blobcount,                   /*no of blobs on row */
 char partids[],                  /*partition no of each blob */
@@ -898,6 +879,7 @@ float jumplimit                  /*allowed delta change */
       runlength++;
   }
 }
+}  // namespace tesseract.
 
 
 /**********************************************************************
@@ -959,8 +941,9 @@ float ydiffs[]                   /*output */
  * Choose a partition for the point and return the index.
  **********************************************************************/
 
+namespace tesseract {
 int
-choose_partition (               //select partition
+Textord::choose_partition (               //select partition
 register float diff,             /*diff from spline */
 float partdiffs[],               /*diff on all parts */
 int lastpart,                    /*last assigned partition */
@@ -1023,6 +1006,7 @@ int *partcount                   /*no of partitions */
 
   return bestpart;
 }
+}  // namespace tesseract.
 
 
 ///*merge_partitions(partids,partcount,blobcount,bestpart) discards funny looking
@@ -1117,8 +1101,9 @@ int ycoords[]                    /*points to work on */
  * The xstarts of the segments are returned and the number found.
  **********************************************************************/
 
+namespace tesseract {
 int
-segment_spline (                 //make xstarts
+Textord::segment_spline (                 //make xstarts
 TBOX blobcoords[],                //boundign boxes
 int blobcount,                   /*no of blobs in row */
 int xcoords[],                   /*points to work on */
@@ -1243,7 +1228,7 @@ int xstarts[]                    //result
  **********************************************************************/
 
 BOOL8
-split_stepped_spline (           //make xstarts
+Textord::split_stepped_spline (           //make xstarts
 QSPLINE * baseline,              //current shot
 float jumplimit,                 //max step fuction
 int xcoords[],                   /*points to work on */
@@ -1341,6 +1326,7 @@ int &segments                    //no of segments
   }
   return doneany;
 }
+}  // namespace tesseract.
 
 
 /**********************************************************************
@@ -1458,8 +1444,9 @@ int bestpart                     /*biggest partition */
  * It also finds the ascender height if it can.
  **********************************************************************/
 
+namespace tesseract {
 void
-old_first_xheight (              //the wiseowl way
+Textord::old_first_xheight (              //the wiseowl way
 TO_ROW * row,                    /*current row */
 TBOX blobcoords[],                /*blob bounding boxes */
 int initialheight,               //initial guess
@@ -1544,7 +1531,7 @@ float jumplimit                  /*min ascender height */
  **********************************************************************/
 
 void
-make_first_xheight (             //find xheight
+Textord::make_first_xheight (             //find xheight
 TO_ROW * row,                    /*current row */
 TBOX blobcoords[],                /*blob bounding boxes */
 int lineheight,                  //initial guess
@@ -1617,6 +1604,7 @@ float jumplimit                  /*min ascender height */
   if (sign_bit < 0)
     row->xheight = -row->xheight;
 }
+}  // namespace tesseract.
 
 /**********************************************************************
  * find_top_modes
@@ -1628,8 +1616,9 @@ float jumplimit                  /*min ascender height */
 const int kMinModeFactorOcropus = 32;
 const int kMinModeFactor = 12;
 
+namespace tesseract {
 void
-find_top_modes (                 //get modes
+Textord::find_top_modes (                 //get modes
 STATS * stats,                   //stats to hack
 int statnum,                     //no of piles
 int modelist[], int modenum      //no of modes to get
@@ -1669,7 +1658,7 @@ int modelist[], int modenum      //no of modes to get
  * Choose based on the height modes the best x height value.
  **********************************************************************/
 
-void pick_x_height(TO_ROW * row,                    //row to do
+void Textord::pick_x_height(TO_ROW * row,                    //row to do
                    int modelist[],
                    int lefts[], int rights[],
                    STATS * heightstat,
@@ -1776,3 +1765,4 @@ void pick_x_height(TO_ROW * row,                    //row to do
   if (row->xheight == 0)
     row->xheight = -1.0f;
 }
+}  // namespace tesseract.
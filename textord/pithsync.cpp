@@ -28,6 +28,7 @@
 #include          "topitch.h"
 #include          "pithsync.h"
 #include          "tprintf.h"
+#include          "textord.h"
 
 #define PROJECTION_MARGIN 10     //arbitrary
 
@@ -107,7 +108,9 @@ void FPCUTPT::assign(                         //constructor
                      float projection_scale,  //scaling
                      inT16 zero_count,        //official zero
                      inT16 pitch,             //proposed pitch
-                     inT16 pitch_error        //allowed tolerance
+                     inT16 pitch_error,       //allowed tolerance
+                     double balance_factor,   //textord_balance_factor
+                     BOOL8 fast_pitch_test    //textord_fast_pitch_test
                     ) {
   int index;                     //test index
   int balance_index;             //for balance factor
@@ -151,8 +154,8 @@ void FPCUTPT::assign(                         //constructor
       dist = x - segpt->xpos;
       if (!segpt->terminal && segpt->fake_count < MAX_INT16) {
         balance_count = 0;
-        if (textord_balance_factor > 0) {
-          if (textord_fast_pitch_test) {
+        if (balance_factor > 0) {
+          if (fast_pitch_test) {
             lead_flag = back_balance ^ segpt->fwd_balance;
             balance_count = 0;
             while (lead_flag != 0) {
@@ -171,7 +174,7 @@ void FPCUTPT::assign(                         //constructor
                 <= zero_count);
           }
           balance_count =
-            (inT16) (balance_count * textord_balance_factor /
+            (inT16) (balance_count * balance_factor /
             projection_scale);
         }
         r_index = segpt->region_index + 1;
@@ -215,7 +218,8 @@ void FPCUTPT::assign_cheap(                         //constructor
                            float projection_scale,  //scaling
                            inT16 zero_count,        //official zero
                            inT16 pitch,             //proposed pitch
-                           inT16 pitch_error        //allowed tolerance
+                           inT16 pitch_error,       //allowed tolerance
+                           double balance_factor    //textord_balance_factor
                           ) {
   int index;                     //test index
   inT16 balance_count;           //ding factor
@@ -257,14 +261,14 @@ void FPCUTPT::assign_cheap(                         //constructor
     dist = x - segpt->xpos;
     if (!segpt->terminal && segpt->fake_count < MAX_INT16) {
       balance_count = 0;
-      if (textord_balance_factor > 0) {
+      if (balance_factor > 0) {
         lead_flag = back_balance ^ segpt->fwd_balance;
         balance_count = 0;
         while (lead_flag != 0) {
           balance_count++;
           lead_flag &= lead_flag - 1;
         }
-        balance_count = (inT16) (balance_count * textord_balance_factor
+        balance_count = (inT16) (balance_count * balance_factor
           / projection_scale);
       }
       r_index = segpt->region_index + 1;
@@ -296,7 +300,8 @@ void FPCUTPT::assign_cheap(                         //constructor
  * The return value is a measure of goodness of the sync.
  **********************************************************************/
 
-double check_pitch_sync2(                          //find segmentation
+namespace tesseract {
+double Textord::check_pitch_sync2(                          //find segmentation
                          BLOBNBOX_IT *blob_it,     //blobs to do
                          inT16 blob_count,         //no of blobs
                          inT16 pitch,              //pitch estimate
@@ -411,7 +416,8 @@ double check_pitch_sync2(                          //find segmentation
     cutpts[x - array_origin].assign (cutpts, array_origin, x,
       faking, mid_cut, offset, projection,
       projection_scale, zero_count, pitch,
-      pitch_error);
+      pitch_error,
+      textord_balance_factor, textord_fast_pitch_test);
     x++;
   }
 
@@ -423,7 +429,8 @@ double check_pitch_sync2(                          //find segmentation
     cutpts[x - array_origin].assign (cutpts, array_origin, x,
       FALSE, FALSE, offset, projection,
       projection_scale, zero_count, pitch,
-      pitch_error);
+      pitch_error,
+      textord_balance_factor, textord_fast_pitch_test);
     cutpts[x - array_origin].terminal = TRUE;
     if (cutpts[x - array_origin].index () +
     cutpts[x - array_origin].fake_count <= best_count + best_fake) {
@@ -493,7 +500,7 @@ double check_pitch_sync2(                          //find segmentation
  * The return value is a measure of goodness of the sync.
  **********************************************************************/
 
-double check_pitch_sync3(                          //find segmentation
+double Textord::check_pitch_sync3(                          //find segmentation
                          inT16 projection_left,    //edges //to be considered 0
                          inT16 projection_right,
                          inT16 zero_count,
@@ -616,13 +623,15 @@ double check_pitch_sync3(                          //find segmentation
       cutpts[x - array_origin].assign (cutpts, array_origin, x,
         faking, mid_cut, offset, projection,
         projection_scale, zero_count, pitch,
-        pitch_error);
+        pitch_error,
+        textord_balance_factor, textord_fast_pitch_test);
     else
       cutpts[x - array_origin].assign_cheap (cutpts, array_origin, x,
         faking, mid_cut, offset,
         projection, projection_scale,
         zero_count, pitch,
-        pitch_error);
+        pitch_error,
+        textord_balance_factor);
     x++;
     if (next_zero < x || next_zero == x + zero_offset)
       next_zero = x + zero_offset + 1;
@@ -638,7 +647,8 @@ double check_pitch_sync3(                          //find segmentation
     cutpts[x - array_origin].assign (cutpts, array_origin, x,
       FALSE, FALSE, offset, projection,
       projection_scale, zero_count, pitch,
-      pitch_error);
+      pitch_error,
+      textord_balance_factor, textord_fast_pitch_test);
     cutpts[x - array_origin].terminal = TRUE;
     if (cutpts[x - array_origin].index () +
     cutpts[x - array_origin].fake_count <= best_count + best_fake) {
@@ -694,3 +704,4 @@ double check_pitch_sync3(                          //find segmentation
   free_mem(cutpts);
   return seg_it.data ()->squares () - mean_sum;
 }
+}  // namespace tesseract.
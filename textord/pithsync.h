@@ -52,7 +52,9 @@ class FPCUTPT
       float projection_scale,    //scaling
       inT16 zero_count,          //official zero
       inT16 pitch,               //proposed pitch
-      inT16 pitch_error);        //allowed tolerance
+      inT16 pitch_error,         //allowed tolerance
+      double balance_factor,     //textord_balance_factor
+      BOOL8 fast_pitch_test);    //textord_fast_pitch_test
 
     void assign_cheap (          //evaluate cut
       FPCUTPT cutpts[],          //predecessors
@@ -65,7 +67,8 @@ class FPCUTPT
       float projection_scale,    //scaling
       inT16 zero_count,          //official zero
       inT16 pitch,               //proposed pitch
-      inT16 pitch_error);        //allowed tolerance
+      inT16 pitch_error,         //allowed tolerance
+      double balance_factor);    //textord_balance_factor
 
     inT32 position() {  //acces func
       return xpos;
@@ -104,31 +107,4 @@ class FPCUTPT
     double sq_sum;               //summed distsances
     double cost;                 //cost function
 };
-double check_pitch_sync2(                          //find segmentation
-                         BLOBNBOX_IT *blob_it,     //blobs to do
-                         inT16 blob_count,         //no of blobs
-                         inT16 pitch,              //pitch estimate
-                         inT16 pitch_error,        //tolerance
-                         STATS *projection,        //vertical
-                         inT16 projection_left,    //edges //scale factor
-                         inT16 projection_right,
-                         float projection_scale,
-                         inT16 &occupation_count,  //no of occupied cells
-                         FPSEGPT_LIST *seg_list,   //output list
-                         inT16 start,              //start of good range
-                         inT16 end                 //end of good range
-                        );
-double check_pitch_sync3(                          //find segmentation
-                         inT16 projection_left,    //edges //to be considered 0
-                         inT16 projection_right,
-                         inT16 zero_count,
-                         inT16 pitch,              //pitch estimate
-                         inT16 pitch_error,        //tolerance
-                         STATS *projection,        //vertical
-                         float projection_scale,   //scale factor
-                         inT16 &occupation_count,  //no of occupied cells
-                         FPSEGPT_LIST *seg_list,   //output list
-                         inT16 start,              //start of good range
-                         inT16 end                 //end of good range
-                        );
 #endif
@@ -24,21 +24,11 @@
 #include          <math.h>
 #include          "memry.h"
 #include          "pitsync1.h"
+#include          "textord.h"
 
 #include          "notdll.h"
 
 ELISTIZE (FPSEGPT) CLISTIZE (FPSEGPT_LIST)
-#define EXTERN
-EXTERN
-INT_VAR (pitsync_linear_version, 6, "Use new fast algorithm");
-EXTERN
-double_VAR (pitsync_joined_edge, 0.75,
-"Dist inside big blob for chopping");
-EXTERN
-double_VAR (pitsync_offset_freecut_fraction, 0.25,
-"Fraction of cut for free cuts");
-EXTERN
-INT_VAR (pitsync_fake_depth, 1, "Max advance fake generation");
 
 /**********************************************************************
  * FPSEGPT::FPSEGPT
@@ -148,7 +138,8 @@ FPSEGPT_LIST * prev_list         //previous segment
  * The return value is a measure of goodness of the sync.
  **********************************************************************/
 
-double check_pitch_sync(                        //find segmentation
+namespace tesseract {
+double Textord::check_pitch_sync(                        //find segmentation
                         BLOBNBOX_IT *blob_it,   //blobs to do
                         inT16 blob_count,       //no of blobs
                         inT16 pitch,            //pitch estimate
@@ -358,6 +349,7 @@ double check_pitch_sync(                        //find segmentation
   lattice.deep_clear ();         //shift the lot
   return outseg_it.data ()->squares () - mean_sum;
 }
+}  // namespace tesseract.
 
 
 /**********************************************************************
@@ -82,24 +82,6 @@ class FPSEGPT:public ELIST_LINK
 };
 
 ELISTIZEH (FPSEGPT) CLISTIZEH (FPSEGPT_LIST)
-extern
-INT_VAR_H (pitsync_linear_version, 0, "Use new fast algorithm");
-extern
-double_VAR_H (pitsync_joined_edge, 0.75,
-"Dist inside big blob for chopping");
-extern
-double_VAR_H (pitsync_offset_freecut_fraction, 0.25,
-"Fraction of cut for free cuts");
-extern
-INT_VAR_H (pitsync_fake_depth, 1, "Max advance fake generation");
-double check_pitch_sync(                        //find segmentation
-                        BLOBNBOX_IT *blob_it,   //blobs to do
-                        inT16 blob_count,       //no of blobs
-                        inT16 pitch,            //pitch estimate
-                        inT16 pitch_error,      //tolerance
-                        STATS *projection,      //vertical
-                        FPSEGPT_LIST *seg_list  //output list
-                       );
 void make_illegal_segment(                          //find segmentation
                           FPSEGPT_LIST *prev_list,  //previous segments
                           TBOX blob_box,             //bounding box
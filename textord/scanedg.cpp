@@ -34,6 +34,7 @@
 
 void block_edges(IMAGE *t_image,       // thresholded image
                  PDBLK *block,         // block in image
+                 inT32 max_edge_length,  // longest legal loop
                  C_OUTLINE_IT* outline_it) {
   uinT8 margin;                  // margin colour
   inT16 x;                       // line coords
@@ -70,7 +71,8 @@ void block_edges(IMAGE *t_image,       // thresholded image
         bwline.pixels[xindex] = margin;
     }
     line_edges(bleft.x(), y, tright.x() - bleft.x(),
-               margin, bwline.pixels, ptrline, &free_cracks, outline_it);
+               margin, bwline.pixels, ptrline, &free_cracks,
+               max_edge_length, outline_it);
   }
 
   free_crackedges(free_cracks);  // really free them
@@ -182,6 +184,7 @@ void line_edges(inT16 x,                         // coord of line start
                 uinT8 * bwpos,                   // thresholded line
                 CRACKEDGE ** prevline,           // edges in progress
                 CRACKEDGE **free_cracks,
+                inT32 max_edge_length,
                 C_OUTLINE_IT* outline_it) {
   CrackPos pos = {free_cracks, x, y };
   int xmax;                      // max x coord
@@ -204,7 +207,8 @@ void line_edges(inT16 x,                         // coord of line start
       if (colour == prevcolour) {
         if (colour == uppercolour) {
                                  // finish a line
-          join_edges(current, *prevline, free_cracks, outline_it);
+          join_edges(current, *prevline, free_cracks, max_edge_length,
+                     outline_it);
           current = NULL;        // no edge now
         } else {
                                  // new horiz edge
@@ -216,7 +220,8 @@ void line_edges(inT16 x,                         // coord of line start
           *prevline = v_edge(colour - prevcolour, *prevline, &pos);
                                  // 8 vs 4 connection
         else if (colour == WHITE_PIX) {
-          join_edges(current, *prevline, free_cracks, outline_it);
+          join_edges(current, *prevline, free_cracks, max_edge_length,
+                     outline_it);
           current = h_edge(uppercolour - colour, NULL, &pos);
           *prevline = v_edge(colour - prevcolour, current, &pos);
         } else {
@@ -240,7 +245,8 @@ void line_edges(inT16 x,                         // coord of line start
   if (current != NULL) {
                                  // out of block
     if (*prevline != NULL) {     // got one to join to?
-      join_edges(current, *prevline, free_cracks, outline_it);
+      join_edges(current, *prevline, free_cracks, max_edge_length,
+                 outline_it);
       *prevline = NULL;          // tidy now
     } else {
                                  // fake vertical
@@ -365,6 +371,7 @@ CRACKEDGE *v_edge(int sign,                       // sign of edge
 void join_edges(CRACKEDGE *edge1,  // edges to join
                 CRACKEDGE *edge2,   // no specific order
                 CRACKEDGE **free_cracks,
+                inT32 max_edge_length,
                 C_OUTLINE_IT* outline_it) {
   if (edge1->pos.x() + edge1->stepx != edge2->pos.x()
   || edge1->pos.y() + edge1->stepy != edge2->pos.y()) {
@@ -375,7 +382,7 @@ void join_edges(CRACKEDGE *edge1,  // edges to join
 
   if (edge1->next == edge2) {
                                  // already closed
-    complete_edge(edge1, outline_it);
+    complete_edge(edge1, max_edge_length, outline_it);
                                  // attach freelist to end
     edge1->prev->next = *free_cracks;
     *free_cracks = edge1;         // and free list
@@ -36,6 +36,7 @@ struct CrackPos {
 
 void block_edges(IMAGE *t_image,       // thresholded image
                  PDBLK *block,         // block in image
+                 inT32 max_edge_length,  // longest legal loop
                  C_OUTLINE_IT* outline_it);
 void make_margins(PDBLK *block,            // block in image
                   BLOCK_LINE_IT *line_it,  // for old style
@@ -53,6 +54,7 @@ void line_edges(inT16 x,                     // coord of line start
                 uinT8 * bwpos,               // thresholded line
                 CRACKEDGE ** prevline,       // edges in progress
                 CRACKEDGE **free_cracks,
+                inT32 max_edge_length,
                 C_OUTLINE_IT* outline_it);
 CRACKEDGE *h_edge(int sign,                  // sign of edge
                   CRACKEDGE * join,          // edge to join to
@@ -63,6 +65,7 @@ CRACKEDGE *v_edge(int sign,                  // sign of edge
 void join_edges(CRACKEDGE *edge1,            // edges to join
                 CRACKEDGE *edge2,            // no specific order
                 CRACKEDGE **free_cracks,
+                inT32 max_edge_length,
                 C_OUTLINE_IT* outline_it);
 void free_crackedges(CRACKEDGE *start);
 
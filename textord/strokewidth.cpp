@@ -43,14 +43,6 @@
 namespace tesseract {
 
 INT_VAR(textord_tabfind_show_strokewidths, 0, "Show stroke widths");
-BOOL_VAR(textord_tabfind_only_strokewidths, false, "Only run stroke widths");
-BOOL_VAR(textord_tabfind_vertical_text, true, "Enable vertical detection");
-BOOL_VAR(textord_tabfind_force_vertical_text, false,
-         "Force using vertical text page mode");
-BOOL_VAR(textord_tabfind_vertical_horizontal_mix, true,
-         "find horizontal lines such as headers in vertical page mode");
-double_VAR(textord_tabfind_vertical_text_ratio, 0.5,
-           "Fraction of textlines deemed vertical to use vertical page mode");
 
 /** Allowed proportional change in stroke width to be the same font. */
 const double kStrokeWidthFractionTolerance = 0.125;
@@ -121,7 +113,8 @@ const double kNeighbourSearchFactor = 2.5;
 StrokeWidth::StrokeWidth(int gridsize,
                          const ICOORD& bleft, const ICOORD& tright)
   : BlobGrid(gridsize, bleft, tright), nontext_map_(NULL), projection_(NULL),
-    denorm_(NULL), grid_box_(bleft, tright), rerotation_(1.0f, 0.0f) {
+    denorm_(NULL), grid_box_(bleft, tright), rerotation_(1.0f, 0.0f),
+    only_strokewidths_(false) {
   leaders_win_ = NULL;
   widths_win_ = NULL;
   initial_widths_win_ = NULL;
@@ -136,7 +129,7 @@ StrokeWidth::~StrokeWidth() {
     #ifndef GRAPHICS_DISABLED
     delete widths_win_->AwaitEvent(SVET_DESTROY);
     #endif  // GRAPHICS_DISABLED
-    if (textord_tabfind_only_strokewidths)
+    if (only_strokewidths_)
       exit(0);
     delete widths_win_;
   }
@@ -154,10 +147,12 @@ StrokeWidth::~StrokeWidth() {
 void StrokeWidth::SetNeighboursOnMediumBlobs(TO_BLOCK* block) {
   // Run a preliminary strokewidth neighbour detection on the medium blobs.
   InsertBlobList(&block->blobs);
+  GenericVector<BLOBNBOX*> blobs;
   BLOBNBOX_IT blob_it(&block->blobs);
   for (blob_it.mark_cycle_pt(); !blob_it.cycled_list(); blob_it.forward()) {
-    SetNeighbours(false, false, blob_it.data());
+    blobs.push_back(blob_it.data());
   }
+  SetNeighboursOnBlobs(false, false, &blobs);
   Clear();
 }
 
@@ -216,11 +211,9 @@ static void CollectHorizVertBlobs(BLOBNBOX_LIST* input_blobs,
 // after rotating everything, otherwise the work done here will be enough.
 // If osd_blobs is not null, a list of blobs from the dominant textline
 // direction are returned for use in orientation and script detection.
-bool StrokeWidth::TestVerticalTextDirection(TO_BLOCK* block,
+bool StrokeWidth::TestVerticalTextDirection(double find_vertical_text_ratio,
+                                            TO_BLOCK* block,
                                             BLOBNBOX_CLIST* osd_blobs) {
-  if (textord_tabfind_force_vertical_text) return true;
-  if (!textord_tabfind_vertical_text) return false;
-
   int vertical_boxes = 0;
   int horizontal_boxes = 0;
   // Count vertical normal and large blobs.
@@ -243,7 +236,7 @@ bool StrokeWidth::TestVerticalTextDirection(TO_BLOCK* block,
     return false;
   }
   int min_vert_boxes = static_cast<int>((vertical_boxes + horizontal_boxes) *
-                                        textord_tabfind_vertical_text_ratio);
+                                        find_vertical_text_ratio);
   if (vertical_boxes >= min_vert_boxes) {
     if (osd_blobs != NULL) {
       BLOBNBOX_C_IT osd_it(osd_blobs);
@@ -453,10 +446,12 @@ void StrokeWidth::FindLeadersAndMarkNoise(TO_BLOCK* block,
   BlobGridSearch gsearch(this);
   BLOBNBOX* bbox;
   // For every bbox in the grid, set its neighbours.
+  GenericVector<BLOBNBOX*> blobs;
   gsearch.StartFullSearch();
   while ((bbox = gsearch.NextFullSearch()) != NULL) {
-    SetNeighbours(true, false, bbox);
+    blobs.push_back(bbox);
   }
+  SetNeighboursOnBlobs(true, false, &blobs);
   ColPartition_IT part_it(leader_parts);
   gsearch.StartFullSearch();
   while ((bbox = gsearch.NextFullSearch()) != NULL) {
@@ -805,10 +800,12 @@ void StrokeWidth::FindTextlineFlowDirection(bool display_if_debugging) {
   BlobGridSearch gsearch(this);
   BLOBNBOX* bbox;
   // For every bbox in the grid, set its neighbours.
+  GenericVector<BLOBNBOX*> blobs;
   gsearch.StartFullSearch();
   while ((bbox = gsearch.NextFullSearch()) != NULL) {
-    SetNeighbours(false, display_if_debugging, bbox);
+    blobs.push_back(bbox);
   }
+  SetNeighboursOnBlobs(false, display_if_debugging, &blobs);
   // Where vertical or horizontal wins by a big margin, clarify it.
   gsearch.StartFullSearch();
   while ((bbox = gsearch.NextFullSearch()) != NULL) {
@@ -844,6 +841,22 @@ void StrokeWidth::FindTextlineFlowDirection(bool display_if_debugging) {
   }
 }
 
+// Calls SetNeighbours on each of the given blobs, which must be in the grid.
+// SetNeighbours only writes to the blob it is given, and only reads the
+// boxes, stroke widths and rules of the others, none of which change here,
+// so the blobs are independent and can be shared between threads, with the
+// same result as the serial loop.
+void StrokeWidth::SetNeighboursOnBlobs(bool leaders, bool activate_line_trap,
+                                       GenericVector<BLOBNBOX*>* blobs) {
+  int num_blobs = blobs->size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif  // _OPENMP
+  for (int b = 0; b < num_blobs; ++b) {
+    SetNeighbours(leaders, activate_line_trap, (*blobs)[b]);
+  }
+}
+
 // Sets the neighbours and good_stroke_neighbours members of the blob by
 // searching close on all 4 sides.
 // When finding leader dots/dashes, there is a slightly different rule for
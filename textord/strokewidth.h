@@ -51,6 +51,12 @@ class StrokeWidth : public BlobGrid {
   StrokeWidth(int gridsize, const ICOORD& bleft, const ICOORD& tright);
   virtual ~StrokeWidth();
 
+  // Sets whether to exit the program once the stroke widths window is
+  // closed, so that only the stroke widths are run.
+  void set_only_strokewidths(bool only_strokewidths) {
+    only_strokewidths_ = only_strokewidths;
+  }
+
   // Sets the neighbours member of the medium-sized blobs in the block.
   // Searches on 4 sides of each blob for similar-sized, similar-strokewidth
   // blobs and sets pointers to the good neighbours.
@@ -78,7 +84,9 @@ class StrokeWidth : public BlobGrid {
   // after rotating everything, otherwise the work done here will be enough.
   // If osd_blobs is not null, a list of blobs from the dominant textline
   // direction are returned for use in orientation and script detection.
-  bool TestVerticalTextDirection(TO_BLOCK* block,
+  // find_vertical_text_ratio is the minimum fraction of vertical blobs.
+  bool TestVerticalTextDirection(double find_vertical_text_ratio,
+                                 TO_BLOCK* block,
                                  BLOBNBOX_CLIST* osd_blobs);
 
   // Corrects the data structures for the given rotation.
@@ -164,6 +172,11 @@ class StrokeWidth : public BlobGrid {
   // so display_if_debugging is true on the final call to display the results.
   void FindTextlineFlowDirection(bool display_if_debugging);
 
+  // Calls SetNeighbours on each of the given blobs, which must be in the grid,
+  // using multiple threads if available.
+  void SetNeighboursOnBlobs(bool leaders, bool activate_line_trap,
+                            GenericVector<BLOBNBOX*>* blobs);
+
   // Sets the neighbours and good_stroke_neighbours members of the blob by
   // searching close on all 4 sides.
   // When finding leader dots/dashes, there is a slightly different rule for
@@ -289,6 +302,8 @@ class StrokeWidth : public BlobGrid {
   TBOX grid_box_;
   // Rerotation to get back to the original image.
   FCOORD rerotation_;
+  // Exit after showing the stroke widths. See set_only_strokewidths.
+  bool only_strokewidths_;
   // Windows for debug display.
   ScrollView* leaders_win_;
   ScrollView* initial_widths_win_;
@@ -83,15 +83,14 @@ const double kCosMaxSkewAngle = 0.866025;
 
 BOOL_VAR(textord_tabfind_show_initialtabs, false, "Show tab candidates");
 BOOL_VAR(textord_tabfind_show_finaltabs, false, "Show tab vectors");
-double_VAR(textord_tabfind_aligned_gap_fraction, 0.75,
-           "Fraction of height used as a minimum gap for aligned blobs.");
 
 TabFind::TabFind(int gridsize, const ICOORD& bleft, const ICOORD& tright,
                  TabVector_LIST* vlines, int vertical_x, int vertical_y,
-                 int resolution)
+                 int resolution, double aligned_gap_fraction)
   : AlignedBlob(gridsize, bleft, tright),
     resolution_(resolution),
-    image_origin_(0, tright.y() - 1) {
+    image_origin_(0, tright.y() - 1),
+    aligned_gap_fraction_(aligned_gap_fraction) {
   width_cb_ = NULL;
   v_it_.set_to_list(&vectors_);
   v_it_.add_list_after(vlines);
@@ -643,7 +642,7 @@ bool TabFind::TestBoxForTabs(BLOBNBOX* bbox, int min_gutter_width) {
   // increased under the assumption that column partition is always larger
   // than line spacing.
   int min_spacing =
-      static_cast<int>(height * textord_tabfind_aligned_gap_fraction);
+      static_cast<int>(height * aligned_gap_fraction_);
   if (min_gutter_width > min_spacing)
     min_spacing = min_gutter_width;
   int min_ragged_gutter = kRaggedGutterMultiple * gridsize();
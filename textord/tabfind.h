@@ -25,15 +25,6 @@
 #include "tabvector.h"
 #include "linefind.h"
 
-extern BOOL_VAR_H(textord_tabfind_force_vertical_text, false,
-       "Force using vertical text page mode");
-extern BOOL_VAR_H(textord_tabfind_vertical_horizontal_mix, true,
-       "find horizontal lines such as headers in vertical page mode");
-extern double_VAR_H(textord_tabfind_vertical_text_ratio, 0.5,
-       "Fraction of textlines deemed vertical to use vertical page mode");
-extern double_VAR_H(textord_tabfind_aligned_gap_fraction, 0.75,
-       "Fraction of height used as a minimum gap for aligned blobs.");
-
 class BLOBNBOX;
 class BLOBNBOX_LIST;
 class TO_BLOCK;
@@ -63,7 +54,7 @@ class TabFind : public AlignedBlob {
  public:
   TabFind(int gridsize, const ICOORD& bleft, const ICOORD& tright,
           TabVector_LIST* vlines, int vertical_x, int vertical_y,
-          int resolution);
+          int resolution, double aligned_gap_fraction);
   virtual ~TabFind();
 
   /**
@@ -360,6 +351,7 @@ class TabFind : public AlignedBlob {
   int resolution_;                //< Of source image in pixels per inch.
  private:
   ICOORD image_origin_;           //< Top-left of image in deskewed coords
+  double aligned_gap_fraction_;   //< Min gutter as a fraction of height.
   TabVector_LIST vectors_;        //< List of rule line and tabstops.
   TabVector_IT v_it_;             //< Iterator for searching vectors_.
   TabVector_LIST dead_vectors_;   //< Separators and unpartnered tab vectors.
@@ -107,6 +107,10 @@ const int kSideSpaceMargin = 10;
 // threshold for the x-projection histogram
 const double kSmallTableProjectionThreshold = 0.35;
 const double kLargeTableProjectionThreshold = 0.45;
+// Minimum number of text partitions that look like table cells for
+// PageMayContainTables to allow table detection to run.
+const int kMinTableEvidenceParts = 2;
+
 // Minimum number of rows required to look for more rows in the projection.
 const int kLargeTableRowCount = 6;
 
@@ -153,8 +157,6 @@ BOOL_VAR(textord_tablefind_show_mark, false,
          "Debug table marking steps in detail");
 BOOL_VAR(textord_tablefind_show_stats, false,
          "Show page stats used in table finding");
-BOOL_VAR(textord_tablefind_recognize_tables, false,
-         "Enables the table recognizer for table layout and filtering.");
 
 ELISTIZE(ColSegment)
 CLISTIZE(ColSegment)
@@ -170,7 +172,8 @@ TableFinder::TableFinder()
       global_median_xheight_(0),
       global_median_blob_width_(0),
       global_median_ledding_(0),
-      left_to_right_language_(true) {
+      left_to_right_language_(true),
+      recognize_tables_(false) {
 }
 
 TableFinder::~TableFinder() {
@@ -197,6 +200,66 @@ void TableFinder::Init(int grid_size, const ICOORD& bottom_left,
   table_grid_.Init(grid_size, bottom_left, top_right);
 }
 
+// Returns true if part has a gap between blobs wider than any gap between
+// words of running text.
+static bool HasWideGap(ColPartition* part) {
+  const double max_gap = kMaxGapInTextPartition * part->median_size();
+  int previous_x1 = -MAX_INT32;
+  BLOBNBOX_C_IT it(part->boxes());
+  for (it.mark_cycle_pt(); !it.cycled_list(); it.forward()) {
+    const TBOX& box = it.data()->bounding_box();
+    if (previous_x1 != -MAX_INT32 && box.left() - previous_x1 > max_gap)
+      return true;
+    previous_x1 = MAX(previous_x1, box.right());
+  }
+  return false;
+}
+
+// Cheap test of whether the page in grid could have any tables.
+bool TableFinder::PageMayContainTables(ColPartitionGrid* grid,
+                                       ColPartitionSet** all_columns) const {
+  int evidence_count = 0;
+  ColPartitionGridSearch gsearch(grid);
+  gsearch.SetUniqueMode(true);
+  gsearch.StartFullSearch();
+  ColPartition* part = NULL;
+  while ((part = gsearch.NextFullSearch()) != NULL) {
+    if (part->IsLineType() || part->flow() == BTFT_LEADER)
+      return true;
+    if (!part->IsTextType() || part->blob_type() == BRT_NOISE)
+      continue;
+    if (HasWideGap(part)) {
+      ++evidence_count;
+    } else {
+      // Look for another text partition beside part in the same column.
+      const TBOX& box = part->bounding_box();
+      int y = (box.bottom() + box.top()) / 2;
+      int grid_x, grid_y;
+      grid->GridCoords(box.left(), y, &grid_x, &grid_y);
+      ColPartitionSet* columns = all_columns[grid_y];
+      ColPartition* column = columns != NULL ?
+          columns->ColumnContaining((box.left() + box.right()) / 2, y) : NULL;
+      if (column == NULL)
+        continue;
+      ColPartitionGridSearch rsearch(grid);
+      rsearch.StartRectSearch(TBOX(column->LeftAtY(y), box.bottom(),
+                                   column->RightAtY(y), box.top()));
+      ColPartition* neighbour;
+      while ((neighbour = rsearch.NextRectSearch()) != NULL) {
+        const TBOX& n_box = neighbour->bounding_box();
+        if (neighbour != part && neighbour->IsTextType() &&
+            !n_box.x_overlap(box) && n_box.major_y_overlap(box)) {
+          ++evidence_count;
+          break;
+        }
+      }
+    }
+    if (evidence_count >= kMinTableEvidenceParts)
+      return true;
+  }
+  return false;
+}
+
 // Copy cleaned partitions from part_grid_ to clean_part_grid_ and
 // insert leaders and rulers into the leader_and_ruling_grid_
 void TableFinder::InsertCleanPartitions(ColPartitionGrid* grid,
@@ -326,7 +389,7 @@ void TableFinder::LocateTables(ColPartitionGrid* grid,
   AdjustTableBoundaries();
   GridMergeTableRegions();
 
-  if (textord_tablefind_recognize_tables) {
+  if (recognize_tables_) {
     // Remove false alarms consiting of a single column
     DeleteSingleColumnTables();
 
@@ -1834,16 +1897,30 @@ void TableFinder::RecognizeTables() {
   ColSegment_CLIST good_tables;
   ColSegment_C_IT good_it(&good_tables);
 
+  GenericVector<ColSegment*> found_tables;
   ColSegmentGridSearch gsearch(&table_grid_);
   gsearch.StartFullSearch();
   ColSegment* found_table = NULL;
   while ((found_table = gsearch.NextFullSearch()) != NULL) {
     gsearch.RemoveBBox();
-
-    // The goal is to make the tables persistent in a list.
-    // When that happens, this will move into the search loop.
-    const TBOX& found_box = found_table->bounding_box();
-    StructuredTable* table_structure = recognizer.RecognizeTable(found_box);
+    found_tables.push_back(found_table);
+  }
+  // The recognizer only reads the text and line grids, so each table can be
+  // recognized independently. The results are then processed in the
+  // original order, so the outcome does not depend on the threading.
+  int num_tables = found_tables.size();
+  GenericVector<StructuredTable*> table_structures;
+  table_structures.init_to_size(num_tables, NULL);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif  // _OPENMP
+  for (int t = 0; t < num_tables; ++t) {
+    table_structures[t] =
+        recognizer.RecognizeTable(found_tables[t]->bounding_box());
+  }
+  for (int t = 0; t < num_tables; ++t) {
+    found_table = found_tables[t];
+    StructuredTable* table_structure = table_structures[t];
 
     // Process a table. Good tables are inserted into the grid again later on
     // We can't change boxes in the grid while it is running a search.
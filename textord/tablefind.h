@@ -140,10 +140,24 @@ class TableFinder {
   }
   // Change the reading order. Initially it is left to right.
   void set_left_to_right_language(bool order);
+  // Enable the table recognizer for table layout and filtering.
+  // Initially it is off.
+  void set_recognize_tables(bool recognize) {
+    recognize_tables_ = recognize;
+  }
 
   // Initialize
   void Init(int grid_size, const ICOORD& bottom_left, const ICOORD& top_right);
 
+  // Cheap test of whether the page in grid could have any tables, run before
+  // InsertCleanPartitions so that pages of plain running text can skip table
+  // detection altogether. Returns true if there are any ruling lines or
+  // leaders, or at least kMinTableEvidenceParts text partitions that look
+  // like table cells: partitions with a wide gap inside, or with another
+  // partition beside them in the same column.
+  bool PageMayContainTables(ColPartitionGrid* grid,
+                            ColPartitionSet** all_columns) const;
+
   // Copy cleaned partitions from ColumnFinder's part_grid_ to this
   // clean_part_grid_ and insert dot-like noise into period_grid_.
   // It resizes the grids in this object to the dimensions of grid.
@@ -428,6 +442,8 @@ class TableFinder {
   ColSegmentGrid table_grid_;
   // The reading order of text. Defaults to true, for languages such as English.
   bool left_to_right_language_;
+  // Whether LocateTables runs the table recognizer.
+  bool recognize_tables_;
 };
 
 }  // namespace tesseract.
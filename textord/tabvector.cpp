@@ -55,12 +55,6 @@ const double kMinAlignedGutter = 0.25;
 // Constant add-on for minimum gutter for ragged tabs.
 const double kMinRaggedGutter = 1.5;
 
-double_VAR(textord_tabvector_vertical_gap_fraction, 0.5,
-  "max fraction of mean blob width allowed for vertical gaps in vertical text");
-
-double_VAR(textord_tabvector_vertical_box_ratio, 0.5,
-  "Fraction of box matches required to declare a line vertical");
-
 ELISTIZE(TabConstraint)
 
 // Create a constraint for the top or bottom of this TabVector.
@@ -886,7 +880,8 @@ TabVector* TabVector::GetSinglePartner() {
 
 // Return the partner of this TabVector if the vector qualifies as
 // being a vertical text line, otherwise NULL.
-TabVector* TabVector::VerticalTextlinePartner() {
+TabVector* TabVector::VerticalTextlinePartner(double vertical_gap_fraction,
+                                              double vertical_box_ratio) {
   if (!partners_.singleton())
     return NULL;
   TabVector_C_IT partner_it(&partners_);
@@ -928,9 +923,9 @@ TabVector* TabVector::VerticalTextlinePartner() {
     prev_bbox = bbox;
   }
   double avg_width = total_widths * 1.0 / (num_unmatched + num_matched);
-  double max_gap = textord_tabvector_vertical_gap_fraction * avg_width;
+  double max_gap = vertical_gap_fraction * avg_width;
   int min_box_match = static_cast<int>((num_matched + num_unmatched) *
-                                       textord_tabvector_vertical_box_ratio);
+                                       vertical_box_ratio);
   bool is_vertical = (gaps.get_total() > 0 &&
                       num_matched >= min_box_match &&
                       gaps.median() <= max_gap);
@@ -32,12 +32,6 @@ class ScrollView;
 
 namespace tesseract {
 
-
-extern double_VAR_H(textord_tabvector_vertical_gap_fraction, 0.5,
-  "Max fraction of mean blob width allowed for vertical gaps in vertical text");
-extern double_VAR_H(textord_tabvector_vertical_box_ratio, 0.5,
-  "Fraction of box matches required to declare a line vertical");
-
 // The alignment type that a tab vector represents.
 // Keep this enum synced with kAlignmentNames in tabvector.cpp.
 enum TabAlignment {
@@ -261,6 +255,19 @@ class TabVector : public ELIST2_LINK {
     endpt_.set_x(x);
   }
 
+  // Scale the vector up by the given factor, as when it was found on an image
+  // reduced by that factor.
+  void ScaleUp(int factor) {
+    startpt_.set_x(startpt_.x() * factor);
+    startpt_.set_y(startpt_.y() * factor);
+    endpt_.set_x(endpt_.x() * factor);
+    endpt_.set_y(endpt_.y() * factor);
+    extended_ymin_ *= factor;
+    extended_ymax_ *= factor;
+    sort_key_ *= factor;
+    mean_width_ *= factor;
+  }
+
   // Reflect the tab vector in the y-axis.
   void ReflectInYAxis() {
     startpt_.set_x(-startpt_.x());
@@ -374,7 +381,11 @@ class TabVector : public ELIST2_LINK {
 
   // Return the partner of this TabVector if the vector qualifies as
   // being a vertical text line, otherwise NULL.
-  TabVector* VerticalTextlinePartner();
+  // vertical_gap_fraction is the max fraction of the mean blob width allowed
+  // for the median vertical gap, and vertical_box_ratio is the fraction of
+  // boxes that must match between the partners.
+  TabVector* VerticalTextlinePartner(double vertical_gap_fraction,
+                                     double vertical_box_ratio);
 
   // Return the matching tabvector if there is exactly one partner, or
   // NULL otherwise.  This can be used after matching is done, eg. by
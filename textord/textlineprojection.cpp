@@ -39,13 +39,14 @@ const int kMaxTabStopOverrun = 6;
 namespace tesseract {
 
 TextlineProjection::TextlineProjection(int resolution)
-  : x_origin_(0), y_origin_(0), pix_(NULL) {
+  : x_origin_(0), y_origin_(0), pix_(NULL), integral_(NULL) {
   // The projection map should be about 100 ppi, whatever the input.
   scale_factor_ = IntCastRounded(resolution / 100.0);
   if (scale_factor_ < 1) scale_factor_ = 1;
 }
 TextlineProjection::~TextlineProjection() {
   pixDestroy(&pix_);
+  delete [] integral_;
 }
 
 // Build the projection profile given the input_block containing lists of
@@ -66,12 +67,22 @@ void TextlineProjection::ConstructProjection(TO_BLOCK* input_block,
   int height = (image_box.height() + scale_factor_ - 1) / scale_factor_;
 
   pix_ = pixCreate(width, height, 8);
-  ProjectBlobs(&input_block->blobs, rotation, image_box, nontext_map);
-  ProjectBlobs(&input_block->large_blobs, rotation, image_box, nontext_map);
+  // The blob boxes are accumulated in a difference array and summed into
+  // pix_ in a single pass, rather than incrementing every pixel of every box.
+  int increments_size = (width + 1) * (height + 1);
+  inT32* increments = new inT32[increments_size];
+  memset(increments, 0, increments_size * sizeof(*increments));
+  ProjectBlobs(&input_block->blobs, rotation, image_box, nontext_map,
+               increments);
+  ProjectBlobs(&input_block->large_blobs, rotation, image_box, nontext_map,
+               increments);
+  ApplyIncrements(increments);
+  delete [] increments;
   Pix* final_pix = pixBlockconv(pix_, 1, 1);
 //  Pix* final_pix = pixBlockconv(pix_, 2, 2);
   pixDestroy(&pix_);
   pix_ = final_pix;
+  ComputeIntegralImage();
 }
 
 // Display the blobs in the window colored according to textline quality.
@@ -541,6 +552,15 @@ int TextlineProjection::MeanPixelsInLineSegment(const DENORM* denorm,
     x_delta = end_pt.x - start_pt.x;
     y_delta = end_pt.y - start_pt.y;
     count = x_delta * x_step + 1;
+    if (y_delta == 0) {
+      // Axis-aligned, so the integral image gives the sum directly.
+      // As in the loop below, end_pt itself is not included.
+      if (x_step > 0)
+        total = RectangleSum(start_pt.x, start_pt.y, end_pt.x - 1, end_pt.y);
+      else
+        total = RectangleSum(end_pt.x + 1, start_pt.y, start_pt.x, end_pt.y);
+      return DivRounded(total, count);
+    }
     for (int x = start_pt.x; x != end_pt.x; x += x_step) {
       int y = start_pt.y + DivRounded(y_delta * (x - start_pt.x), x_delta);
       total += GET_DATA_BYTE(data + wpl * y, x);
@@ -558,6 +578,13 @@ int TextlineProjection::MeanPixelsInLineSegment(const DENORM* denorm,
     x_delta = end_pt.x - start_pt.x;
     y_delta = end_pt.y - start_pt.y;
     count = y_delta * y_step + 1;
+    if (x_delta == 0) {
+      if (y_step > 0)
+        total = RectangleSum(start_pt.x, start_pt.y, end_pt.x, end_pt.y - 1);
+      else
+        total = RectangleSum(end_pt.x, end_pt.y + 1, start_pt.x, start_pt.y);
+      return DivRounded(total, count);
+    }
     for (int y = start_pt.y; y != end_pt.y; y += y_step) {
       int x = start_pt.x + DivRounded(x_delta * (y - start_pt.y), y_delta);
       total += GET_DATA_BYTE(data + wpl * y, x);
@@ -621,26 +648,87 @@ static void TruncateBoxToMissNonText(int x_middle, int y_middle,
 }
 
 
+// Returns the sum of the pixels of pix_ in the rectangle from (x1, y1) to
+// (x2, y2) inclusive, in pix_ coordinates, using the integral image.
+int TextlineProjection::RectangleSum(int x1, int y1, int x2, int y2) const {
+  int stride = pixGetWidth(pix_) + 1;
+  const uinT32* top = integral_ + y1 * stride;
+  const uinT32* bottom = integral_ + (y2 + 1) * stride;
+  // Unsigned arithmetic, so the differences are right even if the corner
+  // sums have wrapped on a huge image.
+  return bottom[x2 + 1] - bottom[x1] - top[x2 + 1] + top[x1];
+}
+
+// Computes integral_ from pix_.
+void TextlineProjection::ComputeIntegralImage() {
+  delete [] integral_;
+  int width = pixGetWidth(pix_);
+  int height = pixGetHeight(pix_);
+  int stride = width + 1;
+  integral_ = new uinT32[stride * (height + 1)];
+  memset(integral_, 0, stride * sizeof(*integral_));
+  int wpl = pixGetWpl(pix_);
+  uinT32* data = pixGetData(pix_);
+  uinT32* prev_row = integral_;
+  for (int y = 0; y < height; ++y, data += wpl) {
+    uinT32* row = prev_row + stride;
+    uinT32 row_sum = 0;
+    row[0] = 0;
+    for (int x = 0; x < width; ++x) {
+      row_sum += GET_DATA_BYTE(data, x);
+      row[x + 1] = row_sum;
+    }
+    // Independent adds that the compiler can vectorize.
+    for (int x = 1; x <= width; ++x)
+      row[x] += prev_row[x];
+    prev_row = row;
+  }
+}
+
 // Helper function to add 1 to a rectangle in source image coords to the
-// internal projection pix_.
-void TextlineProjection::IncrementRectangle8Bit(const TBOX& box) {
+// difference array of increments, which has one more column and row than
+// pix_. The counts are only made real by ApplyIncrements.
+void TextlineProjection::IncrementRectangle(const TBOX& box,
+                                            inT32* increments) {
   int scaled_left = ImageXToProjectionX(box.left());
   int scaled_top = ImageYToProjectionY(box.top());
   int scaled_right = ImageXToProjectionX(box.right());
   int scaled_bottom = ImageYToProjectionY(box.bottom());
+  int stride = pixGetWidth(pix_) + 1;
+  inT32* top = increments + scaled_top * stride;
+  inT32* bottom = increments + (scaled_bottom + 1) * stride;
+  ++top[scaled_left];
+  --top[scaled_right + 1];
+  --bottom[scaled_left];
+  ++bottom[scaled_right + 1];
+}
+
+// Sums the difference array of increments into the 8-bit pix_, saturating
+// at 255.
+void TextlineProjection::ApplyIncrements(inT32* increments) {
+  int width = pixGetWidth(pix_);
+  int height = pixGetHeight(pix_);
+  int stride = width + 1;
   int wpl = pixGetWpl(pix_);
-  uinT32* data = pixGetData(pix_) + scaled_top * wpl;
-  for (int y = scaled_top; y <= scaled_bottom; ++y) {
-    for (int x = scaled_left; x <= scaled_right; ++x) {
-      int pixel = GET_DATA_BYTE(data, x);
-      if (pixel < 255)
-        SET_DATA_BYTE(data, x, pixel + 1);
+  uinT32* data = pixGetData(pix_);
+  inT32* prev_row = NULL;
+  inT32* row = increments;
+  for (int y = 0; y < height; ++y, data += wpl, row += stride) {
+    // Accumulating down the columns first is a vectorizable add of rows.
+    if (prev_row != NULL) {
+      for (int x = 0; x < width; ++x)
+        row[x] += prev_row[x];
+    }
+    prev_row = row;
+    inT32 count = 0;
+    for (int x = 0; x < width; ++x) {
+      count += row[x];
+      SET_DATA_BYTE(data, x, MIN(count, 255));
     }
-    data += wpl;
   }
 }
 
-// Inserts a list of blobs into the projection.
+// Inserts a list of blobs into the increments.
 // Rotation is a multiple of 90 degrees to get from blob coords to
 // nontext_map coords, nontext_map_box is the bounds of the nontext_map.
 // Blobs are spread horizontally or vertically according to their internal
@@ -649,7 +737,8 @@ void TextlineProjection::IncrementRectangle8Bit(const TBOX& box) {
 void TextlineProjection::ProjectBlobs(BLOBNBOX_LIST* blobs,
                                       const FCOORD& rotation,
                                       const TBOX& nontext_map_box,
-                                      Pix* nontext_map) {
+                                      Pix* nontext_map,
+                                      inT32* increments) {
   BLOBNBOX_IT blob_it(blobs);
   for (blob_it.mark_cycle_pt(); !blob_it.cycled_list(); blob_it.forward()) {
     BLOBNBOX* blob = blob_it.data();
@@ -668,7 +757,7 @@ void TextlineProjection::ProjectBlobs(BLOBNBOX_LIST* blobs,
     TruncateBoxToMissNonText(middle.x(), middle.y(), spreading_horizontally,
                              nontext_map, &bbox);
     if (bbox.area() > 0) {
-      IncrementRectangle8Bit(bbox);
+      IncrementRectangle(bbox, increments);
     }
   }
 }
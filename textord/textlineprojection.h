@@ -161,17 +161,28 @@ class TextlineProjection {
   int MeanPixelsInLineSegment(const DENORM* denorm, int offset,
                               TPOINT start_pt, TPOINT end_pt) const;
 
+  // Returns the sum of the pixels of pix_ in the rectangle from (x1, y1) to
+  // (x2, y2) inclusive, in pix_ coordinates, using the integral image.
+  int RectangleSum(int x1, int y1, int x2, int y2) const;
+  // Computes integral_ from pix_.
+  void ComputeIntegralImage();
+
   // Helper function to add 1 to a rectangle in source image coords to the
-  // internal projection pix_.
-  void IncrementRectangle8Bit(const TBOX& box);
-  // Inserts a list of blobs into the projection.
+  // difference array of increments, which has one more column and row than
+  // pix_. The counts are only made real by ApplyIncrements.
+  void IncrementRectangle(const TBOX& box, inT32* increments);
+  // Sums the difference array of increments into the 8-bit pix_, saturating
+  // at 255.
+  void ApplyIncrements(inT32* increments);
+  // Inserts a list of blobs into the increments.
   // Rotation is a multiple of 90 degrees to get from blob coords to
   // nontext_map coords, image_box is the bounds of the nontext_map.
   // Blobs are spread horizontally or vertically according to their internal
   // flags, but the spreading is truncated by set pixels in the nontext_map
   // and also by the horizontal rule line limits on the blobs.
   void ProjectBlobs(BLOBNBOX_LIST* blobs, const FCOORD& rotation,
-                    const TBOX& image_box, Pix* nontext_map);
+                    const TBOX& image_box, Pix* nontext_map,
+                    inT32* increments);
   // Pads the bounding box of the given blob according to whether it is on
   // a horizontal or vertical text line, taking into account tab-stops near
   // the blob. Returns true if padding was in the horizontal direction.
@@ -199,6 +210,10 @@ class TextlineProjection {
   // textline density map. As with a horizontal projection, the map has
   // dips in the gaps between textlines.
   Pix* pix_;
+  // Integral image of pix_, with one more column and row than pix_.
+  // Entry (x, y) holds the sum of all the pixels of pix_ above and to the
+  // left of (x, y), so any rectangle sum is just 4 lookups.
+  uinT32* integral_;
 };
 
 }  // namespace tesseract.
@@ -37,6 +37,131 @@ Textord::Textord(CCStruct* ccstruct)
       BOOL_MEMBER(textord_single_height_mode, false,
                   "Script has no xheight, so use a single mode",
                   ccstruct_->params()),
+      BOOL_MEMBER(textord_heavy_nr, FALSE, "Vigorously remove noise",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_show_initial_rows, FALSE, "Display row accumulation",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_show_parallel_rows, FALSE,
+                  "Display page correlated rows",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_show_expanded_rows, FALSE,
+                  "Display rows after expanding",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_show_final_rows, FALSE,
+                  "Display rows after final fitting",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_show_final_blobs, FALSE,
+                  "Display blob bounds after pre-ass",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_test_landscape, FALSE, "Tests refer to land/port",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_parallel_blocks, TRUE,
+                  "Find rows and words in parallel over blocks",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_parallel_baselines, TRUE, "Force parallel baselines",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_straight_baselines, FALSE, "Force straight baselines",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_old_baselines, TRUE, "Use old baseline algorithm",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_old_xheight, FALSE, "Use old xheight algorithm",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_fix_xheight_bug, TRUE, "Use spline baseline",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_fix_makerow_bug, TRUE, "Prevent multiple baselines",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_debug_xheights, FALSE, "Test xheight algorithms",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_biased_skewcalc, TRUE,
+                  "Bias skew estimates with line length",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_interpolating_skew, TRUE, "Interpolate across gaps",
+                  ccstruct_->params()),
+      INT_MEMBER(textord_skewsmooth_offset, 2, "For smooth factor",
+                 ccstruct_->params()),
+      INT_MEMBER(textord_skewsmooth_offset2, 1, "For smooth factor",
+                 ccstruct_->params()),
+      INT_MEMBER(textord_test_x, -1, "coord of test pt",
+                 ccstruct_->params()),
+      INT_MEMBER(textord_test_y, -1, "coord of test pt",
+                 ccstruct_->params()),
+      INT_MEMBER(textord_min_blobs_in_row, 4,
+                 "Min blobs before gradient counted",
+                 ccstruct_->params()),
+      INT_MEMBER(textord_spline_minblobs, 8, "Min blobs in each spline segment",
+                 ccstruct_->params()),
+      INT_MEMBER(textord_spline_medianwin, 6,
+                 "Size of window for spline segmentation",
+                 ccstruct_->params()),
+      INT_MEMBER(textord_max_blob_overlaps, 4,
+                 "Max number of blobs a big blob can overlap",
+                 ccstruct_->params()),
+      INT_MEMBER(textord_min_xheight, 10, "Min credible pixel xheight",
+                 ccstruct_->params()),
+      double_MEMBER(textord_spline_shift_fraction, 0.02,
+                    "Fraction of line spacing for quad",
+                    ccstruct_->params()),
+      double_MEMBER(textord_spline_outlier_fraction, 0.1,
+                    "Fraction of line spacing for outlier",
+                    ccstruct_->params()),
+      double_MEMBER(textord_skew_ile, 0.5, "Ile of gradients for page skew",
+                    ccstruct_->params()),
+      double_MEMBER(textord_skew_lag, 0.01, "Lag for skew on row accumulation",
+                    ccstruct_->params()),
+      double_MEMBER(textord_linespace_iqrlimit, 0.2,
+                    "Max iqr/median for linespace",
+                    ccstruct_->params()),
+      double_MEMBER(textord_width_limit, 8, "Max width of blobs to make rows",
+                    ccstruct_->params()),
+      double_MEMBER(textord_chop_width, 1.5, "Max width before chopping",
+                    ccstruct_->params()),
+      double_MEMBER(textord_expansion_factor, 1.0,
+                    "Factor to expand rows by in expand_rows",
+                    ccstruct_->params()),
+      double_MEMBER(textord_overlap_x, 0.5,
+                    "Fraction of linespace for good overlap",
+                    ccstruct_->params()),
+      double_MEMBER(textord_minxh, 0.25, "fraction of linesize for min xheight",
+                    ccstruct_->params()),
+      double_MEMBER(textord_min_linesize, 1.25,
+                    "* blob height for initial linesize",
+                    ccstruct_->params()),
+      double_MEMBER(textord_excess_blobsize, 1.3,
+                    "New row made if blob makes row this big",
+                    ccstruct_->params()),
+      double_MEMBER(textord_occupancy_threshold, 0.4,
+                    "Fraction of neighbourhood",
+                    ccstruct_->params()),
+      double_MEMBER(textord_underline_width, 2.0,
+                    "Multiple of line_size for underline",
+                    ccstruct_->params()),
+      double_MEMBER(textord_min_blob_height_fraction, 0.75,
+                    "Min blob height/top to include blob top into xheight stats",
+                    ccstruct_->params()),
+      double_MEMBER(textord_xheight_mode_fraction, 0.4,
+                    "Min pile height to make xheight",
+                    ccstruct_->params()),
+      double_MEMBER(textord_ascheight_mode_fraction, 0.08,
+                    "Min pile height to make ascheight",
+                    ccstruct_->params()),
+      double_MEMBER(textord_descheight_mode_fraction, 0.08,
+                    "Min pile height to make descheight",
+                    ccstruct_->params()),
+      double_MEMBER(textord_ascx_ratio_min, 1.25, "Min cap/xheight",
+                    ccstruct_->params()),
+      double_MEMBER(textord_ascx_ratio_max, 1.8, "Max cap/xheight",
+                    ccstruct_->params()),
+      double_MEMBER(textord_descx_ratio_min, 0.25, "Min desc/xheight",
+                    ccstruct_->params()),
+      double_MEMBER(textord_descx_ratio_max, 0.6, "Max desc/xheight",
+                    ccstruct_->params()),
+      double_MEMBER(textord_xheight_error_margin, 0.1, "Accepted variation",
+                    ccstruct_->params()),
+      INT_MEMBER(textord_lms_line_trials, 12, "Number of linew fits to do",
+                 ccstruct_->params()),
+      BOOL_MEMBER(textord_new_initial_xheight, TRUE,
+                  "Use test xheight mechanism",
+                  ccstruct_->params()),
       // tospace.cpp ///////////////////////////////////////////
       BOOL_MEMBER(tosp_old_to_method, false, "Space stats use prechopping?",
                   ccstruct_->params()),
@@ -255,7 +380,246 @@ Textord::Textord(CCStruct* ccstruct)
                     ccstruct_->params()),
       double_MEMBER(textord_blshift_xfraction, 9.99,
                     "Min size of baseline shift",
-                    ccstruct_->params()) {
+                    ccstruct_->params()),
+      // edgblob.cpp ///////////////////////////////////////////
+      BOOL_MEMBER(edges_use_new_outline_complexity, FALSE,
+                  "Use the new outline complexity module",
+                  ccstruct_->params()),
+      INT_MEMBER(edges_max_children_per_outline, 10,
+                 "Max number of children inside a character outline",
+                 ccstruct_->params()),
+      INT_MEMBER(edges_max_children_layers, 5,
+                 "Max layers of nested children inside a character outline",
+                 ccstruct_->params()),
+      BOOL_MEMBER(edges_debug, FALSE, "turn on debugging for this module",
+                  ccstruct_->params()),
+      INT_MEMBER(edges_children_per_grandchild, 10,
+                 "Importance ratio for chucking outlines",
+                 ccstruct_->params()),
+      INT_MEMBER(edges_children_count_limit, 45, "Max holes allowed in blob",
+                 ccstruct_->params()),
+      BOOL_MEMBER(edges_children_fix, FALSE,
+                  "Remove boxy parents of char-like children",
+                  ccstruct_->params()),
+      INT_MEMBER(edges_min_nonhole, 12, "Min pixels for potential char in box",
+                 ccstruct_->params()),
+      INT_MEMBER(edges_patharea_ratio, 40,
+                 "Max lensq/area for acceptable child outline",
+                 ccstruct_->params()),
+      double_MEMBER(edges_childarea, 0.5, "Min area fraction of child outline",
+                    ccstruct_->params()),
+      double_MEMBER(edges_boxarea, 0.875,
+                    "Min area fraction of grandchild for box",
+                    ccstruct_->params()),
+      // edgloop.cpp ///////////////////////////////////////////
+      INT_MEMBER(edges_maxedgelength, 16000, "Max steps in any outline",
+                 ccstruct_->params()),
+      // oldbasel.cpp ///////////////////////////////////////////
+      BOOL_MEMBER(textord_really_old_xheight, FALSE,
+                  "Use original wiseowl xheight",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_oldbl_debug, FALSE, "Debug old baseline generation",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_debug_baselines, FALSE, "Debug baseline generation",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_oldbl_paradef, TRUE, "Use para default mechanism",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_oldbl_split_splines, TRUE, "Split stepped splines",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_oldbl_merge_parts, TRUE, "Merge suspect partitions",
+                  ccstruct_->params()),
+      BOOL_MEMBER(oldbl_corrfix, TRUE, "Improve correlation of heights",
+                  ccstruct_->params()),
+      BOOL_MEMBER(oldbl_xhfix, FALSE, "Fix bug in modes threshold for xheights",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_ocropus_mode, FALSE, "Make baselines for ocropus",
+                  ccstruct_->params()),
+      double_MEMBER(oldbl_xhfract, 0.4, "Fraction of est allowed in calc",
+                    ccstruct_->params()),
+      INT_MEMBER(oldbl_holed_losscount, 10,
+                 "Max lost before fallback line used",
+                 ccstruct_->params()),
+      double_MEMBER(oldbl_dot_error_size, 1.26, "Max aspect ratio of a dot",
+                    ccstruct_->params()),
+      double_MEMBER(textord_oldbl_jumplimit, 0.15,
+                    "X fraction for new partition",
+                    ccstruct_->params()),
+      // tovars.cpp ///////////////////////////////////////////
+      BOOL_MEMBER(textord_show_initial_words, FALSE, "Display separate words",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_show_new_words, FALSE, "Display separate words",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_show_fixed_words, FALSE,
+                  "Display forced fixed pitch words",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_blocksall_fixed, FALSE, "Moan about prop blocks",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_blocksall_prop, FALSE,
+                  "Moan about fixed pitch blocks",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_blocksall_testing, FALSE, "Dump stats when moaning",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_test_mode, FALSE, "Do current test",
+                  ccstruct_->params()),
+      INT_MEMBER(textord_dotmatrix_gap, 3,
+                 "Max pixel gap for broken pixed pitch",
+                 ccstruct_->params()),
+      INT_MEMBER(textord_debug_block, 0, "Block to do debug on",
+                 ccstruct_->params()),
+      INT_MEMBER(textord_pitch_range, 2, "Max range test on pitch",
+                 ccstruct_->params()),
+      double_MEMBER(textord_wordstats_smooth_factor, 0.05,
+                    "Smoothing gap stats",
+                    ccstruct_->params()),
+      double_MEMBER(textord_width_smooth_factor, 0.10, "Smoothing width stats",
+                    ccstruct_->params()),
+      double_MEMBER(textord_words_width_ile, 0.4,
+                    "Ile of blob widths for space est",
+                    ccstruct_->params()),
+      double_MEMBER(textord_words_maxspace, 4.0, "Multiple of xheight",
+                    ccstruct_->params()),
+      double_MEMBER(textord_words_default_maxspace, 3.5,
+                    "Max believable third space",
+                    ccstruct_->params()),
+      double_MEMBER(textord_words_default_minspace, 0.6, "Fraction of xheight",
+                    ccstruct_->params()),
+      double_MEMBER(textord_words_min_minspace, 0.3, "Fraction of xheight",
+                    ccstruct_->params()),
+      double_MEMBER(textord_words_default_nonspace, 0.2, "Fraction of xheight",
+                    ccstruct_->params()),
+      double_MEMBER(textord_words_initial_lower, 0.25,
+                    "Max inital cluster size",
+                    ccstruct_->params()),
+      double_MEMBER(textord_words_initial_upper, 0.15,
+                    "Min initial cluster spacing",
+                    ccstruct_->params()),
+      double_MEMBER(textord_words_minlarge, 0.75,
+                    "Fraction of valid gaps needed",
+                    ccstruct_->params()),
+      double_MEMBER(textord_words_pitchsd_threshold, 0.040,
+                    "Pitch sync threshold",
+                    ccstruct_->params()),
+      double_MEMBER(textord_words_def_fixed, 0.016,
+                    "Threshold for definite fixed",
+                    ccstruct_->params()),
+      double_MEMBER(textord_words_def_prop, 0.090,
+                    "Threshold for definite prop",
+                    ccstruct_->params()),
+      INT_MEMBER(textord_words_veto_power, 5, "Rows required to outvote a veto",
+                 ccstruct_->params()),
+      double_MEMBER(textord_pitch_rowsimilarity, 0.08,
+                    "Fraction of xheight for sameness",
+                    ccstruct_->params()),
+      BOOL_MEMBER(textord_pitch_scalebigwords, FALSE,
+                  "Scale scores on big words",
+                  ccstruct_->params()),
+      double_MEMBER(words_initial_lower, 0.5, "Max inital cluster size",
+                    ccstruct_->params()),
+      double_MEMBER(words_initial_upper, 0.15, "Min initial cluster spacing",
+                    ccstruct_->params()),
+      double_MEMBER(words_default_prop_nonspace, 0.25, "Fraction of xheight",
+                    ccstruct_->params()),
+      double_MEMBER(words_default_fixed_space, 0.75, "Fraction of xheight",
+                    ccstruct_->params()),
+      double_MEMBER(words_default_fixed_limit, 0.6, "Allowed size variance",
+                    ccstruct_->params()),
+      double_MEMBER(textord_words_definite_spread, 0.30,
+                    "Non-fuzzy spacing region",
+                    ccstruct_->params()),
+      double_MEMBER(textord_spacesize_ratiofp, 2.8, "Min ratio space/nonspace",
+                    ccstruct_->params()),
+      double_MEMBER(textord_spacesize_ratioprop, 2.0,
+                    "Min ratio space/nonspace",
+                    ccstruct_->params()),
+      double_MEMBER(textord_fpiqr_ratio, 1.5, "Pitch IQR/Gap IQR threshold",
+                    ccstruct_->params()),
+      double_MEMBER(textord_max_pitch_iqr, 0.20, "Xh fraction noise in pitch",
+                    ccstruct_->params()),
+      double_MEMBER(textord_fp_min_width, 0.5, "Min width of decent blobs",
+                    ccstruct_->params()),
+      // topitch.cpp ///////////////////////////////////////////
+      BOOL_MEMBER(textord_all_prop, FALSE, "All doc is proportial text",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_debug_pitch_test, FALSE, "Debug on fixed pitch test",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_disable_pitch_test, FALSE,
+                  "Turn off dp fixed pitch algorithm",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_fast_pitch_test, FALSE,
+                  "Do even faster pitch algorithm",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_debug_pitch_metric, FALSE, "Write full metric stuff",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_show_row_cuts, FALSE, "Draw row-level cuts",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_show_page_cuts, FALSE, "Draw page-level cuts",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_pitch_cheat, FALSE,
+                  "Use correct answer for fixed/prop",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_blockndoc_fixed, FALSE,
+                  "Attempt whole doc/block fixed pitch",
+                  ccstruct_->params()),
+      double_MEMBER(textord_projection_scale, 0.200, "Ding rate for mid-cuts",
+                    ccstruct_->params()),
+      double_MEMBER(textord_balance_factor, 1.0,
+                    "Ding rate for unbalanced char cells",
+                    ccstruct_->params()),
+      // wordseg.cpp ///////////////////////////////////////////
+      BOOL_MEMBER(textord_fp_chopping, TRUE, "Do fixed pitch chopping",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_force_make_prop_words, FALSE,
+                  "Force proportional word segmentation on all rows",
+                  ccstruct_->params()),
+      BOOL_MEMBER(textord_chopper_test, FALSE, "Chopper is being tested.",
+                  ccstruct_->params()),
+      // fpchop.cpp ///////////////////////////////////////////
+      INT_MEMBER(textord_fp_chop_error, 2, "Max allowed bending of chop cells",
+                 ccstruct_->params()),
+      double_MEMBER(textord_fp_chop_snap, 0.5,
+                    "Max distance of chop pt from vertex",
+                    ccstruct_->params()),
+      // pitsync1.cpp ///////////////////////////////////////////
+      INT_MEMBER(pitsync_linear_version, 6, "Use new fast algorithm",
+                 ccstruct_->params()),
+      double_MEMBER(pitsync_joined_edge, 0.75,
+                    "Dist inside big blob for chopping",
+                    ccstruct_->params()),
+      double_MEMBER(pitsync_offset_freecut_fraction, 0.25,
+                    "Fraction of cut for free cuts",
+                    ccstruct_->params()),
+      INT_MEMBER(pitsync_fake_depth, 1, "Max advance fake generation",
+                 ccstruct_->params()),
+      // gap_map.cpp ///////////////////////////////////////////
+      BOOL_MEMBER(gapmap_debug, FALSE, "Say which blocks have tables",
+                  ccstruct_->params()),
+      BOOL_MEMBER(gapmap_use_ends, FALSE,
+                  "Use large space at start and end of rows",
+                  ccstruct_->params()),
+      BOOL_MEMBER(gapmap_no_isolated_quanta, FALSE,
+                  "Ensure gaps not less than 2quanta wide",
+                  ccstruct_->params()),
+      double_MEMBER(gapmap_big_gaps, 1.75, "xht multiplier",
+                    ccstruct_->params()),
+      // underlin.cpp ///////////////////////////////////////////
+      double_MEMBER(textord_underline_offset, 0.1, "Fraction of x to ignore",
+                    ccstruct_->params()),
+      BOOL_MEMBER(textord_restore_underlines, TRUE,
+                  "Chop underlines & put back",
+                  ccstruct_->params()),
+      // blkocc.cpp ///////////////////////////////////////////
+      double_MEMBER(textord_underline_threshold, 0.5,
+                    "Fraction of width occupied",
+                    ccstruct_->params()),
+      // cjkpitch.cpp ///////////////////////////////////////////
+      BOOL_MEMBER(textord_space_size_is_variable, FALSE,
+                  "If true, word delimiter spaces are assumed to have "
+                  "variable width, even though characters have fixed pitch.",
+                  ccstruct_->params()),
+      // drawtord.cpp ///////////////////////////////////////////
+      BOOL_MEMBER(textord_show_fixed_cuts, FALSE,
+                  "Draw fixed pitch cell boundaries",
+                  ccstruct_->params()) {
 }
 
 Textord::~Textord() {
@@ -312,7 +676,7 @@ void Textord::TextordPage(PageSegMode pageseg_mode,
   // Now make the words in the lines.
   if (PSM_WORD_FIND_ENABLED(pageseg_mode)) {
     // SINGLE_LINE uses the old word maker on the single line.
-    make_words(this, page_tr_, gradient, blocks, to_blocks);
+    make_words(page_tr_, gradient, blocks, to_blocks);
   } else {
     // SINGLE_WORD and SINGLE_CHAR cram all the blobs into a
     // single word, and in SINGLE_CHAR mode, all the outlines
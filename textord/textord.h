@@ -24,6 +24,8 @@
 #include "ccstruct.h"
 #include "blobbox.h"
 #include "gap_map.h"
+#include "makerow.h"
+#include "pitsync1.h"
 #include "notdll.h"
 #include "publictypes.h"  // For PageSegMode.
 
@@ -97,6 +99,10 @@ class Textord {
                             FCOORD rotation,   // for drawing
                             inT32 block_edge,  // edge of block
                             BOOL8 testing_on);  // correct orientation
+  // Returns the range of plausible x-heights for a block with the given
+  // line size.
+  void get_min_max_xheight(int block_linesize,
+                           int *min_height, int *max_height) const;
   void compute_block_xheight(TO_BLOCK *block, float gradient);
   void compute_row_xheight(TO_ROW *row,          // row to do
                            const FCOORD& rotation,
@@ -108,6 +114,120 @@ class Textord {
                         inT32 block_edge,  // edge of block
                         BOOL8 testing_on);
 
+  void adjust_row_limits(                 //tidy limits
+                         TO_BLOCK *block  //block to do
+                        );
+  void assign_blobs_to_rows(                      //find lines
+                            TO_BLOCK *block,      //block to do
+                            float *gradient,      //block skew
+                            int pass,             //identification
+                            BOOL8 reject_misses,  //chuck big ones out
+                            BOOL8 make_new_rows,  //add rows for unmatched
+                            BOOL8 drawing_skew    //draw smoothed skew
+                           );
+  void cleanup_rows_making(ICOORD page_tr,     // top right
+                           TO_BLOCK *block,    // block to do
+                           float gradient,     // gradient to fit
+                           FCOORD rotation,    // for drawing
+                           inT32 block_edge,   // edge of block
+                           BOOL8 testing_on);
+  void compute_occupation_threshold(                    //project blobs
+                                    inT32 low_window,   //below result point
+                                    inT32 high_window,  //above result point
+                                    inT32 line_count,   //array sizes
+                                    inT32 *occupation,  //input projection
+                                    inT32 *thresholds   //output thresholds
+                                   );
+  void compute_page_skew(TO_BLOCK_LIST *blocks,  // list of blocks
+                         float &page_m,          // average gradient
+                         float &page_err);
+  inT32 compute_row_descdrop(TO_ROW *row,     // row to do
+                             float gradient,  // global skew
+                             int xheight_blob_count,
+                             STATS *heights);
+  void compute_row_stats(                  //find lines
+                         TO_BLOCK *block,  //block to do
+                         BOOL8 testing_on  //correct orientation
+                        );
+  int compute_xheight_from_modes(
+      STATS *heights, STATS *floating_heights, bool cap_only, int min_height,
+      int max_height, float *xheight, float *ascrise);
+  void correct_row_xheight(TO_ROW *row,    // row to fix
+                           float xheight,  // average values
+                           float ascrise,
+                           float descdrop);
+  void expand_rows(                   //find lines
+                   ICOORD page_tr,    //top right
+                   TO_BLOCK *block,   //block to do
+                   float gradient,    //gradient to fit
+                   FCOORD rotation,   //for drawing
+                   inT32 block_edge,  //edge of block
+                   BOOL8 testing_on   //correct orientation
+                  );
+  void fill_heights(TO_ROW *row, float gradient, int min_height,
+                    int max_height, STATS *heights, STATS *floating_heights);
+  void fit_parallel_lms(float gradient,  // forced gradient
+                        TO_ROW *row);
+  double *linear_spline_baseline ( //split baseline
+  TO_ROW * row,                    //row to fit
+  TO_BLOCK * block,                //block it came from
+  inT32 & segments,                //no fo segments
+  inT32 xstarts[]                  //coords of segments
+  );
+        // row to fit
+  void make_baseline_spline(TO_ROW *row,     // row to fit
+                            TO_BLOCK *block);
+  void make_initial_textrows(ICOORD page_tr,
+                             TO_BLOCK *block,  // block to do
+                             FCOORD rotation,  // for drawing
+                             BOOL8 testing_on);
+  float make_rows(ICOORD page_tr,              // top right
+                  TO_BLOCK_LIST *port_blocks);
+                                   //find best row
+  OVERLAP_STATE most_overlapping_row(TO_ROW_IT *row_it,  //iterator
+                                     TO_ROW *&best_row,  //output row
+                                     float top,          //top of blob
+                                     float bottom,       //bottom of blob
+                                     float rowsize,      //max row size
+                                     BOOL8 testing_blob  //test stuff
+                                    );
+  void pre_associate_blobs( ICOORD page_tr,   // top right
+                           TO_BLOCK *block,  // block to do
+                           FCOORD rotation,  // inverse landscape
+                           BOOL8 testing_on);
+    // block it came from
+  BOOL8 segment_baseline (         //split baseline
+  TO_ROW * row,                    //row to fit
+  TO_BLOCK * block,                //block it came from
+  inT32 & segments,                //no fo segments
+  inT32 xstarts[]                  //coords of segments
+  );
+  void separate_underlines(TO_BLOCK *block,  // block to do
+                           float gradient,   // skew angle
+                           FCOORD rotation,  // inverse landscape
+                           BOOL8 testing_on);
+  // Returns true if the per-block stages of textline and word finding may run
+  // in parallel over the blocks. They may not while any of the debug displays
+  // is in use, as they all draw in the one to_win.
+  BOOL8 textord_blocks_in_parallel();
+         // average error
+    // correct orientation
+  void delete_non_dropout_rows(                   //find lines
+                               TO_BLOCK *block,   //block to do
+                               float gradient,    //global skew
+                               FCOORD rotation,   //deskew vector
+                               inT32 block_edge,  //left edge
+                               BOOL8 testing_on   //correct orientation
+                              );
+    // correct orientation
+    // correct orientation
+  void fit_parallel_rows(TO_BLOCK *block,   // block to do
+                         float gradient,    // gradient to fit
+                         FCOORD rotation,   // for drawing
+                         inT32 block_edge,  // edge of block
+                         BOOL8 testing_on);
+  float make_single_row(ICOORD page_tr, TO_BLOCK* block,
+                        TO_BLOCK_LIST* blocks);
   //// oldbasel.cpp ////////////////////////////////////////
   void make_old_baselines(TO_BLOCK *block,   // block to do
                           BOOL8 testing_on,  // correct orientation
@@ -123,6 +243,91 @@ class Textord {
                       TO_ROW *row,      // row to do
                       int degree,       // required approximation
                       QSPLINE *spline);  // starting spline
+  int choose_partition (           //select partition
+  register float diff,             /*diff from spline */
+  float partdiffs[],               /*diff on all parts */
+  int lastpart,                    /*last assigned partition */
+  float jumplimit,                 /*new part threshold */
+  float* drift,
+  float* last_delta,
+  int *partcount                   /*no of partitions */
+  );
+  void find_top_modes (            //get modes
+  STATS * stats,                   //stats to hack
+  int statnum,                     //no of piles
+  int modelist[], int modenum      //no of modes to get
+  );
+  int get_blob_coords(                    //get boxes
+                      TO_ROW *row,        //row to use
+                      inT32 lineheight,   //block level
+                      TBOX *blobcoords,    //ouput boxes
+                      BOOL8 &holed_line,  //lost a lot of blobs
+                      int &outcount       //no of real blobs
+                     );
+  void make_first_baseline (       //initial approximation
+  TBOX blobcoords[],                /*blob bounding boxes */
+  int blobcount,                   /*no of blobcoords */
+  int xcoords[],                   /*coords for spline */
+  int ycoords[],                   /*approximator */
+  QSPLINE * spline,                /*initial spline */
+  QSPLINE * baseline,              /*output spline */
+  float jumplimit                  /*guess half descenders */
+  );
+  void make_first_xheight (        //find xheight
+  TO_ROW * row,                    /*current row */
+  TBOX blobcoords[],                /*blob bounding boxes */
+  int lineheight,                  //initial guess
+  int init_lineheight,             //block level guess
+  int blobcount,                   /*blobs in blobcoords */
+  QSPLINE * baseline,              /*established */
+  float jumplimit                  /*min ascender height */
+  );
+  void merge_oldbl_parts (         //partition blobs
+  TBOX blobcoords[],                //bounding boxes
+  int blobcount,                   /*no of blobs on row */
+  char partids[],                  /*partition no of each blob */
+  int partsizes[],                 /*no in each partition */
+  int biggestpart,                 //major partition
+  float jumplimit                  /*allowed delta change */
+  );
+  void old_first_xheight (         //the wiseowl way
+  TO_ROW * row,                    /*current row */
+  TBOX blobcoords[],                /*blob bounding boxes */
+  int initialheight,               //initial guess
+  int blobcount,                   /*blobs in blobcoords */
+  QSPLINE * baseline,              /*established */
+  float jumplimit                  /*min ascender height */
+  );
+  int partition_line (             //partition blobs
+  TBOX blobcoords[],                //bounding boxes
+  int blobcount,                   /*no of blobs on row */
+  int *numparts,                   /*number of partitions */
+  char partids[],                  /*partition no of each blob */
+  int partsizes[],                 /*no in each partition */
+  QSPLINE * spline,                /*curve to fit to */
+  float jumplimit,                 /*allowed delta change */
+  float ydiffs[]                   /*diff from spline */
+  );
+  void pick_x_height(TO_ROW * row,                    //row to do
+  int modelist[],
+  int lefts[], int rights[],
+  STATS * heightstat,
+  int mode_threshold);
+  int segment_spline (             //make xstarts
+  TBOX blobcoords[],                //boundign boxes
+  int blobcount,                   /*no of blobs in row */
+  int xcoords[],                   /*points to work on */
+  int ycoords[],                   /*points to work on */
+  int degree, int pointcount,      /*no of points */
+  int xstarts[]                    //result
+  );
+  BOOL8 split_stepped_spline (     //make xstarts
+  QSPLINE * baseline,              //current shot
+  float jumplimit,                 //max step fuction
+  int xcoords[],                   /*points to work on */
+  int xstarts[],                   //result
+  int &segments                    //no of segments
+  );
   // tospace.cpp ///////////////////////////////////////////
   //DEBUG USE ONLY
   void block_spacing_stats(TO_BLOCK *block,
@@ -208,10 +413,353 @@ class Textord {
   // Remove outlines that are a tiny fraction in either width or height
   // of the word height.
   void clean_small_noise_from_words(ROW *row);
+  // blkocc.cpp ///////////////////////////////////////////
+  BOOL8 test_underline(                   //look for underlines
+                       BOOL8 testing_on,  //drawing blob
+                       C_BLOB *blob,      //blob to test
+                       inT16 baseline,    //coords of baseline
+                       inT16 xheight      //height of line
+                      );
+  // cjkpitch.cpp ///////////////////////////////////////////
+  // Function to test "fixed-pitchness" of the input text and estimating
+  // character pitch parameters for it, based on CJK fixed-pitch layout
+  // model.
+  //
+  // This function assumes that a fixed-pitch CJK text has following
+  // characteristics:
+  //
+  // - Most glyphs are designed to fit within the same sized square
+  //   (imaginary body). Also they are aligned to the center of their
+  //   imaginary bodies.
+  // - The imaginary body is always a regular rectangle.
+  // - There may be some extra space between character bodies
+  //   (tracking).
+  // - There may be some extra space after punctuations.
+  // - The text is *not* space-delimited. Thus spaces are rare.
+  // - Character may consists of multiple unconnected blobs.
+  //
+  // And the function works in two passes.  On pass 1, it looks for such
+  // "good" blobs that has the pitch same pitch on the both side and
+  // looks like a complete CJK character. Then estimates the character
+  // pitch for every row, based on those good blobs. If we couldn't find
+  // enough good blobs for a row, then the pitch is estimated from other
+  // rows with similar character height instead.
+  //
+  // Pass 2 is an iterative process to fit the blobs into fixed-pitch
+  // character cells. Once we have estimated the character pitch, blobs
+  // that are almost as large as the pitch can be considered to be
+  // complete characters. And once we know that some characters are
+  // complete characters, we can estimate the region occupied by its
+  // neighbors. And so on.
+  //
+  // We repeat the process until all ambiguities are resolved. Then make
+  // the final decision about fixed-pitchness of each row and compute
+  // pitch and spacing parameters.
+  //
+  // (If a row is considered to be propotional, pitch_decision for the
+  // row is set to PITCH_CORR_PROP and the later phase
+  // (i.e. Textord::to_spacing()) should determine its spacing
+  // parameters)
+  //
+  // This function doesn't provide all information required by
+  // fixed_pitch_words() and the rows need to be processed with
+  // make_prop_words() even if they are fixed pitched.
+  void compute_fixed_pitch_cjk(ICOORD page_tr,               // top right
+                               TO_BLOCK_LIST *port_blocks);
+  // drawtord.cpp ///////////////////////////////////////////
+  void plot_word_decisions(              //draw words
+                           ScrollView* win,   //window tro draw in
+                           inT16 pitch,  //of block
+                           TO_ROW *row   //row to draw
+                          );
+  void plot_fp_cells(                        //draw words
+                     ScrollView* win,             //window tro draw in
+                     ScrollView::Color colour,          //colour of lines
+                     BLOBNBOX_IT *blob_it,   //blobs
+                     inT16 pitch,            //of block
+                     inT16 blob_count,       //no of real blobs
+                     STATS *projection,      //vertical
+                     inT16 projection_left,  //edges //scale factor
+                     inT16 projection_right,
+                     float projection_scale);
+  // fpchop.cpp ///////////////////////////////////////////
+  ROW *fixed_pitch_words(                 //find lines
+                         TO_ROW *row,     //row to do
+                         FCOORD rotation  //for drawing
+                        );
+  // pithsync.cpp ///////////////////////////////////////////
+  double check_pitch_sync2(                          //find segmentation
+                           BLOBNBOX_IT *blob_it,     //blobs to do
+                           inT16 blob_count,         //no of blobs
+                           inT16 pitch,              //pitch estimate
+                           inT16 pitch_error,        //tolerance
+                           STATS *projection,        //vertical
+                           inT16 projection_left,    //edges //scale factor
+                           inT16 projection_right,
+                           float projection_scale,
+                           inT16 &occupation_count,  //no of occupied cells
+                           FPSEGPT_LIST *seg_list,   //output list
+                           inT16 start,              //start of good range
+                           inT16 end                 //end of good range
+                          );
+  double check_pitch_sync3(                          //find segmentation
+                           inT16 projection_left,    //edges //to be considered 0
+                           inT16 projection_right,
+                           inT16 zero_count,
+                           inT16 pitch,              //pitch estimate
+                           inT16 pitch_error,        //tolerance
+                           STATS *projection,        //vertical
+                           float projection_scale,   //scale factor
+                           inT16 &occupation_count,  //no of occupied cells
+                           FPSEGPT_LIST *seg_list,   //output list
+                           inT16 start,              //start of good range
+                           inT16 end                 //end of good range
+                          );
+  // topitch.cpp ///////////////////////////////////////////
+  void compute_block_pitch( TO_BLOCK *block,     // input list
+                           FCOORD rotation,      // for drawing
+                           inT32 block_index,    // block number
+                           BOOL8 testing_on);
+  void compute_fixed_pitch(ICOORD page_tr,              // top right
+                           TO_BLOCK_LIST *port_blocks,  // input list
+                           float gradient,              // page skew
+                           FCOORD rotation,             // for drawing
+                           BOOL8 testing_on);
+  float compute_pitch_sd (         //find fp cells
+  TO_ROW * row,                    //row to do
+  STATS * projection,              //vertical projection
+  inT16 projection_left,           //edge
+  inT16 projection_right,          //edge
+  float space_size,                //size of blank
+  float initial_pitch,             //guess at pitch
+  float &sp_sd,                    //space sd
+  inT16 & mid_cuts,                //no of free cuts
+  ICOORDELT_LIST * row_cells,      //list of chop pts
+  BOOL8 testing_on,                //inidividual words
+  inT16 start = 0,                 //start of good range
+  inT16 end = 0                    //end of good range
+  );
+  float compute_pitch_sd2 (        //find fp cells
+  TO_ROW * row,                    //row to do
+  STATS * projection,              //vertical projection
+  inT16 projection_left,           //edge
+  inT16 projection_right,          //edge
+  float initial_pitch,             //guess at pitch
+  inT16 & occupation,              //no of occupied cells
+  inT16 & mid_cuts,                //no of free cuts
+  ICOORDELT_LIST * row_cells,      //list of chop pts
+  BOOL8 testing_on,                //inidividual words
+  inT16 start = 0,                 //start of good range
+  inT16 end = 0                    //end of good range
+  );
+      // correct orientation
+  BOOL8 compute_rows_pitch(                    //find line stats
+                           TO_BLOCK *block,    //block to do
+                           inT32 block_index,  //block number
+                           BOOL8 testing_on    //correct orientation
+                          );
+  BOOL8 count_pitch_stats(                       //find lines
+                          TO_ROW *row,           //row to do
+                          STATS *gap_stats,      //blob gaps
+                          STATS *pitch_stats,    //centre-centre stats
+                          float initial_pitch,   //guess at pitch
+                          float min_space,       //estimate space size
+                          BOOL8 ignore_outsize,  //discard big objects
+                          BOOL8 split_outsize,   //split big objects
+                          inT32 dm_gap           //ignorable gaps
+                         );
+  BOOL8 find_row_pitch(                    //find lines
+                       TO_ROW *row,        //row to do
+                       inT32 maxwidth,     //max permitted space
+                       inT32 dm_gap,       //ignorable gaps
+                       TO_BLOCK *block,    //block of row
+                       inT32 block_index,  //block_number
+                       inT32 row_index,    //number of row
+                       BOOL8 testing_on    //correct orientation
+                      );
+             // correct orientation
+  void fix_row_pitch(                        //get some value
+                     TO_ROW *bad_row,        //row to fix
+                     TO_BLOCK *bad_block,    //block of bad_row
+                     TO_BLOCK_LIST *blocks,  //blocks to scan
+                     inT32 row_target,       //number of row
+                     inT32 block_target      //number of block
+                    );
+  BOOL8 fixed_pitch_row(                   //find lines
+                        TO_ROW *row,       //row to do
+                        BLOCK* block,
+                        inT32 block_index  //block_number
+                       );
+  void print_block_counts(                   //find line stats
+                          TO_BLOCK *block,   //block to do
+                          inT32 block_index  //block number
+                         );
+  void print_pitch_sd(                        //find fp cells
+                      TO_ROW *row,            //row to do
+                      STATS *projection,      //vertical projection
+                      inT16 projection_left,  //edges //size of blank
+                      inT16 projection_right,
+                      float space_size,
+                      float initial_pitch     //guess at pitch
+                     );
+  BOOL8 row_pitch_stats(                  //find line stats
+                        TO_ROW *row,      //current row
+                        inT32 maxwidth,   //of spaces
+                        BOOL8 testing_on  //correct orientation
+                       );
+  BOOL8 try_doc_fixed(                             //determine pitch
+                      ICOORD page_tr,              //top right
+                      TO_BLOCK_LIST *port_blocks,  //input list
+                      float gradient               //page skew
+                     );
+  BOOL8 try_rows_fixed(                    //find line stats
+                       TO_BLOCK *block,    //block to do
+                       inT32 block_index,  //block number
+                       BOOL8 testing_on    //correct orientation
+                      );
+  float tune_row_pitch(                             //find fp cells
+                       TO_ROW *row,                 //row to do
+                       STATS *projection,           //vertical projection
+                       inT16 projection_left,       //edge of projection
+                       inT16 projection_right,      //edge of projection
+                       float space_size,            //size of blank
+                       float &initial_pitch,        //guess at pitch
+                       float &best_sp_sd,           //space sd
+                       inT16 &best_mid_cuts,        //no of cheap cuts
+                       ICOORDELT_LIST *best_cells,  //row cells
+                       BOOL8 testing_on             //inidividual words
+                      );
+  float tune_row_pitch2(                             //find fp cells
+                        TO_ROW *row,                 //row to do
+                        STATS *projection,           //vertical projection
+                        inT16 projection_left,       //edge of projection
+                        inT16 projection_right,      //edge of projection
+                        float space_size,            //size of blank
+                        float &initial_pitch,        //guess at pitch
+                        float &best_sp_sd,           //space sd
+                        inT16 &best_mid_cuts,        //no of cheap cuts
+                        ICOORDELT_LIST *best_cells,  //row cells
+                        BOOL8 testing_on             //inidividual words
+                       );
+  void plot_fp_word(                  //draw block of words
+                    TO_BLOCK *block,  //block to draw
+                    float pitch,      //pitch to draw with
+                    float nonspace    //for space threshold
+                   );
+  // underlin.cpp ///////////////////////////////////////////
+  void restore_underlined_blobs(                 //get chop points
+                                TO_BLOCK *block  //block to do
+                               );
+  // wordseg.cpp ///////////////////////////////////////////
+  void make_real_words(
+                       TO_BLOCK *block,  //block to do
+                       FCOORD rotation   //for drawing
+                      );
+  void make_words(ICOORD page_tr,                // top right
+                  float gradient,               // page skew
+                  BLOCK_LIST *blocks,           // block list
+                  TO_BLOCK_LIST *port_blocks);  // output list
+  inT32 row_words(                  //compute space size
+                  TO_BLOCK *block,  //block it came from
+                  TO_ROW *row,      //row to operate on
+                  inT32 maxwidth,   //max expected space size
+                  FCOORD rotation,  //for drawing
+                  BOOL8 testing_on  //for debug
+                 );
+  inT32 row_words2(                  //compute space size
+                   TO_BLOCK *block,  //block it came from
+                   TO_ROW *row,      //row to operate on
+                   inT32 maxwidth,   //max expected space size
+                   FCOORD rotation,  //for drawing
+                   BOOL8 testing_on  //for debug
+                  );
+    // output list
+  void set_row_spaces(                  //find space sizes
+                      TO_BLOCK *block,  //block to do
+                      FCOORD rotation,  //for drawing
+                      BOOL8 testing_on  //correct orientation
+                     );
+  // pitsync1.cpp ///////////////////////////////////////////
+  double check_pitch_sync(                        //find segmentation
+                          BLOBNBOX_IT *blob_it,   //blobs to do
+                          inT16 blob_count,       //no of blobs
+                          inT16 pitch,            //pitch estimate
+                          inT16 pitch_error,      //tolerance
+                          STATS *projection,      //vertical
+                          FPSEGPT_LIST *seg_list  //output list
+                         );
  public:
   // makerow.cpp ///////////////////////////////////////////
   BOOL_VAR_H(textord_single_height_mode, false,
              "Script has no xheight, so use a single mode for horizontal text");
+  BOOL_VAR_H(textord_heavy_nr, FALSE, "Vigorously remove noise");
+  BOOL_VAR_H(textord_show_initial_rows, FALSE, "Display row accumulation");
+  BOOL_VAR_H(textord_show_parallel_rows, FALSE, "Display page correlated rows");
+  BOOL_VAR_H(textord_show_expanded_rows, FALSE, "Display rows after expanding");
+  BOOL_VAR_H(textord_show_final_rows, FALSE,
+             "Display rows after final fitting");
+  BOOL_VAR_H(textord_show_final_blobs, FALSE,
+             "Display blob bounds after pre-ass");
+  BOOL_VAR_H(textord_test_landscape, FALSE, "Tests refer to land/port");
+  BOOL_VAR_H(textord_parallel_blocks, TRUE,
+             "Find rows and words in parallel over blocks");
+  BOOL_VAR_H(textord_parallel_baselines, TRUE, "Force parallel baselines");
+  BOOL_VAR_H(textord_straight_baselines, FALSE, "Force straight baselines");
+  BOOL_VAR_H(textord_old_baselines, TRUE, "Use old baseline algorithm");
+  BOOL_VAR_H(textord_old_xheight, FALSE, "Use old xheight algorithm");
+  BOOL_VAR_H(textord_fix_xheight_bug, TRUE, "Use spline baseline");
+  BOOL_VAR_H(textord_fix_makerow_bug, TRUE, "Prevent multiple baselines");
+  BOOL_VAR_H(textord_debug_xheights, FALSE, "Test xheight algorithms");
+  BOOL_VAR_H(textord_biased_skewcalc, TRUE,
+             "Bias skew estimates with line length");
+  BOOL_VAR_H(textord_interpolating_skew, TRUE, "Interpolate across gaps");
+  INT_VAR_H(textord_skewsmooth_offset, 2, "For smooth factor");
+  INT_VAR_H(textord_skewsmooth_offset2, 1, "For smooth factor");
+  INT_VAR_H(textord_test_x, -1, "coord of test pt");
+  INT_VAR_H(textord_test_y, -1, "coord of test pt");
+  INT_VAR_H(textord_min_blobs_in_row, 4, "Min blobs before gradient counted");
+  INT_VAR_H(textord_spline_minblobs, 8, "Min blobs in each spline segment");
+  INT_VAR_H(textord_spline_medianwin, 6,
+            "Size of window for spline segmentation");
+  INT_VAR_H(textord_max_blob_overlaps, 4,
+            "Max number of blobs a big blob can overlap");
+  INT_VAR_H(textord_min_xheight, 10, "Min credible pixel xheight");
+  double_VAR_H(textord_spline_shift_fraction, 0.02,
+               "Fraction of line spacing for quad");
+  double_VAR_H(textord_spline_outlier_fraction, 0.1,
+               "Fraction of line spacing for outlier");
+  double_VAR_H(textord_skew_ile, 0.5, "Ile of gradients for page skew");
+  double_VAR_H(textord_skew_lag, 0.01, "Lag for skew on row accumulation");
+  double_VAR_H(textord_linespace_iqrlimit, 0.2, "Max iqr/median for linespace");
+  double_VAR_H(textord_width_limit, 8, "Max width of blobs to make rows");
+  double_VAR_H(textord_chop_width, 1.5, "Max width before chopping");
+  double_VAR_H(textord_expansion_factor, 1.0,
+               "Factor to expand rows by in expand_rows");
+  double_VAR_H(textord_overlap_x, 0.5,
+               "Fraction of linespace for good overlap");
+  double_VAR_H(textord_minxh, 0.25, "fraction of linesize for min xheight");
+  double_VAR_H(textord_min_linesize, 1.25,
+               "* blob height for initial linesize");
+  double_VAR_H(textord_excess_blobsize, 1.3,
+               "New row made if blob makes row this big");
+  double_VAR_H(textord_occupancy_threshold, 0.4, "Fraction of neighbourhood");
+  double_VAR_H(textord_underline_width, 2.0,
+               "Multiple of line_size for underline");
+  double_VAR_H(textord_min_blob_height_fraction, 0.75,
+               "Min blob height/top to include blob top into xheight stats");
+  double_VAR_H(textord_xheight_mode_fraction, 0.4,
+               "Min pile height to make xheight");
+  double_VAR_H(textord_ascheight_mode_fraction, 0.08,
+               "Min pile height to make ascheight");
+  double_VAR_H(textord_descheight_mode_fraction, 0.08,
+               "Min pile height to make descheight");
+  double_VAR_H(textord_ascx_ratio_min, 1.25, "Min cap/xheight");
+  double_VAR_H(textord_ascx_ratio_max, 1.8, "Max cap/xheight");
+  double_VAR_H(textord_descx_ratio_min, 0.25, "Min desc/xheight");
+  double_VAR_H(textord_descx_ratio_max, 0.6, "Max desc/xheight");
+  double_VAR_H(textord_xheight_error_margin, 0.1, "Accepted variation");
+  INT_VAR_H(textord_lms_line_trials, 12, "Number of linew fits to do");
+  BOOL_VAR_H(textord_new_initial_xheight, TRUE, "Use test xheight mechanism");
   // tospace.cpp ///////////////////////////////////////////
   BOOL_VAR_H(tosp_old_to_method, false, "Space stats use prechopping?");
   BOOL_VAR_H(tosp_old_to_constrain_sp_kn, false,
@@ -349,6 +897,138 @@ class Textord {
   BOOL_VAR_H(textord_noise_debug, FALSE, "Debug row garbage detector");
   double_VAR_H(textord_blshift_maxshift, 0.00, "Max baseline shift");
   double_VAR_H(textord_blshift_xfraction, 9.99, "Min size of baseline shift");
+  // edgblob.cpp ///////////////////////////////////////////
+  // Control parameters used in outline_complexity(), which rejects an outline
+  // if any one of the 3 conditions is satisfied:
+  //  - number of children exceeds edges_max_children_per_outline
+  //  - number of nested layers exceeds edges_max_children_layers
+  //  - joint complexity exceeds edges_children_count_limit(as in child_count())
+  BOOL_VAR_H(edges_use_new_outline_complexity, FALSE,
+             "Use the new outline complexity module");
+  INT_VAR_H(edges_max_children_per_outline, 10,
+            "Max number of children inside a character outline");
+  INT_VAR_H(edges_max_children_layers, 5,
+            "Max layers of nested children inside a character outline");
+  BOOL_VAR_H(edges_debug, FALSE, "turn on debugging for this module");
+  INT_VAR_H(edges_children_per_grandchild, 10,
+            "Importance ratio for chucking outlines");
+  INT_VAR_H(edges_children_count_limit, 45, "Max holes allowed in blob");
+  BOOL_VAR_H(edges_children_fix, FALSE,
+             "Remove boxy parents of char-like children");
+  INT_VAR_H(edges_min_nonhole, 12, "Min pixels for potential char in box");
+  INT_VAR_H(edges_patharea_ratio, 40,
+            "Max lensq/area for acceptable child outline");
+  double_VAR_H(edges_childarea, 0.5, "Min area fraction of child outline");
+  double_VAR_H(edges_boxarea, 0.875, "Min area fraction of grandchild for box");
+  // edgloop.cpp ///////////////////////////////////////////
+  INT_VAR_H(edges_maxedgelength, 16000, "Max steps in any outline");
+  // oldbasel.cpp ///////////////////////////////////////////
+  BOOL_VAR_H(textord_really_old_xheight, FALSE, "Use original wiseowl xheight");
+  BOOL_VAR_H(textord_oldbl_debug, FALSE, "Debug old baseline generation");
+  BOOL_VAR_H(textord_debug_baselines, FALSE, "Debug baseline generation");
+  BOOL_VAR_H(textord_oldbl_paradef, TRUE, "Use para default mechanism");
+  BOOL_VAR_H(textord_oldbl_split_splines, TRUE, "Split stepped splines");
+  BOOL_VAR_H(textord_oldbl_merge_parts, TRUE, "Merge suspect partitions");
+  BOOL_VAR_H(oldbl_corrfix, TRUE, "Improve correlation of heights");
+  BOOL_VAR_H(oldbl_xhfix, FALSE, "Fix bug in modes threshold for xheights");
+  BOOL_VAR_H(textord_ocropus_mode, FALSE, "Make baselines for ocropus");
+  double_VAR_H(oldbl_xhfract, 0.4, "Fraction of est allowed in calc");
+  INT_VAR_H(oldbl_holed_losscount, 10, "Max lost before fallback line used");
+  double_VAR_H(oldbl_dot_error_size, 1.26, "Max aspect ratio of a dot");
+  double_VAR_H(textord_oldbl_jumplimit, 0.15, "X fraction for new partition");
+  // tovars.cpp ///////////////////////////////////////////
+  BOOL_VAR_H(textord_show_initial_words, FALSE, "Display separate words");
+  BOOL_VAR_H(textord_show_new_words, FALSE, "Display separate words");
+  BOOL_VAR_H(textord_show_fixed_words, FALSE,
+             "Display forced fixed pitch words");
+  BOOL_VAR_H(textord_blocksall_fixed, FALSE, "Moan about prop blocks");
+  BOOL_VAR_H(textord_blocksall_prop, FALSE, "Moan about fixed pitch blocks");
+  BOOL_VAR_H(textord_blocksall_testing, FALSE, "Dump stats when moaning");
+  BOOL_VAR_H(textord_test_mode, FALSE, "Do current test");
+  INT_VAR_H(textord_dotmatrix_gap, 3, "Max pixel gap for broken pixed pitch");
+  INT_VAR_H(textord_debug_block, 0, "Block to do debug on");
+  INT_VAR_H(textord_pitch_range, 2, "Max range test on pitch");
+  double_VAR_H(textord_wordstats_smooth_factor, 0.05, "Smoothing gap stats");
+  double_VAR_H(textord_width_smooth_factor, 0.10, "Smoothing width stats");
+  double_VAR_H(textord_words_width_ile, 0.4,
+               "Ile of blob widths for space est");
+  double_VAR_H(textord_words_maxspace, 4.0, "Multiple of xheight");
+  double_VAR_H(textord_words_default_maxspace, 3.5,
+               "Max believable third space");
+  double_VAR_H(textord_words_default_minspace, 0.6, "Fraction of xheight");
+  double_VAR_H(textord_words_min_minspace, 0.3, "Fraction of xheight");
+  double_VAR_H(textord_words_default_nonspace, 0.2, "Fraction of xheight");
+  double_VAR_H(textord_words_initial_lower, 0.25, "Max inital cluster size");
+  double_VAR_H(textord_words_initial_upper, 0.15,
+               "Min initial cluster spacing");
+  double_VAR_H(textord_words_minlarge, 0.75, "Fraction of valid gaps needed");
+  double_VAR_H(textord_words_pitchsd_threshold, 0.040, "Pitch sync threshold");
+  double_VAR_H(textord_words_def_fixed, 0.016, "Threshold for definite fixed");
+  double_VAR_H(textord_words_def_prop, 0.090, "Threshold for definite prop");
+  INT_VAR_H(textord_words_veto_power, 5, "Rows required to outvote a veto");
+  double_VAR_H(textord_pitch_rowsimilarity, 0.08,
+               "Fraction of xheight for sameness");
+  BOOL_VAR_H(textord_pitch_scalebigwords, FALSE, "Scale scores on big words");
+  double_VAR_H(words_initial_lower, 0.5, "Max inital cluster size");
+  double_VAR_H(words_initial_upper, 0.15, "Min initial cluster spacing");
+  double_VAR_H(words_default_prop_nonspace, 0.25, "Fraction of xheight");
+  double_VAR_H(words_default_fixed_space, 0.75, "Fraction of xheight");
+  double_VAR_H(words_default_fixed_limit, 0.6, "Allowed size variance");
+  double_VAR_H(textord_words_definite_spread, 0.30, "Non-fuzzy spacing region");
+  double_VAR_H(textord_spacesize_ratiofp, 2.8, "Min ratio space/nonspace");
+  double_VAR_H(textord_spacesize_ratioprop, 2.0, "Min ratio space/nonspace");
+  double_VAR_H(textord_fpiqr_ratio, 1.5, "Pitch IQR/Gap IQR threshold");
+  double_VAR_H(textord_max_pitch_iqr, 0.20, "Xh fraction noise in pitch");
+  double_VAR_H(textord_fp_min_width, 0.5, "Min width of decent blobs");
+  // topitch.cpp ///////////////////////////////////////////
+  BOOL_VAR_H(textord_all_prop, FALSE, "All doc is proportial text");
+  BOOL_VAR_H(textord_debug_pitch_test, FALSE, "Debug on fixed pitch test");
+  BOOL_VAR_H(textord_disable_pitch_test, FALSE,
+             "Turn off dp fixed pitch algorithm");
+  BOOL_VAR_H(textord_fast_pitch_test, FALSE, "Do even faster pitch algorithm");
+  BOOL_VAR_H(textord_debug_pitch_metric, FALSE, "Write full metric stuff");
+  BOOL_VAR_H(textord_show_row_cuts, FALSE, "Draw row-level cuts");
+  BOOL_VAR_H(textord_show_page_cuts, FALSE, "Draw page-level cuts");
+  BOOL_VAR_H(textord_pitch_cheat, FALSE, "Use correct answer for fixed/prop");
+  BOOL_VAR_H(textord_blockndoc_fixed, FALSE,
+             "Attempt whole doc/block fixed pitch");
+  double_VAR_H(textord_projection_scale, 0.200, "Ding rate for mid-cuts");
+  double_VAR_H(textord_balance_factor, 1.0,
+               "Ding rate for unbalanced char cells");
+  // wordseg.cpp ///////////////////////////////////////////
+  BOOL_VAR_H(textord_fp_chopping, TRUE, "Do fixed pitch chopping");
+  BOOL_VAR_H(textord_force_make_prop_words, FALSE,
+             "Force proportional word segmentation on all rows");
+  BOOL_VAR_H(textord_chopper_test, FALSE, "Chopper is being tested.");
+  // fpchop.cpp ///////////////////////////////////////////
+  INT_VAR_H(textord_fp_chop_error, 2, "Max allowed bending of chop cells");
+  double_VAR_H(textord_fp_chop_snap, 0.5,
+               "Max distance of chop pt from vertex");
+  // pitsync1.cpp ///////////////////////////////////////////
+  INT_VAR_H(pitsync_linear_version, 6, "Use new fast algorithm");
+  double_VAR_H(pitsync_joined_edge, 0.75, "Dist inside big blob for chopping");
+  double_VAR_H(pitsync_offset_freecut_fraction, 0.25,
+               "Fraction of cut for free cuts");
+  INT_VAR_H(pitsync_fake_depth, 1, "Max advance fake generation");
+  // gap_map.cpp ///////////////////////////////////////////
+  BOOL_VAR_H(gapmap_debug, FALSE, "Say which blocks have tables");
+  BOOL_VAR_H(gapmap_use_ends, FALSE,
+             "Use large space at start and end of rows");
+  BOOL_VAR_H(gapmap_no_isolated_quanta, FALSE,
+             "Ensure gaps not less than 2quanta wide");
+  double_VAR_H(gapmap_big_gaps, 1.75, "xht multiplier");
+  // underlin.cpp ///////////////////////////////////////////
+  double_VAR_H(textord_underline_offset, 0.1, "Fraction of x to ignore");
+  BOOL_VAR_H(textord_restore_underlines, TRUE, "Chop underlines & put back");
+  // blkocc.cpp ///////////////////////////////////////////
+  double_VAR_H(textord_underline_threshold, 0.5, "Fraction of width occupied");
+  // cjkpitch.cpp ///////////////////////////////////////////
+  BOOL_VAR_H(textord_space_size_is_variable, FALSE,
+             "If true, word delimiter spaces are assumed to have "
+             "variable width, even though characters have fixed pitch.");
+  // drawtord.cpp ///////////////////////////////////////////
+  BOOL_VAR_H(textord_show_fixed_cuts, FALSE,
+             "Draw fixed pitch cell boundaries");
 };
 }  // namespace tesseract.
 
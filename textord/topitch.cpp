@@ -39,26 +39,6 @@
 #include "config_auto.h"
 #endif
 
-#define EXTERN
-
-EXTERN BOOL_VAR (textord_all_prop, FALSE, "All doc is proportial text");
-EXTERN BOOL_VAR (textord_debug_pitch_test, FALSE,
-"Debug on fixed pitch test");
-EXTERN BOOL_VAR (textord_disable_pitch_test, FALSE,
-"Turn off dp fixed pitch algorithm");
-EXTERN BOOL_VAR (textord_fast_pitch_test, FALSE,
-"Do even faster pitch algorithm");
-EXTERN BOOL_VAR (textord_debug_pitch_metric, FALSE,
-"Write full metric stuff");
-EXTERN BOOL_VAR (textord_show_row_cuts, FALSE, "Draw row-level cuts");
-EXTERN BOOL_VAR (textord_show_page_cuts, FALSE, "Draw page-level cuts");
-EXTERN BOOL_VAR (textord_pitch_cheat, FALSE,
-"Use correct answer for fixed/prop");
-EXTERN BOOL_VAR (textord_blockndoc_fixed, FALSE,
-"Attempt whole doc/block fixed pitch");
-EXTERN double_VAR (textord_projection_scale, 0.200, "Ding rate for mid-cuts");
-EXTERN double_VAR (textord_balance_factor, 1.0,
-"Ding rate for unbalanced char cells");
 
 #define FIXED_WIDTH_MULTIPLE  5
 #define BLOCK_STATS_CLUSTERS  10
@@ -72,7 +52,8 @@ EXTERN double_VAR (textord_balance_factor, 1.0,
  * result for each row in the TO_ROW class.
  **********************************************************************/
 
-void compute_fixed_pitch(ICOORD page_tr,              // top right
+namespace tesseract {
+void Textord::compute_fixed_pitch(ICOORD page_tr,              // top right
                          TO_BLOCK_LIST *port_blocks,  // input list
                          float gradient,              // page skew
                          FCOORD rotation,             // for drawing
@@ -91,26 +72,30 @@ void compute_fixed_pitch(ICOORD page_tr,              // top right
   }
 #endif
 
-  block_it.set_to_list (port_blocks);
-  block_index = 1;
-  for (block_it.mark_cycle_pt (); !block_it.cycled_list ();
-  block_it.forward ()) {
-    block = block_it.data ();
-    compute_block_pitch(block, rotation, block_index, testing_on);
-    block_index++;
-  }
+  // The block and row decisions are independent in each block, so they run
+  // in parallel over the blocks. The document decision and fix_row_pitch
+  // look at all the blocks, so they stay serial.
+  GenericVector<TO_BLOCK*> blocks;
+  blocks_to_vector(port_blocks, &blocks);
+  int block_count = blocks.size();
+  bool parallel = textord_blocks_in_parallel();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (parallel)
+#endif  // _OPENMP
+  for (int b = 0; b < block_count; ++b)
+    compute_block_pitch(blocks[b], rotation, b + 1, testing_on);
 
   if (!try_doc_fixed (page_tr, port_blocks, gradient)) {
-    block_index = 1;
-    for (block_it.mark_cycle_pt (); !block_it.cycled_list ();
-    block_it.forward ()) {
-      block = block_it.data ();
-      if (!try_block_fixed (block, block_index))
-        try_rows_fixed(block, block_index, testing_on);
-      block_index++;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (parallel)
+#endif  // _OPENMP
+    for (int b = 0; b < block_count; ++b) {
+      if (!try_block_fixed (blocks[b], b + 1))
+        try_rows_fixed(blocks[b], b + 1, testing_on);
     }
   }
 
+  block_it.set_to_list (port_blocks);
   block_index = 1;
   for (block_it.mark_cycle_pt(); !block_it.cycled_list();
        block_it.forward()) {
@@ -141,7 +126,7 @@ void compute_fixed_pitch(ICOORD page_tr,              // top right
  * block, then similar rows over all the page, or any other rows at all.
  **********************************************************************/
 
-void fix_row_pitch(TO_ROW *bad_row,        // row to fix
+void Textord::fix_row_pitch(TO_ROW *bad_row,        // row to fix
                    TO_BLOCK *bad_block,    // block of bad_row
                    TO_BLOCK_LIST *blocks,  // blocks to scan
                    inT32 row_target,       // number of row
@@ -308,7 +293,7 @@ void fix_row_pitch(TO_ROW *bad_row,        // row to fix
  * Decide whether each block is fixed pitch individually.
  **********************************************************************/
 
-void compute_block_pitch(TO_BLOCK *block,     // input list
+void Textord::compute_block_pitch(TO_BLOCK *block,     // input list
                          FCOORD rotation,     // for drawing
                          inT32 block_index,   // block number
                          BOOL8 testing_on) {  // correct orientation
@@ -351,7 +336,7 @@ void compute_block_pitch(TO_BLOCK *block,     // input list
  * Decide whether each row is fixed pitch individually.
  **********************************************************************/
 
-BOOL8 compute_rows_pitch(                    //find line stats
+BOOL8 Textord::compute_rows_pitch(                    //find line stats
                          TO_BLOCK *block,    //block to do
                          inT32 block_index,  //block number
                          BOOL8 testing_on    //correct orientation
@@ -395,7 +380,7 @@ BOOL8 compute_rows_pitch(                    //find line stats
  * Attempt to call the entire document fixed pitch.
  **********************************************************************/
 
-BOOL8 try_doc_fixed(                             //determine pitch
+BOOL8 Textord::try_doc_fixed(                             //determine pitch
                     ICOORD page_tr,              //top right
                     TO_BLOCK_LIST *port_blocks,  //input list
                     float gradient               //page skew
@@ -527,6 +512,7 @@ BOOL8 try_doc_fixed(                             //determine pitch
   row->char_cells.clear ();
   return FALSE;
 }
+}  // namespace tesseract.
 
 
 /**********************************************************************
@@ -549,7 +535,8 @@ BOOL8 try_block_fixed(                   //find line stats
  * Decide whether each row is fixed pitch individually.
  **********************************************************************/
 
-BOOL8 try_rows_fixed(                    //find line stats
+namespace tesseract {
+BOOL8 Textord::try_rows_fixed(                    //find line stats
                      TO_BLOCK *block,    //block to do
                      inT32 block_index,  //block number
                      BOOL8 testing_on    //correct orientation
@@ -619,7 +606,7 @@ BOOL8 try_rows_fixed(                    //find line stats
  * Count up how many rows have what decision and print the results.
  **********************************************************************/
 
-void print_block_counts(                   //find line stats
+void Textord::print_block_counts(                   //find line stats
                         TO_BLOCK *block,   //block to do
                         inT32 block_index  //block number
                        ) {
@@ -648,6 +635,7 @@ void print_block_counts(                   //find line stats
     tprintf (" (Wrongly)");
   tprintf (" prop, %d dunno\n", dunno);
 }
+}  // namespace tesseract.
 
 
 /**********************************************************************
@@ -703,7 +691,8 @@ void count_block_votes(                   //find line stats
  * Decide whether each row is fixed pitch individually.
  **********************************************************************/
 
-BOOL8 row_pitch_stats(                  //find line stats
+namespace tesseract {
+BOOL8 Textord::row_pitch_stats(                  //find line stats
                       TO_ROW *row,      //current row
                       inT32 maxwidth,   //of spaces
                       BOOL8 testing_on  //correct orientation
@@ -836,7 +825,7 @@ BOOL8 row_pitch_stats(                  //find line stats
  * The larger threshold is the word gap threshold.
  **********************************************************************/
 
-BOOL8 find_row_pitch(                    //find lines
+BOOL8 Textord::find_row_pitch(                    //find lines
                      TO_ROW *row,        //row to do
                      inT32 maxwidth,     //max permitted space
                      inT32 dm_gap,       //ignorable gaps
@@ -976,7 +965,7 @@ BOOL8 find_row_pitch(                    //find lines
  * The larger threshold is the word gap threshold.
  **********************************************************************/
 
-BOOL8 fixed_pitch_row(TO_ROW *row,       // row to do
+BOOL8 Textord::fixed_pitch_row(TO_ROW *row,       // row to do
                       BLOCK* block,
                       inT32 block_index  // block_number
                      ) {
@@ -1059,7 +1048,7 @@ BOOL8 fixed_pitch_row(TO_ROW *row,       // row to do
  * The return value indicates whether there were any decent values to use.
  **********************************************************************/
 
-BOOL8 count_pitch_stats(                       //find lines
+BOOL8 Textord::count_pitch_stats(                       //find lines
                         TO_ROW *row,           //row to do
                         STATS *gap_stats,      //blob gaps
                         STATS *pitch_stats,    //centre-centre stats
@@ -1147,7 +1136,7 @@ BOOL8 count_pitch_stats(                       //find lines
  * the cell size over the row.
  **********************************************************************/
 
-float tune_row_pitch(                             //find fp cells
+float Textord::tune_row_pitch(                             //find fp cells
                      TO_ROW *row,                 //row to do
                      STATS *projection,           //vertical projection
                      inT16 projection_left,       //edge of projection
@@ -1259,7 +1248,7 @@ float tune_row_pitch(                             //find fp cells
  * the cell size over the row.
  **********************************************************************/
 
-float tune_row_pitch2(                             //find fp cells
+float Textord::tune_row_pitch2(                             //find fp cells
                       TO_ROW *row,                 //row to do
                       STATS *projection,           //vertical projection
                       inT16 projection_left,       //edge of projection
@@ -1376,7 +1365,7 @@ float tune_row_pitch2(                             //find fp cells
  * the cell size over the row.
  **********************************************************************/
 
-float compute_pitch_sd(                            //find fp cells
+float Textord::compute_pitch_sd(                            //find fp cells
                        TO_ROW *row,                //row to do
                        STATS *projection,          //vertical projection
                        inT16 projection_left,      //edge
@@ -1539,7 +1528,7 @@ float compute_pitch_sd(                            //find fp cells
  * the cell size over the row.
  **********************************************************************/
 
-float compute_pitch_sd2(                            //find fp cells
+float Textord::compute_pitch_sd2(                            //find fp cells
                         TO_ROW *row,                //row to do
                         STATS *projection,          //vertical projection
                         inT16 projection_left,      //edge
@@ -1631,7 +1620,7 @@ float compute_pitch_sd2(                            //find fp cells
  * the cell size over the row.
  **********************************************************************/
 
-void print_pitch_sd(                        //find fp cells
+void Textord::print_pitch_sd(                        //find fp cells
                     TO_ROW *row,            //row to do
                     STATS *projection,      //vertical projection
                     inT16 projection_left,  //edges //size of blank
@@ -1752,6 +1741,7 @@ void print_pitch_sd(                        //find fp cells
     word_sync < textord_words_pitchsd_threshold * initial_pitch ? 'F' : 'P',
     occupation, res2, initial_pitch, row->fixed_pitch, row->all_caps);
 }
+}  // namespace tesseract.
 
 /**********************************************************************
  * find_repeated_chars
@@ -1825,7 +1815,8 @@ void find_repeated_chars(TO_BLOCK *block,       // Block to search.
  **********************************************************************/
 
 #ifndef GRAPHICS_DISABLED
-void plot_fp_word(                  //draw block of words
+namespace tesseract {
+void Textord::plot_fp_word(                  //draw block of words
                   TO_BLOCK *block,  //block to draw
                   float pitch,      //pitch to draw with
                   float nonspace    //for space threshold
@@ -1841,4 +1832,5 @@ void plot_fp_word(                  //draw block of words
     plot_word_decisions (to_win, (inT16) pitch, row);
   }
 }
+}  // namespace tesseract.
 #endif
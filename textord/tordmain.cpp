@@ -221,7 +221,7 @@ void Textord::find_components(Pix* pix, BLOCK_LIST *blocks,
        block_it.forward()) {
     BLOCK* block = block_it.data();
     if (block->poly_block() == NULL || block->poly_block()->IsText()) {
-      extract_edges(pix, block);
+      extract_edges(this, pix, block);
     }
   }
 
@@ -20,6 +20,7 @@
 #include "mfcpch.h"
 #include "tovars.h"
 #include "drawtord.h"
+#include "makerow.h"
 #include "textord.h"
 #include "ndminx.h"
 #include "statistc.h"
@@ -36,25 +37,27 @@ void Textord::to_spacing(
     ICOORD page_tr,        //topright of page
     TO_BLOCK_LIST *blocks  //blocks on page
                          ) {
-  TO_BLOCK_IT block_it;          //iterator
-  TO_BLOCK *block;               //current block;
-  TO_ROW_IT row_it;              //row iterator
-  TO_ROW *row;                   //current row
-  int block_index;               //block number
-  int row_index;                 //row number
-  //estimated width of real spaces for whole block
-  inT16 block_space_gap_width;
-  //estimated width of non space gaps for whole block
-  inT16 block_non_space_gap_width;
-  BOOL8 old_text_ord_proportional;//old fixed/prop result
-  GAPMAP *gapmap = NULL;          //map of big vert gaps in blk
-
-  block_it.set_to_list (blocks);
-  block_index = 1;
-  for (block_it.mark_cycle_pt (); !block_it.cycled_list ();
-  block_it.forward ()) {
-    block = block_it.data ();
-    gapmap = new GAPMAP (block);
+  // Each block has its own gapmap and spacing stats, so the blocks are
+  // independent and can be done in parallel.
+  GenericVector<TO_BLOCK*> block_vector;
+  blocks_to_vector(blocks, &block_vector);
+  int block_count = block_vector.size();
+  bool parallel = textord_blocks_in_parallel();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (parallel)
+#endif  // _OPENMP
+  for (int b = 0; b < block_count; ++b) {
+    TO_BLOCK *block = block_vector[b];  //current block;
+    int block_index = b + 1;            //block number
+    TO_ROW_IT row_it;                   //row iterator
+    TO_ROW *row;                        //current row
+    int row_index;                      //row number
+    //estimated width of real spaces for whole block
+    inT16 block_space_gap_width;
+    //estimated width of non space gaps for whole block
+    inT16 block_non_space_gap_width;
+    BOOL8 old_text_ord_proportional;//old fixed/prop result
+    GAPMAP *gapmap = new GAPMAP (this, block);  //map of big vert gaps in blk
     block_spacing_stats(block,
                         gapmap,
                         old_text_ord_proportional,
@@ -100,7 +103,6 @@ void Textord::to_spacing(
       row_index++;
     }
     delete gapmap;
-    block_index++;
   }
 }
 
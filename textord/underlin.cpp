@@ -22,13 +22,10 @@
 #include          <assert.h>
 #endif
 #include          "underlin.h"
+#include          "textord.h"
 
 #define PROJECTION_MARGIN 10     //arbitrary
-#define EXTERN
 
-EXTERN double_VAR (textord_underline_offset, 0.1, "Fraction of x to ignore");
-EXTERN BOOL_VAR (textord_restore_underlines, TRUE,
-"Chop underlines & put back");
 
 /**********************************************************************
  * restore_underlined_blobs
@@ -36,7 +33,8 @@ EXTERN BOOL_VAR (textord_restore_underlines, TRUE,
  * Find underlined blobs and put them back in the row.
  **********************************************************************/
 
-void restore_underlined_blobs(                 //get chop points
+namespace tesseract {
+void Textord::restore_underlined_blobs(                 //get chop points
                               TO_BLOCK *block  //block to do
                              ) {
   inT16 chop_coord;              //chop boundary
@@ -59,7 +57,7 @@ void restore_underlined_blobs(                 //get chop points
   under_it.forward ()) {
     u_line = under_it.extract ();
     blob_box = u_line->bounding_box ();
-    row = most_overlapping_row (block->get_rows (), u_line);
+    row = ::most_overlapping_row (block->get_rows (), u_line);
     find_underlined_blobs (u_line, &row->baseline, row->xheight,
       row->xheight * textord_underline_offset,
       &chop_cells);
@@ -111,6 +109,7 @@ void restore_underlined_blobs(                 //get chop points
     }
   }
 }
+}  // namespace tesseract.
 
 
 /**********************************************************************
@@ -23,13 +23,6 @@
 #include          "fpchop.h"
 #include          "notdll.h"
 
-extern double_VAR_H (textord_underline_offset, 0.1,
-"Fraction of x to ignore");
-extern BOOL_VAR_H (textord_restore_underlines, FALSE,
-"Chop underlines & put back");
-void restore_underlined_blobs(                 //get chop points
-                              TO_BLOCK *block  //block to do
-                             );
 TO_ROW *most_overlapping_row(                    //find best row
                              TO_ROW_LIST *rows,  //list of rows
                              BLOBNBOX *blob      //blob to place
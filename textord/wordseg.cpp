@@ -39,13 +39,6 @@
 #include "config_auto.h"
 #endif
 
-#define EXTERN
-
-EXTERN BOOL_VAR(textord_fp_chopping, TRUE, "Do fixed pitch chopping");
-EXTERN BOOL_VAR(textord_force_make_prop_words, FALSE,
-                "Force proportional word segmentation on all rows");
-EXTERN BOOL_VAR(textord_chopper_test, FALSE,
-                "Chopper is being tested.");
 
 #define FIXED_WIDTH_MULTIPLE  5
 #define BLOCK_STATS_CLUSTERS  10
@@ -102,26 +95,27 @@ void make_single_word(bool one_blob, TO_ROW_LIST *rows, ROW_LIST* real_rows) {
  *
  * Arrange the blobs into words.
  */
-void make_words(tesseract::Textord *textord,
-                ICOORD page_tr,                // top right
-                float gradient,                // page skew
-                BLOCK_LIST *blocks,            // block list
-                TO_BLOCK_LIST *port_blocks) {  // output list
-  TO_BLOCK_IT block_it;          // iterator
-  TO_BLOCK *block;               // current block
-
-  if (textord->use_cjk_fp_model()) {
+namespace tesseract {
+void Textord::make_words(ICOORD page_tr,                // top right
+                         float gradient,                // page skew
+                         BLOCK_LIST *blocks,            // block list
+                         TO_BLOCK_LIST *port_blocks) {  // output list
+  if (use_cjk_fp_model()) {
     compute_fixed_pitch_cjk(page_tr, port_blocks);
   } else {
     compute_fixed_pitch(page_tr, port_blocks, gradient, FCOORD(0.0f, -1.0f),
                         !(BOOL8) textord_test_landscape);
   }
-  textord->to_spacing(page_tr, port_blocks);
-  block_it.set_to_list(port_blocks);
-  for (block_it.mark_cycle_pt(); !block_it.cycled_list(); block_it.forward()) {
-    block = block_it.data();
-    make_real_words(textord, block, FCOORD(1.0f, 0.0f));
-  }
+  to_spacing(page_tr, port_blocks);
+  GenericVector<TO_BLOCK*> block_vector;
+  blocks_to_vector(port_blocks, &block_vector);
+  int block_count = block_vector.size();
+  bool parallel = textord_blocks_in_parallel();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (parallel)
+#endif  // _OPENMP
+  for (int b = 0; b < block_count; ++b)
+    make_real_words(block_vector[b], FCOORD(1.0f, 0.0f));
 }
 
 
@@ -132,7 +126,7 @@ void make_words(tesseract::Textord *textord,
  * the blobs can be arranged into words.
  */
 
-void set_row_spaces(                  //find space sizes
+void Textord::set_row_spaces(                  //find space sizes
                     TO_BLOCK *block,  //block to do
                     FCOORD rotation,  //for drawing
                     BOOL8 testing_on  //correct orientation
@@ -184,7 +178,7 @@ void set_row_spaces(                  //find space sizes
  * Compute the max nonspace and min space for the row.
  */
 
-inT32 row_words(                  //compute space size
+inT32 Textord::row_words(                  //compute space size
                 TO_BLOCK *block,  //block it came from
                 TO_ROW *row,      //row to operate on
                 inT32 maxwidth,   //max expected space size
@@ -357,7 +351,7 @@ inT32 row_words(                  //compute space size
  * Compute the max nonspace and min space for the row.
  */
 
-inT32 row_words2(                  //compute space size
+inT32 Textord::row_words2(                  //compute space size
                  TO_BLOCK *block,  //block it came from
                  TO_ROW *row,      //row to operate on
                  inT32 maxwidth,   //max expected space size
@@ -513,8 +507,7 @@ inT32 row_words2(                  //compute space size
  * Convert a TO_BLOCK to a BLOCK.
  */
 
-void make_real_words(
-                     tesseract::Textord *textord,
+void Textord::make_real_words(
                      TO_BLOCK *block,  //block to do
                      FCOORD rotation   //for drawing
                     ) {
@@ -537,12 +530,12 @@ void make_real_words(
       // with force_make_prop_words flag.
       POLY_BLOCK* pb = block->block->poly_block();
       if (textord_chopper_test) {
-        real_row = textord->make_blob_words (row, rotation);
+        real_row = make_blob_words (row, rotation);
       } else if (textord_force_make_prop_words ||
                  (pb != NULL && !pb->IsText()) ||
                  row->pitch_decision == PITCH_DEF_PROP ||
                  row->pitch_decision == PITCH_CORR_PROP) {
-        real_row = textord->make_prop_words (row, rotation);
+        real_row = make_prop_words (row, rotation);
       } else if (row->pitch_decision == PITCH_DEF_FIXED ||
                  row->pitch_decision == PITCH_CORR_FIXED) {
         real_row = fixed_pitch_words (row, rotation);
@@ -560,6 +553,7 @@ void make_real_words(
     (inT16) block->fixed_pitch);
   block->block->check_pitch ();
 }
+}  // namespace tesseract.
 
 
 /**
@@ -29,42 +29,8 @@ namespace tesseract {
 class Tesseract;
 }
 
-extern BOOL_VAR_H (textord_fp_chopping, TRUE, "Do fixed pitch chopping");
-extern BOOL_VAR_H(textord_force_make_prop_words, FALSE,
-                  "Force proportional word segmentation on all rows");
-extern BOOL_VAR_H (textord_chopper_test, FALSE,
-                   "Chopper is being tested.");
 
 void make_single_word(bool one_blob, TO_ROW_LIST *rows, ROW_LIST* real_rows);
-void make_words(tesseract::Textord *textord,
-                ICOORD page_tr,                // top right
-                float gradient,               // page skew
-                BLOCK_LIST *blocks,           // block list
-                TO_BLOCK_LIST *port_blocks);  // output list
-void set_row_spaces(                  //find space sizes
-                    TO_BLOCK *block,  //block to do
-                    FCOORD rotation,  //for drawing
-                    BOOL8 testing_on  //correct orientation
-                   );
-inT32 row_words(                  //compute space size
-                TO_BLOCK *block,  //block it came from
-                TO_ROW *row,      //row to operate on
-                inT32 maxwidth,   //max expected space size
-                FCOORD rotation,  //for drawing
-                BOOL8 testing_on  //for debug
-               );
-inT32 row_words2(                  //compute space size
-                 TO_BLOCK *block,  //block it came from
-                 TO_ROW *row,      //row to operate on
-                 inT32 maxwidth,   //max expected space size
-                 FCOORD rotation,  //for drawing
-                 BOOL8 testing_on  //for debug
-                );
-void make_real_words(
-                     tesseract::Textord *textord,
-                     TO_BLOCK *block,  //block to do
-                     FCOORD rotation   //for drawing
-                    );
 ROW *make_rep_words(                 //make a row
                     TO_ROW *row,     //row to convert
                     TO_BLOCK *block  //block it lives in
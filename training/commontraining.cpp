@@ -54,6 +54,7 @@ CLUSTERCONFIG Config = { elliptical, 0.625, 0.05, 1.0, 1e-6, 0 };
 
 INT_PARAM_FLAG(debug_level, 0, "Level of Trainer debugging");
 INT_PARAM_FLAG(load_images, 0, "Load images with tr files");
+INT_PARAM_FLAG(write_trb, 0, "Convert tr files to binary trb files as read");
 STRING_PARAM_FLAG(configfile, "", "File to load more configs from");
 STRING_PARAM_FLAG(D, "", "Directory to write output files to");
 STRING_PARAM_FLAG(F, "font_properties", "File listing font properties");
@@ -229,7 +230,9 @@ void WriteShapeTable(const STRING& file_prefix, const ShapeTable& shape_table) {
 // If FLAGS_input_trainer is set, loads the majority of data from there, else:
 //   Loads font info from -F option.
 //   Loads xheights from -X option.
-//   Loads samples from .tr files in remaining command-line args.
+//   Loads samples from .tr files in remaining command-line args. Files
+//   ending in .trb are binary sample files, which are memory-mapped instead
+//   of parsed. With FLAGS_write_trb, a .trb is written for each .tr read.
 //   Deletes outliers and computes canonical samples.
 //   If FLAGS_output_trainer is set, saves the trainer for future use.
 // Computes canonical and cloud features.
@@ -284,25 +287,40 @@ MasterTrainer* LoadTrainingData(int argc, const char* const * argv,
     // Load training data from .tr files on the command line.
     while ((page_name = GetNextFilename(argc, argv)) != NULL) {
       tprintf("Reading %s ...\n", page_name);
-      FILE* fp = Efopen(page_name, "rb");
-      trainer->ReadTrainingSamples(fp, feature_defs, false);
-      fclose(fp);
+      // The name without the tr or trb extension, but keeping the dot.
+      STRING base_name = page_name;
+      const char* extension = strrchr(page_name, '.');
+      if (extension != NULL)
+        base_name.truncate_at(extension + 1 - page_name);
+      if (extension != NULL && strcmp(extension, ".trb") == 0) {
+        if (!trainer->ReadSampleStore(page_name, false)) {
+          delete trainer;
+          return NULL;
+        }
+      } else {
+        SampleStoreWriter writer;
+        bool writing = false;
+        if (FLAGS_write_trb) {
+          STRING trb_name = base_name + "trb";
+          writing = writer.Open(trb_name.string());
+        }
+        FILE* fp = Efopen(page_name, "rb");
+        trainer->ReadTrainingSamples(fp, feature_defs, false,
+                                     writing ? &writer : NULL);
+        fclose(fp);
+        if (writing && !writer.Close())
+          tprintf("Failed to write binary sample file for %s\n", page_name);
+      }
 
       // If there is a file with [lang].[fontname].exp[num].fontinfo present,
       // read font spacing information in to fontinfo_table.
-      int pagename_len = strlen(page_name);
-      char *fontinfo_file_name = new char[pagename_len + 7];
-      strncpy(fontinfo_file_name, page_name, pagename_len - 2);  // remove "tr"
-      strcpy(fontinfo_file_name + pagename_len - 2, "fontinfo");  // +"fontinfo"
-      trainer->AddSpacingInfo(fontinfo_file_name);
-      delete[] fontinfo_file_name;
+      STRING fontinfo_file_name = base_name + "fontinfo";
+      trainer->AddSpacingInfo(fontinfo_file_name.string());
 
       // Load the images into memory if required by the classifier.
       if (FLAGS_load_images) {
-        STRING image_name = page_name;
-        // Chop off the tr and replace with tif. Extension must be tif!
-        image_name.truncate_at(image_name.length() - 2);
-        image_name += "tif";
+        // Replace the extension with tif. Extension must be tif!
+        STRING image_name = base_name + "tif";
         trainer->LoadPageImages(image_name.string());
       }
     }
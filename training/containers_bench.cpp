@@ -0,0 +1,229 @@
+///////////////////////////////////////////////////////////////////////
+// File:        containers_bench.cpp
+// Description: Times GenericVector and STRING on the patterns of use
+//              seen during recognition.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+///////////////////////////////////////////////////////////////////////
+
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "genericvector.h"
+#include "strngs.h"
+
+// Usage:
+//   containers_bench [-runs n]
+//
+// Runs each case n times over (default 10) and prints the CPU time and the
+// number of calls to operator new per run. GenericVector allocates with
+// new[], so the count shows its allocations. STRING allocates with malloc
+// through alloc_string, so for the STRING cases only the time means
+// anything. The cases are:
+//   short_strings: makes, copies and appends to STRINGs of 1-12 chars, the
+//     usual length of a unichar or word.
+//   long_strings: the same with 40-100 chars, as in debug output.
+//   small_vectors: makes and fills GenericVector<int>s of 0-20 elements, as
+//     for the choices of a blob, most of which stay empty or small.
+//   string_growth: push_back of STRINGs onto a GenericVector<STRING>, which
+//     relocates the STRINGs every time the array grows.
+//   nested_growth: push_back of GenericVector<int>s onto a vector of them.
+//   sort_ints: GenericVector<int>::sort of a random array.
+//   sort_pairs: sort of a GenericVector of a struct with operator<.
+
+// The exception specifications of the replaced operators changed in C++11.
+#if __cplusplus >= 201103L
+#define THROWS_BAD_ALLOC
+#define THROWS_NOTHING noexcept
+#else
+#define THROWS_BAD_ALLOC throw(std::bad_alloc)
+#define THROWS_NOTHING throw()
+#endif
+
+static int num_news = 0;
+
+void* operator new(size_t size) THROWS_BAD_ALLOC {
+  ++num_news;
+  void* ptr = malloc(size > 0 ? size : 1);
+  if (ptr == NULL)
+    throw std::bad_alloc();
+  return ptr;
+}
+void* operator new[](size_t size) THROWS_BAD_ALLOC {
+  ++num_news;
+  void* ptr = malloc(size > 0 ? size : 1);
+  if (ptr == NULL)
+    throw std::bad_alloc();
+  return ptr;
+}
+void operator delete(void* ptr) THROWS_NOTHING {
+  free(ptr);
+}
+void operator delete[](void* ptr) THROWS_NOTHING {
+  free(ptr);
+}
+
+// Simple deterministic random numbers, so every build sees the same data.
+static unsigned int random_state = 1;
+static int Random(int range) {
+  random_state = random_state * 1103515245 + 12345;
+  return static_cast<int>((random_state >> 16) % range);
+}
+
+// A type with operator< but no specialization for moving it.
+struct ScoredIndex {
+  bool operator<(const ScoredIndex& other) const {
+    return score < other.score;
+  }
+  float score;
+  int index;
+};
+
+// Fills str with length random lower case letters.
+static void RandomWord(int length, char* str) {
+  for (int i = 0; i < length; ++i)
+    str[i] = 'a' + Random(26);
+  str[length] = '\0';
+}
+
+static int ShortStrings(int min_length, int max_length) {
+  const int kNumStrings = 200000;
+  char word[128];
+  int total_length = 0;
+  for (int i = 0; i < kNumStrings; ++i) {
+    RandomWord(min_length + Random(max_length - min_length + 1), word);
+    STRING str(word);
+    STRING copy(str);
+    copy += 's';
+    str = copy;
+    total_length += str.length();
+  }
+  return total_length;
+}
+
+static int SmallVectors() {
+  const int kNumVectors = 200000;
+  int total = 0;
+  for (int i = 0; i < kNumVectors; ++i) {
+    GenericVector<int> choices;
+    // Most blobs have no or few choices.
+    int size = Random(3) == 0 ? Random(21) : Random(3);
+    for (int j = 0; j < size; ++j)
+      choices.push_back(j);
+    total += choices.size();
+  }
+  return total;
+}
+
+static int StringGrowth() {
+  const int kNumLists = 200;
+  const int kListSize = 1000;
+  char word[16];
+  int total = 0;
+  for (int i = 0; i < kNumLists; ++i) {
+    GenericVector<STRING> words;
+    for (int j = 0; j < kListSize; ++j) {
+      RandomWord(1 + Random(12), word);
+      words.push_back(STRING(word));
+    }
+    total += words.size();
+  }
+  return total;
+}
+
+static int NestedGrowth() {
+  const int kNumLists = 200;
+  const int kListSize = 1000;
+  int total = 0;
+  for (int i = 0; i < kNumLists; ++i) {
+    GenericVector<GenericVector<int> > lists;
+    for (int j = 0; j < kListSize; ++j) {
+      GenericVector<int> list;
+      list.push_back(j);
+      lists.push_back(list);
+    }
+    total += lists.size();
+  }
+  return total;
+}
+
+static int SortInts() {
+  const int kSize = 1000000;
+  GenericVector<int> values;
+  values.reserve(kSize);
+  for (int i = 0; i < kSize; ++i)
+    values.push_back(Random(kSize));
+  values.sort();
+  return values[kSize / 2];
+}
+
+static int SortPairs() {
+  const int kSize = 1000000;
+  GenericVector<ScoredIndex> values;
+  values.reserve(kSize);
+  for (int i = 0; i < kSize; ++i) {
+    ScoredIndex value;
+    value.score = Random(kSize) / 1000.0f;
+    value.index = i;
+    values.push_back(value);
+  }
+  values.sort();
+  return static_cast<int>(values[kSize / 2].score * 1000);
+}
+
+// Runs case_number num_runs times and prints the time and operator new
+// calls per run.
+static void RunCase(int case_number, const char* name, int num_runs) {
+  int result = 0;
+  random_state = 1;
+  num_news = 0;
+  clock_t start = clock();
+  for (int run = 0; run < num_runs; ++run) {
+    switch (case_number) {
+      case 0: result += ShortStrings(1, 12); break;
+      case 1: result += ShortStrings(40, 100); break;
+      case 2: result += SmallVectors(); break;
+      case 3: result += StringGrowth(); break;
+      case 4: result += NestedGrowth(); break;
+      case 5: result += SortInts(); break;
+      case 6: result += SortPairs(); break;
+    }
+  }
+  double ms = 1000.0 * (clock() - start) / CLOCKS_PER_SEC / num_runs;
+  // The result is printed so the work can't be optimized away.
+  printf("%-14s %10.2f ms/run %12d news/run  (result %d)\n",
+         name, ms, num_news / num_runs, result);
+}
+
+int main(int argc, char **argv) {
+  int num_runs = 10;
+  if (argc == 3 && strcmp(argv[1], "-runs") == 0) {
+    num_runs = atoi(argv[2]);
+  } else if (argc != 1) {
+    fprintf(stderr, "Usage: %s [-runs n]\n", argv[0]);
+    return 1;
+  }
+  if (num_runs < 1)
+    num_runs = 1;
+  printf("sizeof(STRING)=%d sizeof(GenericVector<int>)=%d, %d runs\n",
+         static_cast<int>(sizeof(STRING)),
+         static_cast<int>(sizeof(GenericVector<int>)), num_runs);
+  const char* kCaseNames[] = {
+    "short_strings", "long_strings", "small_vectors", "string_growth",
+    "nested_growth", "sort_ints", "sort_pairs"
+  };
+  for (int c = 0; c < 7; ++c)
+    RunCase(c, kCaseNames[c], num_runs);
+  return 0;
+}
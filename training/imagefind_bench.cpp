@@ -0,0 +1,151 @@
+///////////////////////////////////////////////////////////////////////
+// File:        imagefind_bench.cpp
+// Description: Times the ImageFind helpers that scan image pixels.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+///////////////////////////////////////////////////////////////////////
+
+// Include automatically generated configuration file if running autoconf
+#ifdef HAVE_CONFIG_H
+#include "config_auto.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "allheaders.h"
+#include "imagefind.h"
+#include "rect.h"
+
+// Usage:
+//   imagefind_bench [-runs n]
+//
+// Makes an image mask and a colour image, and times the ImageFind helpers
+// that scan their pixels, each n times over (default 10). Prints the CPU
+// time per call, and the results, so that different builds can be checked
+// to agree. The cases are:
+//   rectangularize: pixNearlyRectangular on the mask of a photo with a
+//     caption and speckle merged on, as ConnCompAndRectangularize gets it.
+//   rectangle_colors: ComputeRectangleColors of a picture with two colours
+//     and noise, as ColPartitionGrid::ComputePartitionColors does for each
+//     image and text partition.
+
+using tesseract::ImageFind;
+
+// Size of the mask image.
+const int kMaskWidth = 2000;
+const int kMaskHeight = 1500;
+// Size of the colour image.
+const int kColorWidth = 1000;
+const int kColorHeight = 800;
+// Number of calls per run in each case.
+const int kCallsPerRun = 20;
+
+// Simple deterministic random numbers, so every build sees the same images.
+static unsigned int random_state = 1;
+static int Random(int range) {
+  random_state = random_state * 1103515245 + 12345;
+  return static_cast<int>((random_state >> 16) % range);
+}
+
+// Sets all the pixels of pix in x=[x_start,x_end), y=[y_start,y_end).
+static void SetRect(int x_start, int y_start, int x_end, int y_end,
+                    Pix* pix) {
+  for (int y = y_start; y < y_end; ++y) {
+    for (int x = x_start; x < x_end; ++x)
+      pixSetPixel(pix, x, y, 1);
+  }
+}
+
+// Makes the mask of a photo with a caption merged onto its bottom and
+// 2% speckle all over.
+static Pix* MakeMask() {
+  Pix* pix = pixCreate(kMaskWidth, kMaskHeight, 1);
+  SetRect(200, 150, 1800, 1250, pix);
+  SetRect(300, 1250, 450, 1310, pix);
+  for (int y = 0; y < kMaskHeight; ++y) {
+    for (int x = 0; x < kMaskWidth; ++x) {
+      if (Random(50) == 0)
+        pixSetPixel(pix, x, y, 1);
+    }
+  }
+  return pix;
+}
+
+// Returns value plus noise of up to 8 either way, clipped to a byte.
+static int AddNoise(int value) {
+  value += Random(17) - 8;
+  return value < 0 ? 0 : (value > 255 ? 255 : value);
+}
+
+// Makes a picture of dark blue strokes on a light background, with noise.
+static Pix* MakeColorImage() {
+  Pix* pix = pixCreate(kColorWidth, kColorHeight, 32);
+  for (int y = 0; y < kColorHeight; ++y) {
+    for (int x = 0; x < kColorWidth; ++x) {
+      bool dark = (x / 7 + y / 11) % 5 == 0;
+      int r = AddNoise(dark ? 30 : 230);
+      int g = AddNoise(dark ? 40 : 220);
+      int b = AddNoise(dark ? 120 : 200);
+      pixSetPixel(pix, x, y, ImageFind::ComposeRGB(r, g, b));
+    }
+  }
+  return pix;
+}
+
+int main(int argc, char **argv) {
+  int num_runs = 10;
+  if (argc == 3 && strcmp(argv[1], "-runs") == 0) {
+    num_runs = atoi(argv[2]);
+  } else if (argc != 1) {
+    fprintf(stderr, "Usage: %s [-runs n]\n", argv[0]);
+    return 1;
+  }
+  if (num_runs < 1)
+    num_runs = 1;
+  Pix* mask = MakeMask();
+  Pix* color_pix = MakeColorImage();
+  printf("%d runs of %d calls\n", num_runs, kCallsPerRun);
+
+  int x_start = 0, y_start = 0, x_end = 0, y_end = 0;
+  bool rectangular = false;
+  clock_t start = clock();
+  for (int call = 0; call < num_runs * kCallsPerRun; ++call) {
+    rectangular = ImageFind::pixNearlyRectangular(mask, 0.125, 0.75, 0.1,
+                                                  &x_start, &y_start,
+                                                  &x_end, &y_end);
+  }
+  double ms = 1000.0 * (clock() - start) / CLOCKS_PER_SEC /
+      (num_runs * kCallsPerRun);
+  printf("%-17s %10.3f ms/call  (%s, %d,%d to %d,%d)\n", "rectangularize",
+         ms, rectangular ? "rectangular" : "not rectangular",
+         x_start, y_start, x_end, y_end);
+
+  TBOX rect(0, 0, kColorWidth, kColorHeight);
+  uinT8 color1[4];
+  uinT8 color2[4];
+  start = clock();
+  for (int call = 0; call < num_runs * kCallsPerRun; ++call) {
+    ImageFind::ComputeRectangleColors(rect, color_pix, 1, NULL, NULL, NULL,
+                                      color1, color2);
+  }
+  ms = 1000.0 * (clock() - start) / CLOCKS_PER_SEC /
+      (num_runs * kCallsPerRun);
+  printf("%-17s %10.3f ms/call  (%d,%d,%d,%d to %d,%d,%d,%d)\n",
+         "rectangle_colors", ms, color1[0], color1[1], color1[2], color1[3],
+         color2[0], color2[1], color2[2], color2[3]);
+
+  pixDestroy(&mask);
+  pixDestroy(&color_pix);
+  return 0;
+}
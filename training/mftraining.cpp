@@ -126,8 +126,9 @@ static void DisplayProtoList(const char* ch, LIST protolist) {
 
 // Helper to run clustering on a single config.
 // Mostly copied from the old mftraining, but with renamed variables.
+// Returns the list of significant protos. Uses only a private copy of the
+// global Config, so it may be run concurrently for different configs.
 static LIST ClusterOneConfig(int shape_id, const char* class_label,
-                             LIST mf_classes,
                              const ShapeTable& shape_table,
                              MasterTrainer* trainer) {
   int num_samples;
@@ -135,13 +136,14 @@ static LIST ClusterOneConfig(int shape_id, const char* class_label,
                                                       feature_defs,
                                                       shape_id,
                                                       &num_samples);
-  Config.MagicSamples = num_samples;
-  LIST proto_list = ClusterSamples(clusterer, &Config);
+  CLUSTERCONFIG config = Config;
+  config.MagicSamples = num_samples;
+  LIST proto_list = ClusterSamples(clusterer, &config);
   CleanUpUnusedData(proto_list);
 
   // Merge protos where reasonable to make more of them significant by
   // representing almost all samples of the class/font.
-  MergeInsignificantProtos(proto_list, class_label, clusterer, &Config);
+  MergeInsignificantProtos(proto_list, class_label, clusterer, &config);
   #ifndef GRAPHICS_DISABLED
   if (strcmp(FLAGS_test_ch.c_str(), class_label) == 0)
     DisplayProtoList(FLAGS_test_ch.c_str(), proto_list);
@@ -151,6 +153,14 @@ static LIST ClusterOneConfig(int shape_id, const char* class_label,
                                          false,
                                          clusterer->SampleSize);
   FreeClusterer(clusterer);
+  return proto_list;
+}
+
+// Helper to merge the protos of a single config, as produced by
+// ClusterOneConfig, into the matching class of mf_classes.
+// Takes ownership of proto_list.
+static LIST MergeOneConfig(int shape_id, const char* class_label,
+                           LIST proto_list, LIST mf_classes) {
   MERGE_CLASS merge_class = FindClass(mf_classes, class_label);
   if (merge_class == NULL) {
     merge_class = NewLabeledClass(class_label);
@@ -284,9 +294,11 @@ int main (int argc, char **argv) {
     }
   }
 
-  // Now train each config separately.
+  // Now train each config separately. The clustering of the configs is
+  // independent, so it runs in parallel, but the merging of the resulting
+  // protos into classes is order-dependent, so it is done serially.
   int num_configs = shape_table->NumShapes();
-  LIST mf_classes = NIL_LIST;
+  GenericVector<const char*> class_labels;
   for (int s = 0; s < num_configs; ++s) {
     int unichar_id, font_id;
     if (unicharset == &shape_set) {
@@ -296,9 +308,21 @@ int main (int argc, char **argv) {
       // Get the real unichar_id from the shape table/unicharset.
       shape_table->GetFirstUnicharAndFont(s, &unichar_id, &font_id);
     }
-    const char* class_label = unicharset->id_to_unichar(unichar_id);
-    mf_classes = ClusterOneConfig(s, class_label, mf_classes, *shape_table,
-                                  trainer);
+    class_labels.push_back(unicharset->id_to_unichar(unichar_id));
+  }
+  GenericVector<LIST> proto_lists;
+  proto_lists.init_to_size(num_configs, NIL_LIST);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif  // _OPENMP
+  for (int s = 0; s < num_configs; ++s) {
+    proto_lists[s] = ClusterOneConfig(s, class_labels[s], *shape_table,
+                                      trainer);
+  }
+  LIST mf_classes = NIL_LIST;
+  for (int s = 0; s < num_configs; ++s) {
+    mf_classes = MergeOneConfig(s, class_labels[s], proto_lists[s],
+                                mf_classes);
   }
   STRING inttemp_file = file_prefix;
   inttemp_file += "inttemp";
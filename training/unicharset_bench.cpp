@@ -0,0 +1,223 @@
+///////////////////////////////////////////////////////////////////////
+// File:        unicharset_bench.cpp
+// Description: Times unichar lookups and property getters of a
+//              UNICHARSET.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+///////////////////////////////////////////////////////////////////////
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "genericvector.h"
+#include "strngs.h"
+#include "unichar.h"
+#include "unicharset.h"
+
+// Usage:
+//   unicharset_bench [-runs n] [-han n] [unicharset_file]
+//
+// Loads the given unicharset, or makes one of ASCII, Latin-1, Latin
+// Extended-A and -han Han characters (default 3000), and runs each case
+// -runs times over (default 10). Prints the CPU time per run and per
+// call. The cases are:
+//   unichar_to_id: looks up every unichar by its nul-terminated string.
+//   unichar_to_id_len: the same, with the length given, as when a word is
+//     split into unichars.
+//   contains_missing: contains_unichar on strings that are not in the set.
+//   step: UNICHARSET::step over a text made of all the unichars.
+//   properties: get_isalpha, get_islower, get_isupper, get_isdigit,
+//     get_ispunctuation, get_script and get_other_case of every unichar id
+//     in a shuffled order, as Dict and LanguageModel do for each choice.
+
+const int kNumCases = 5;
+
+// Adds the character with the given unicode value to unicharset and sets
+// its properties the way a training run would for it.
+static void AddUnicode(int unicode, const char* script,
+                       UNICHARSET* unicharset) {
+  UNICHAR uni(unicode);
+  char* utf8 = uni.utf8_str();
+  unicharset->unichar_insert(utf8);
+  UNICHAR_ID id = unicharset->unichar_to_id(utf8);
+  delete [] utf8;
+  bool is_ascii = unicode < 128;
+  bool is_upper = is_ascii ? isupper(unicode) != 0
+                           : (unicode >= 0xc0 && unicode < 0xdf) ||
+                             (unicode >= 0x100 && unicode < 0x180 &&
+                              unicode % 2 == 0);
+  bool is_lower = is_ascii ? islower(unicode) != 0
+                           : (unicode >= 0xdf && unicode < 0x100) ||
+                             (unicode >= 0x100 && unicode < 0x180 &&
+                              unicode % 2 == 1);
+  unicharset->set_isalpha(id, is_ascii ? isalpha(unicode) != 0
+                                       : unicode >= 0xc0);
+  unicharset->set_isupper(id, is_upper);
+  unicharset->set_islower(id, is_lower);
+  unicharset->set_isdigit(id, is_ascii && isdigit(unicode));
+  unicharset->set_ispunctuation(id, is_ascii && ispunct(unicode));
+  unicharset->set_script(id, script);
+}
+
+// Simple deterministic random numbers, so every run sees the same order.
+static unsigned int random_state = 1;
+static int Random(int range) {
+  random_state = random_state * 1103515245 + 12345;
+  return static_cast<int>((random_state >> 16) % range);
+}
+
+// Makes a unicharset like one of a European language with some Han.
+static void MakeUnicharset(int num_han_chars, UNICHARSET* unicharset) {
+  for (int unicode = 0x21; unicode < 0x7f; ++unicode)
+    AddUnicode(unicode, "Latin", unicharset);
+  for (int unicode = 0xa1; unicode < 0x180; ++unicode)
+    AddUnicode(unicode, "Latin", unicharset);
+  for (int unicode = 0x4e00; unicode < 0x4e00 + num_han_chars; ++unicode)
+    AddUnicode(unicode, "Han", unicharset);
+  // Pair up the cases of the ASCII letters.
+  for (int unicode = 'A'; unicode <= 'Z'; ++unicode) {
+    char upper[2] = { static_cast<char>(unicode), '\0' };
+    char lower[2] = { static_cast<char>(unicode - 'A' + 'a'), '\0' };
+    UNICHAR_ID upper_id = unicharset->unichar_to_id(upper);
+    UNICHAR_ID lower_id = unicharset->unichar_to_id(lower);
+    unicharset->set_other_case(upper_id, lower_id);
+    unicharset->set_other_case(lower_id, upper_id);
+  }
+}
+
+// Runs case_number over unicharset once and returns a sum of the results,
+// so the work can't be optimized away. Adds the number of calls made to
+// *num_calls.
+static int RunCaseOnce(int case_number, const UNICHARSET& unicharset,
+                       const GenericVector<STRING>& unichars,
+                       const GenericVector<STRING>& missing,
+                       const STRING& text, const GenericVector<int>& order,
+                       int* num_calls) {
+  int total = 0;
+  switch (case_number) {
+    case 0:
+      for (int i = 0; i < unichars.size(); ++i)
+        total += unicharset.unichar_to_id(unichars[i].string());
+      *num_calls += unichars.size();
+      break;
+    case 1:
+      for (int i = 0; i < unichars.size(); ++i) {
+        total += unicharset.unichar_to_id(unichars[i].string(),
+                                          unichars[i].length());
+      }
+      *num_calls += unichars.size();
+      break;
+    case 2:
+      for (int i = 0; i < missing.size(); ++i)
+        total += unicharset.contains_unichar(missing[i].string());
+      *num_calls += missing.size();
+      break;
+    case 3:
+      for (const char* ptr = text.string(); *ptr != '\0';) {
+        int step = unicharset.step(ptr);
+        if (step == 0)
+          step = 1;
+        ptr += step;
+        ++total;
+        ++*num_calls;
+      }
+      break;
+    case 4:
+      for (int i = 0; i < order.size(); ++i) {
+        UNICHAR_ID id = order[i];
+        total += unicharset.get_isalpha(id) + unicharset.get_islower(id) +
+                 unicharset.get_isupper(id) + unicharset.get_isdigit(id) +
+                 unicharset.get_ispunctuation(id) +
+                 unicharset.get_script(id) + unicharset.get_other_case(id);
+      }
+      *num_calls += 7 * order.size();
+      break;
+  }
+  return total;
+}
+
+int main(int argc, char **argv) {
+  int num_runs = 10;
+  int num_han_chars = 3000;
+  const char* filename = NULL;
+  for (int arg = 1; arg < argc; ++arg) {
+    if (strcmp(argv[arg], "-runs") == 0 && arg + 1 < argc) {
+      num_runs = atoi(argv[++arg]);
+    } else if (strcmp(argv[arg], "-han") == 0 && arg + 1 < argc) {
+      num_han_chars = atoi(argv[++arg]);
+    } else if (filename == NULL && argv[arg][0] != '-') {
+      filename = argv[arg];
+    } else {
+      fprintf(stderr, "Usage: %s [-runs n] [-han n] [unicharset_file]\n",
+              argv[0]);
+      return 1;
+    }
+  }
+  if (num_runs < 1)
+    num_runs = 1;
+  UNICHARSET unicharset;
+  if (filename != NULL) {
+    if (!unicharset.load_from_file(filename)) {
+      fprintf(stderr, "Could not load unicharset %s\n", filename);
+      return 1;
+    }
+  } else {
+    MakeUnicharset(num_han_chars, &unicharset);
+  }
+  GenericVector<STRING> unichars;
+  GenericVector<STRING> missing;
+  STRING text;
+  for (int id = 0; id < unicharset.size(); ++id) {
+    STRING unichar = unicharset.id_to_unichar(id);
+    // A loaded unicharset has the space, which is not a unichar in a text.
+    if (unichar == " ")
+      continue;
+    unichars.push_back(unichar);
+    text += unichar;
+    unichar += "\x7f";
+    missing.push_back(unichar);
+  }
+  GenericVector<int> order;
+  for (int id = 0; id < unicharset.size(); ++id)
+    order.push_back(id);
+  for (int i = order.size() - 1; i > 0; --i) {
+    int j = Random(i + 1);
+    int tmp = order[i];
+    order[i] = order[j];
+    order[j] = tmp;
+  }
+  printf("%d unichars, %d runs\n", unicharset.size(), num_runs);
+  const char* kCaseNames[kNumCases] = {
+    "unichar_to_id", "unichar_to_id_len", "contains_missing", "step",
+    "properties"
+  };
+  // Repeat each pass enough times for the clock to see it.
+  int repeats = 1 + 200000 / (unicharset.size() + 1);
+  for (int c = 0; c < kNumCases; ++c) {
+    int result = 0;
+    int num_calls = 0;
+    clock_t start = clock();
+    for (int run = 0; run < num_runs; ++run) {
+      for (int r = 0; r < repeats; ++r) {
+        result += RunCaseOnce(c, unicharset, unichars, missing, text, order,
+                              &num_calls);
+      }
+    }
+    double seconds = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+    printf("%-18s %10.2f ms/run %8.2f ns/call  (result %d)\n",
+           kCaseNames[c], 1000.0 * seconds / num_runs,
+           num_calls > 0 ? 1e9 * seconds / num_calls : 0.0, result);
+  }
+  return 0;
+}
@@ -48,8 +48,6 @@
 
 #define EXTERN
 
-EXTERN STRING_VAR (fx_debugfile, DEBUG_WIN_NAME, "Name of debugfile");
-
 EXTERN ScrollView* fx_win = NULL;
 EXTERN FILE *fx_debug = NULL;
 
@@ -24,7 +24,6 @@
 #include          "notdll.h"
 #include	  "scrollview.h"
 
-extern STRING_VAR_H (fx_debugfile, DEBUG_WIN_NAME, "Name of debugfile");
 extern ScrollView* fx_win;
 extern FILE *fx_debug;
 void create_fx_win();  //make features win
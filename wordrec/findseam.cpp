@@ -393,7 +393,8 @@ SEAM *Wordrec::pick_good_seam(TBLOB *blob) {
   if (chop_debug > 2)
     wordrec_display_splits.set_value(true);
 
-  draw_blob_edges(blob);
+  if (wordrec_display_splits)
+    draw_blob_edges(blob);
 #endif
 
   point_heap = MakeHeap (MAX_NUM_POINTS);
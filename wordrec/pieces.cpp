@@ -26,6 +26,7 @@
           I n c l u d e s
 ----------------------------------------------------------------------*/
 
+#include "baseline.h"
 #include "blobs.h"
 #include "freelist.h"
 #include "helpers.h"
@@ -414,7 +415,19 @@ TBOX *Wordrec::record_blob_bounds(TBLOB *blobs) {
 MATRIX *Wordrec::record_piece_ratings(TBLOB *blobs) {
   inT16 num_blobs = count_blobs(blobs);
   TBOX *bounds = record_blob_bounds(blobs);
-  MATRIX *ratings = new MATRIX(num_blobs);
+  // Start the band wide enough for the pieces that pass the shape test of
+  // the segmentation search, which are the ones it will classify. Any wider
+  // piece that gets classified widens the band.
+  int bandwidth = 1;
+  for (int x = 0; x < num_blobs; x++) {
+    int y = x + bandwidth;
+    while (y < num_blobs &&
+           bounds_of_piece(bounds, x, y).width() <=
+               segsearch_max_char_wh_ratio * BASELINE_SCALE)
+      ++y;
+    bandwidth = y - x;
+  }
+  MATRIX *ratings = new MATRIX(num_blobs, bandwidth);
 
   for (int x = 0; x < num_blobs; x++) {
     for (int y = x; y < num_blobs; y++) {
@@ -78,12 +78,10 @@ void draw_blob_edges(TBLOB *blob) {
   TESSLINE *ol;
   LIST edge_list = NIL_LIST;
 
-  if (wordrec_display_splits) {
-    for (ol = blob->outlines; ol != NULL; ol = ol->next)
-      push_on (edge_list, ol->loop);
-    display_edgepts(edge_list);
-    destroy(edge_list);
-  }
+  for (ol = blob->outlines; ol != NULL; ol = ol->next)
+    push_on (edge_list, ol->loop);
+  display_edgepts(edge_list);
+  destroy(edge_list);
 }
 
 
@@ -41,7 +41,8 @@ extern ScrollView *edge_window;        /* Window for edges */
 /**********************************************************************
  * update_edge_window
  *
- * Refresh the display of the edge window.
+ * Refresh the display of the edge window. This and edge_window_wait
+ * must be used inside Wordrec methods, which own wordrec_display_splits.
  **********************************************************************/
 #define update_edge_window()             \
 if (wordrec_display_splits) {                  \
@@ -45,8 +45,6 @@
 ----------------------------------------------------------------------*/
 ScrollView *segm_window = NULL;
 
-INT_VAR(wordrec_display_segmentations, 0, "Display Segmentations");
-
 /*----------------------------------------------------------------------
               F u n c t i o n s
 ----------------------------------------------------------------------*/
@@ -35,7 +35,6 @@
               V a r i a b l e s
 ----------------------------------------------------------------------*/
 extern ScrollView *segm_window;
-extern INT_VAR_H(wordrec_display_segmentations, 0, "Display Segmentations");
 
 /*----------------------------------------------------------------------
               F u n c t i o n s
@@ -35,12 +35,6 @@
 extern ScrollView *blob_window;        /* Window for blobs */
 extern C_COL color_list[];       /* Colors for outlines */
 
-extern BOOL_VAR_H(wordrec_display_all_blobs, 0, "Display Blobs");
-
-extern BOOL_VAR_H(wordrec_display_all_words, 0, "Display Words");
-
-extern BOOL_VAR_H(wordrec_blob_pause, 0, "Blob pause");
-
 #define NUM_COLORS 6
 
 /*----------------------------------------------------------------------
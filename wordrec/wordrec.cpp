@@ -130,7 +130,13 @@ Wordrec::Wordrec() :
   BOOL_MEMBER(save_alt_choices, false,
               "Save alternative paths found during chopping"
               " and segmentation search",
-              params()) {
+              params()),
+  BOOL_MEMBER(wordrec_display_splits, 0, "Display splits", params()),
+  INT_MEMBER(wordrec_display_segmentations, 0, "Display Segmentations",
+             params()),
+  BOOL_MEMBER(wordrec_display_all_blobs, 0, "Display Blobs", params()),
+  BOOL_MEMBER(wordrec_display_all_words, 0, "Display Words", params()),
+  BOOL_MEMBER(wordrec_blob_pause, 0, "Blob pause", params()) {
   prev_word_best_choice_ = NULL;
   language_model_ = new LanguageModel(&get_fontinfo_table(),
                                       &(getDict()));
@@ -156,6 +156,11 @@ class Wordrec : public Classify {
   BOOL_VAR_H(save_alt_choices, false,
              "Save alternative paths found during chopping "
              "and segmentation search");
+  BOOL_VAR_H(wordrec_display_splits, 0, "Display splits");
+  INT_VAR_H(wordrec_display_segmentations, 0, "Display Segmentations");
+  BOOL_VAR_H(wordrec_display_all_blobs, 0, "Display Blobs");
+  BOOL_VAR_H(wordrec_display_all_words, 0, "Display Words");
+  BOOL_VAR_H(wordrec_blob_pause, 0, "Blob pause");
 
   // methods from wordrec/*.cpp ***********************************************
   Wordrec();